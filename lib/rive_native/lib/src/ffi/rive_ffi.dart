@@ -554,6 +554,11 @@ final bool Function(Pointer<Void> smi) _stateMachineInstanceDone = nativeLib
     .lookup<NativeFunction<Bool Function(Pointer<Void>)>>(
         'stateMachineInstanceDone')
     .asFunction();
+final bool Function(Pointer<Void> smi) _stateMachineInstanceQuiescent =
+    nativeLib
+        .lookup<NativeFunction<Bool Function(Pointer<Void>)>>(
+            'stateMachineInstanceQuiescent')
+        .asFunction();
 final double Function(Pointer<Void>) _getNumberValue = nativeLib
     .lookup<NativeFunction<Float Function(Pointer<Void>)>>('getNumberValue')
     .asFunction();
@@ -2016,6 +2021,9 @@ class FFIStateMachine extends StateMachine
   @override
   bool get isDone => _stateMachineInstanceDone(pointer);
 
+  @override
+  bool get isQuiescent => _stateMachineInstanceQuiescent(pointer);
+
   @override
   bool hitTest(Vec2D position) =>
       _stateMachineInstanceHitTest(pointer, position.x, position.y);
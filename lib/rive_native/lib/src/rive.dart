@@ -899,6 +899,11 @@ abstract class StateMachine implements EventListenerInterface {
   @useResult
   CallbackHandler onInputChanged(Function(int index) callback);
   bool get isDone;
+
+  /// Whether the state machine settled on its last advance and nothing
+  /// (inputs, data binds, properties) changed since. Advancing it again
+  /// would produce the same frame, so the last rendered frame can be reused.
+  bool get isQuiescent;
   bool hitTest(Vec2D position);
   HitResult pointerDown(Vec2D position);
   HitResult pointerMove(Vec2D position);
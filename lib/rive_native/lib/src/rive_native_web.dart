@@ -383,6 +383,7 @@ class RiveWasm {
   static late js.JSFunction stateMachineInputType;
   static late js.JSFunction stateMachineInstanceNumber;
   static late js.JSFunction stateMachineInstanceDone;
+  static late js.JSFunction stateMachineInstanceQuiescent;
   static late js.JSFunction stateMachineInstanceHitTest;
   static late js.JSFunction stateMachineInstancePointerDown;
   static late js.JSFunction stateMachineInstancePointerUp;
@@ -755,6 +756,8 @@ class RiveWasm {
         module['_stateMachineInstanceNumber'] as js.JSFunction;
     stateMachineInstanceDone =
         module['_stateMachineInstanceDone'] as js.JSFunction;
+    stateMachineInstanceQuiescent =
+        module['_stateMachineInstanceQuiescent'] as js.JSFunction;
     stateMachineInstanceHitTest =
         module['_stateMachineInstanceHitTest'] as js.JSFunction;
     stateMachineInstancePointerDown =
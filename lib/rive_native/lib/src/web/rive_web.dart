@@ -1414,6 +1414,10 @@ class WebStateMachine extends StateMachine with EventListenerMixin {
   bool get isDone => _wasmBool(
       RiveWasm.stateMachineInstanceDone.callAsFunction(null, _pointer.toJS));
 
+  @override
+  bool get isQuiescent => _wasmBool(RiveWasm.stateMachineInstanceQuiescent
+      .callAsFunction(null, _pointer.toJS));
+
   @override
   bool hitTest(Vec2D position) => _wasmBool(RiveWasm.stateMachineInstanceHitTest
       .callAsFunction(null, _pointer.toJS, position.x.toJS, position.y.toJS));
@@ -9,6 +9,7 @@
 
 #include "rive/renderer/gl/render_context_gl_impl.hpp"
 #include "rive/renderer/gl/render_target_gl.hpp"
+#include "rive_worker.hpp"
 
 #include <android/log.h>
 #include <android/native_window_jni.h>
@@ -218,6 +219,11 @@ public:
         m_currentSurface = m_backgroundSurface;
 
         m_renderContext = rive::gpu::RenderContextGLImpl::MakeContext();
+        if (m_renderContext != nullptr)
+        {
+            m_renderContext->setFlushTaskScheduler(
+                rive::RiveWorkerFlushScheduler::get());
+        }
     }
 
     ~EGLThreadState()
@@ -2,6 +2,7 @@
 #include "rive_native/rive_binding.hpp"
 #include "rive/renderer/d3d/render_context_d3d_impl.hpp"
 #include "rive/renderer/rive_renderer.hpp"
+#include "rive_worker.hpp"
 #include <unordered_map>
 #include <d3d11_4.h>
 
@@ -267,6 +268,10 @@ PLUGIN_API void* createRiveRendererContext(
     auto context = rive::gpu::RenderContextD3DImpl::MakeContext(gpu,
                                                                 gpuContext,
                                                                 contextOptions);
+    if (context != nullptr)
+    {
+        context->setFlushTaskScheduler(rive::RiveWorkerFlushScheduler::get());
+    }
 
     return (void*)(g_renderContext = context.release());
 }
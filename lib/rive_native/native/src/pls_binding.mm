@@ -6,6 +6,7 @@
 #include "rive/renderer/rive_render_factory.hpp"
 #include "rive/shapes/paint/color.hpp"
 #include "rive/core/binary_reader.hpp"
+#include "rive_worker.hpp"
 #include <unordered_map>
 
 rive::gpu::RenderContext* g_renderContext = nullptr;
@@ -122,6 +123,11 @@ void* createRiveRendererContext(void* gpu)
     g_renderContext = rive::gpu::RenderContextMetalImpl::MakeContext(
                           (__bridge id<MTLDevice>)gpu)
                           .release();
+    if (g_renderContext != nullptr)
+    {
+        g_renderContext->setFlushTaskScheduler(
+            rive::RiveWorkerFlushScheduler::get());
+    }
     return g_renderContext;
 }
 void destroyRiveRendererContext(void* context)
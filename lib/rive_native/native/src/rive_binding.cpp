@@ -36,6 +36,8 @@
 #include "rive/custom_property_string.hpp"
 #include "rive/custom_property.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
+#include "rive_worker.hpp"
+#include <functional>
 #include <mutex>
 
 class WrappedArtboard;
@@ -178,6 +180,10 @@ public:
     {
         // Events should call back with the wrapper.
         m_artboard->callbackUserData = this;
+#ifdef WITH_RIVE_WORKER
+        // Nested artboards pick this up from their host.
+        m_artboard->updateScheduler(RiveWorkerUpdateScheduler::get());
+#endif
 #ifdef DEBUG
         g_artboardCount++;
 #endif
@@ -3428,6 +3434,15 @@ EXPORT bool stateMachineInstanceDone(WrappedStateMachine* wrappedMachine)
     return !wrappedMachine->stateMachine()->needsAdvance();
 }
 
+EXPORT bool stateMachineInstanceQuiescent(WrappedStateMachine* wrappedMachine)
+{
+    if (wrappedMachine == nullptr)
+    {
+        return false;
+    }
+    return wrappedMachine->stateMachine()->isQuiescent();
+}
+
 EXPORT float getNumberValue(WrappedInput* wrappedInput)
 {
     if (wrappedInput == nullptr)
@@ -3558,161 +3573,35 @@ EXPORT void initBindingCallbacks(ViewModelUpdateNumber viewModelUpdateNumber,
 }
 
 #ifdef WITH_RIVE_WORKER
-#include <condition_variable>
-#include <deque>
-#include <thread>
-
-struct Work
-{
-    rcp<WrappedStateMachine> smi;
-    bool done;
-};
-
-class RiveWorker
-{
-private:
-    static const int threadCount = 6;
-    static RiveWorker* sm_instance;
-    static bool sm_exiting;
-    std::vector<Work> m_work;
-    std::condition_variable m_haveWork;
-    std::condition_variable m_didSomeWork;
-    std::vector<std::thread> m_workThreads;
-    std::mutex m_mutex;
-    float m_elapsedSeconds;
-    uint64_t m_workIndex = 0;
-    uint64_t m_completed = 0;
-    uint64_t m_toComplete = 0;
-
-    RiveWorker()
-    {
-        std::atexit(atExit);
-        for (int i = 0; i < threadCount; i++)
-        {
-            m_workThreads.emplace_back(std::thread(staticWorkThread, this));
-        }
-    }
-
-    void workThread()
-    {
-        while (!sm_exiting)
-        {
-            Work* work = nullptr;
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                if (m_workIndex < m_work.size())
-                {
-                    work = &m_work[m_workIndex++];
-                }
-                else
-                {
-                    m_haveWork.wait_for(lock, std::chrono::milliseconds(100));
-                }
-            }
-            if (work != nullptr)
-            {
-                work->smi->stateMachine()->advanceAndApply(m_elapsedSeconds);
-                std::unique_lock<std::mutex> lock(m_mutex);
-                work->done = true;
-                m_completed++;
-            }
-            m_didSomeWork.notify_all();
-        }
-    }
-
-    static void staticWorkThread(void* w)
-    {
-        RiveWorker* worker = static_cast<RiveWorker*>(w);
-        worker->workThread();
-    }
-
-    static void atExit() { sm_exiting = true; }
-
-public:
-    static RiveWorker* get()
-    {
-        if (sm_instance == nullptr)
-        {
-            sm_instance = new RiveWorker();
-        }
-
-        return sm_instance;
-    }
-
-    void add(float elapsedSeconds, WrappedStateMachine** smi, uint64_t count)
-    {
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_elapsedSeconds = elapsedSeconds;
-            m_toComplete = count;
-            m_completed = 0;
-            m_workIndex = 0;
-            m_work.clear();
-            for (uint64_t i = 0; i < count; i++)
-            {
-                m_work.push_back({ref_rcp(smi[i]), false});
-            }
-        }
-        m_haveWork.notify_all();
-    }
-
-    void complete(
-        std::function<void(rcp<WrappedStateMachine>)> callback = nullptr)
-    {
-        int completedIndex = 0;
-        while (!sm_exiting)
-        {
-            // Keep rendering artboards that are done.
-            std::unique_lock<std::mutex> lock(m_mutex);
-            if (callback != nullptr)
-            {
-                // Any artboards ready to draw?
-                if (completedIndex < m_toComplete &&
-                    m_work[completedIndex].done)
-                {
-                    // While locked, count how many we can draw unlocked.
-                    uint64_t completedFrom = completedIndex;
-                    while (++completedIndex < m_toComplete &&
-                           m_work[completedIndex].done)
-                    {
-                        // Intentionally empty.
-                    }
-                    lock.unlock();
-                    while (completedFrom < completedIndex)
-                    {
-                        callback(m_work[completedFrom].smi);
-                        completedFrom++;
-                    }
-                    continue;
-                }
-            }
-            if (m_toComplete == m_completed)
-            {
-                break;
-            }
-            m_didSomeWork.wait_for(lock, std::chrono::milliseconds(100));
-        }
-    }
-};
-
-RiveWorker* RiveWorker::sm_instance = nullptr;
-bool RiveWorker::sm_exiting = false;
+rive::RiveWorker* rive::RiveWorker::sm_instance = nullptr;
+std::atomic<bool> rive::RiveWorker::sm_exiting{false};
 #endif
 
 EXPORT void stateMachineInstanceBatchAdvance(WrappedStateMachine** smi,
                                              SizeType count,
                                              float elapsedSeconds)
 {
+    auto advance = [smi, elapsedSeconds](uint32_t index) {
+        // Idle state machines would advance to the exact same frame.
+        auto machine = smi[index]->stateMachine();
+        if (!machine->isQuiescent())
+        {
+            machine->advanceAndApply(elapsedSeconds);
+        }
+    };
 #ifdef WITH_RIVE_WORKER
+    std::function<void(uint32_t)> work = advance;
     RiveWorker* worker = RiveWorker::get();
-    worker->add(elapsedSeconds, smi, count);
-    worker->complete();
-#else
-    for (int i = 0; i < count; i++)
+    if (worker->begin((uint32_t)count, work))
     {
-        smi[i]->stateMachine()->advanceAndApply(elapsedSeconds);
+        worker->complete();
+        return;
     }
 #endif
+    for (uint32_t i = 0; i < count; i++)
+    {
+        advance(i);
+    }
 }
 
 EXPORT void stateMachineInstanceBatchAdvanceAndRender(WrappedStateMachine** smi,
@@ -3724,30 +3613,37 @@ EXPORT void stateMachineInstanceBatchAdvanceAndRender(WrappedStateMachine** smi,
     {
         return;
     }
-#ifdef WITH_RIVE_WORKER
-    RiveWorker* worker = RiveWorker::get();
-    worker->add(elapsedSeconds, smi, count);
-    worker->complete([&](rcp<WrappedStateMachine> smi) {
+    auto advance = [smi, elapsedSeconds](uint32_t index) {
+        // Idle state machines would advance to the exact same frame.
+        auto machine = smi[index]->stateMachine();
+        if (!machine->isQuiescent())
+        {
+            machine->advanceAndApply(elapsedSeconds);
+        }
+    };
+    auto draw = [smi, renderer](uint32_t index) {
         WrappedArtboard* wrappedArtboard = static_cast<WrappedArtboard*>(
-            smi->stateMachine()->artboard()->callbackUserData);
+            smi[index]->stateMachine()->artboard()->callbackUserData);
         renderer->save();
         renderer->transform(wrappedArtboard->renderTransform);
         wrappedArtboard->artboard()->draw(renderer);
         renderer->restore();
-    });
-#else
-    for (int i = 0; i < count; i++)
+    };
+#ifdef WITH_RIVE_WORKER
+    std::function<void(uint32_t)> work = advance;
+    RiveWorker* worker = RiveWorker::get();
+    if (worker->begin((uint32_t)count, work))
     {
-        smi[i]->stateMachine()->advanceAndApply(elapsedSeconds);
-        WrappedArtboard* wrappedArtboard = static_cast<WrappedArtboard*>(
-            smi[i]->stateMachine()->artboard()->callbackUserData);
-        renderer->save();
-        renderer->transform(wrappedArtboard->renderTransform);
-        wrappedArtboard->artboard()->draw(renderer);
-        renderer->restore();
+        // Draw each artboard as soon as it and every one before it advanced.
+        worker->complete(draw);
+        return;
     }
-    return;
 #endif
+    for (uint32_t i = 0; i < count; i++)
+    {
+        advance(i);
+        draw(i);
+    }
 }
 
 EXPORT void wasmStateMachineInstanceBatchAdvance(uint32_t wasmPtr,
@@ -0,0 +1,437 @@
+#ifndef _RIVE_WORKER_HPP_
+#define _RIVE_WORKER_HPP_
+
+#ifdef WITH_RIVE_WORKER
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rive/component_update_scheduler.hpp"
+#include "rive/renderer/flush_task_scheduler.hpp"
+
+namespace rive
+{
+// Range of work indices [begin, end) packed with the low bits of the batch
+// generation into 64 bits so it can be claimed from with a single compare and
+// swap. The generation keeps a thread that stalled between loading and
+// swapping a range from claiming a matching range of a later batch.
+static const uint32_t rangeIndexMask = (1u << 24) - 1;
+static inline uint64_t packRange(uint64_t generation,
+                                 uint32_t begin,
+                                 uint32_t end)
+{
+    return (generation & 0xffff) << 48 | (uint64_t)begin << 24 | end;
+}
+static inline uint64_t rangeTag(uint64_t range) { return range >> 48; }
+static inline uint32_t rangeBegin(uint64_t range)
+{
+    return (uint32_t)(range >> 24) & rangeIndexMask;
+}
+static inline uint32_t rangeEnd(uint64_t range)
+{
+    return (uint32_t)range & rangeIndexMask;
+}
+
+// Thread pool shared by batch state machine advances, artboard component
+// updates and flush tessellation.
+//
+// Each batch is split into one contiguous range per worker thread (plus one
+// for the thread calling complete). Owners claim chunks from the front of
+// their range, idle threads steal half of another range from the back. No
+// locks are taken while work is available, workers spin briefly and then
+// park on a condition variable between batches.
+//
+// One batch runs at a time. A batch started while another is running (from
+// another thread, or from inside one of the running batch's items) is refused
+// and the caller runs its items itself.
+class RiveWorker
+{
+private:
+    static const int threadCount = 6;
+    // Slot used by the thread calling complete().
+    static const int callerSlot = threadCount;
+    static const int slotCount = threadCount + 1;
+    static const int spinCount = 2000;
+    static RiveWorker* sm_instance;
+    static std::atomic<bool> sm_exiting;
+
+    // Per-slot ranges, padded so owners don't false share.
+    struct alignas(64) Deque
+    {
+        std::atomic<uint64_t> range{0};
+    };
+    Deque m_deques[slotCount];
+
+    // Set from begin() until complete() returns.
+    std::atomic<bool> m_busy{false};
+    const std::function<void(uint32_t)>* m_work = nullptr;
+    std::unique_ptr<std::atomic<bool>[]> m_done;
+    uint32_t m_workCapacity = 0;
+    uint32_t m_workCount = 0;
+    // Read by workers that may still hold a range loaded from the previous
+    // batch (their swap then fails), so it's atomic.
+    std::atomic<uint32_t> m_chunkSize{1};
+    std::atomic<uint32_t> m_remaining{0};
+
+    // Bumped for every batch, workers wait for it to change.
+    std::atomic<uint64_t> m_generation{0};
+    std::atomic<int> m_parked{0};
+    std::mutex m_parkMutex;
+    std::condition_variable m_parkCondition;
+    std::vector<std::thread> m_workThreads;
+
+    RiveWorker()
+    {
+        std::atexit(atExit);
+        for (int i = 0; i < threadCount; i++)
+        {
+            m_workThreads.emplace_back(std::thread(staticWorkThread, this, i));
+        }
+    }
+
+    // Claim up to m_chunkSize items from the front of our own range.
+    bool claimOwn(int slot, uint32_t& begin, uint32_t& end)
+    {
+        std::atomic<uint64_t>& range = m_deques[slot].range;
+        uint64_t current = range.load(std::memory_order_acquire);
+        while (rangeBegin(current) < rangeEnd(current))
+        {
+            begin = rangeBegin(current);
+            end = std::min(rangeEnd(current),
+                           begin +
+                               m_chunkSize.load(std::memory_order_relaxed));
+            if (range.compare_exchange_weak(
+                    current,
+                    packRange(rangeTag(current), end, rangeEnd(current)),
+                    std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Steal the back half of the first non empty victim range. The stolen
+    // items are published as our own range, or returned in [begin, end) to be
+    // run directly if our range moved on since we looked at it.
+    bool steal(int slot, uint32_t& begin, uint32_t& end)
+    {
+        std::atomic<uint64_t>& ownRange = m_deques[slot].range;
+        uint64_t own = ownRange.load(std::memory_order_acquire);
+        if (rangeBegin(own) < rangeEnd(own))
+        {
+            return claimOwn(slot, begin, end);
+        }
+        for (int offset = 1; offset < slotCount; offset++)
+        {
+            int victim = (slot + offset) % slotCount;
+            std::atomic<uint64_t>& range = m_deques[victim].range;
+            uint64_t current = range.load(std::memory_order_acquire);
+            while (rangeBegin(current) < rangeEnd(current) &&
+                   rangeTag(current) == rangeTag(own))
+            {
+                uint32_t victimBegin = rangeBegin(current);
+                uint32_t victimEnd = rangeEnd(current);
+                uint32_t split = victimBegin + (victimEnd - victimBegin) / 2;
+                uint64_t tag = rangeTag(current);
+                if (range.compare_exchange_weak(
+                        current,
+                        packRange(tag, victimBegin, split),
+                        std::memory_order_acq_rel))
+                {
+                    // Only publish over the exact (empty, same batch) range
+                    // we read. If it changed, nobody else knows about the
+                    // stolen items, so run them here.
+                    if (ownRange.compare_exchange_strong(
+                            own,
+                            packRange(tag, split, victimEnd),
+                            std::memory_order_acq_rel))
+                    {
+                        if (claimOwn(slot, begin, end))
+                        {
+                            return true;
+                        }
+                        // Stolen back in the meantime, keep looking.
+                        own = ownRange.load(std::memory_order_acquire);
+                        break;
+                    }
+                    begin = split;
+                    end = victimEnd;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool claim(int slot, uint32_t& begin, uint32_t& end)
+    {
+        return claimOwn(slot, begin, end) || steal(slot, begin, end);
+    }
+
+    void run(uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; i++)
+        {
+            (*m_work)(i);
+            m_done[i].store(true, std::memory_order_release);
+        }
+        m_remaining.fetch_sub(end - begin, std::memory_order_acq_rel);
+    }
+
+    void workThread(int slot)
+    {
+        uint64_t seenGeneration = 0;
+        while (!sm_exiting)
+        {
+            uint32_t begin, end;
+            if (claim(slot, begin, end))
+            {
+                run(begin, end);
+                continue;
+            }
+
+            // Out of work, spin for a bit in case a new batch is close, then
+            // park until the generation moves.
+            uint64_t generation = m_generation.load(std::memory_order_acquire);
+            if (generation != seenGeneration)
+            {
+                seenGeneration = generation;
+                continue;
+            }
+            bool woke = false;
+            for (int i = 0; i < spinCount; i++)
+            {
+                if (m_generation.load(std::memory_order_acquire) !=
+                    seenGeneration)
+                {
+                    woke = true;
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            if (woke)
+            {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_parkMutex);
+            // seq_cst, see wake().
+            m_parked.fetch_add(1, std::memory_order_seq_cst);
+            m_parkCondition.wait(lock, [&] {
+                return sm_exiting ||
+                       m_generation.load(std::memory_order_seq_cst) !=
+                           seenGeneration;
+            });
+            m_parked.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    static void staticWorkThread(void* w, int slot)
+    {
+        RiveWorker* worker = static_cast<RiveWorker*>(w);
+        worker->workThread(slot);
+    }
+
+    // A parking worker increments m_parked, then loads m_generation. A new
+    // batch stores m_generation, then loads m_parked here. All four accesses
+    // are seq_cst, so at least one side sees the other's store: either the
+    // worker sees the new generation and doesn't wait, or we see it parked
+    // and notify. Weaker orders would allow both loads to read stale values.
+    void wake()
+    {
+        if (m_parked.load(std::memory_order_seq_cst) > 0)
+        {
+            // Taking the lock orders the notify after a worker that is about
+            // to wait has registered itself.
+            std::unique_lock<std::mutex> lock(m_parkMutex);
+            m_parkCondition.notify_all();
+        }
+    }
+
+    static void atExit()
+    {
+        sm_exiting = true;
+        if (sm_instance != nullptr)
+        {
+            std::unique_lock<std::mutex> lock(sm_instance->m_parkMutex);
+            sm_instance->m_parkCondition.notify_all();
+        }
+    }
+
+public:
+    static RiveWorker* get()
+    {
+        // Render threads flushing through RiveWorkerFlushScheduler may be the
+        // first to get here, so let the static initialization lock it.
+        static RiveWorker* worker = sm_instance = new RiveWorker();
+        return worker;
+    }
+
+    // Starts a batch calling work(index) for every index in [0, count). work
+    // must stay alive until complete() returns. Returns false without
+    // starting anything if another batch is running.
+    bool begin(uint32_t count, const std::function<void(uint32_t)>& work)
+    {
+        bool busy = false;
+        if (!m_busy.compare_exchange_strong(busy,
+                                            true,
+                                            std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        // The previous batch was fully completed, so every range is empty and
+        // no worker touches m_work until the new ranges are published below.
+        assert(count <= rangeIndexMask);
+        if (count > m_workCapacity)
+        {
+            m_workCapacity = std::max(count, m_workCapacity * 2);
+            m_done.reset(new std::atomic<bool>[m_workCapacity]);
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_done[i].store(false, std::memory_order_relaxed);
+        }
+        m_work = &work;
+        m_workCount = count;
+        m_chunkSize.store(std::max(1u, count / (slotCount * 8)),
+                          std::memory_order_relaxed);
+        m_remaining.store(count, std::memory_order_relaxed);
+
+        uint64_t generation = m_generation.load(std::memory_order_relaxed) + 1;
+        uint32_t per = count / slotCount;
+        uint32_t extra = count % slotCount;
+        uint32_t begin = 0;
+        for (int i = 0; i < slotCount; i++)
+        {
+            uint32_t end = begin + per + (i < (int)extra ? 1 : 0);
+            m_deques[i].range.store(packRange(generation, begin, end),
+                                    std::memory_order_release);
+            begin = end;
+        }
+        // seq_cst, see wake().
+        m_generation.store(generation, std::memory_order_seq_cst);
+        wake();
+        return true;
+    }
+
+    // Helps run the batch started by begin() until every item completed. When
+    // given, onDone(index) is called on this thread for every item, in order,
+    // as soon as it and every item before it completed.
+    void complete(const std::function<void(uint32_t)>& onDone = nullptr)
+    {
+        uint32_t completedIndex = 0;
+        while (!sm_exiting)
+        {
+            if (onDone != nullptr)
+            {
+                // Stream everything that's ready, in order.
+                bool streamed = false;
+                while (completedIndex < m_workCount &&
+                       m_done[completedIndex].load(std::memory_order_acquire))
+                {
+                    onDone(completedIndex++);
+                    streamed = true;
+                }
+                if (completedIndex == m_workCount)
+                {
+                    break;
+                }
+                if (streamed)
+                {
+                    continue;
+                }
+            }
+            else if (m_remaining.load(std::memory_order_acquire) == 0)
+            {
+                break;
+            }
+
+            // Help out instead of waiting.
+            uint32_t begin, end;
+            if (claim(callerSlot, begin, end))
+            {
+                run(begin, end);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        // Workers may still be finishing the last chunk they claimed before
+        // the batch can be reused.
+        while (!sm_exiting && m_remaining.load(std::memory_order_acquire) != 0)
+        {
+            std::this_thread::yield();
+        }
+        m_work = nullptr;
+        m_busy.store(false, std::memory_order_release);
+    }
+
+    // Calls work(index) for every index in [0, count) and returns once they
+    // all completed. Runs on the pool when it's free, on this thread
+    // otherwise.
+    void parallelFor(size_t count, const std::function<void(size_t)>& work)
+    {
+        std::function<void(uint32_t)> item = [&work](uint32_t index) {
+            work(index);
+        };
+        if (count > 1 && count <= rangeIndexMask &&
+            begin((uint32_t)count, item))
+        {
+            complete();
+            return;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            work(i);
+        }
+    }
+};
+
+// Updates artboard component islands (and shapes text) on the shared pool.
+class RiveWorkerUpdateScheduler : public ComponentUpdateScheduler
+{
+public:
+    static RiveWorkerUpdateScheduler* get()
+    {
+        static RiveWorkerUpdateScheduler scheduler;
+        return &scheduler;
+    }
+
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)>& work) override
+    {
+        RiveWorker::get()->parallelFor(count, work);
+    }
+};
+
+// Writes deferred flush tessellation on the shared pool. When the pool is
+// busy (e.g. advancing state machines on another thread) the flush does the
+// work itself.
+class RiveWorkerFlushScheduler : public gpu::FlushTaskScheduler
+{
+public:
+    static RiveWorkerFlushScheduler* get()
+    {
+        static RiveWorkerFlushScheduler scheduler;
+        return &scheduler;
+    }
+
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)>& work) override
+    {
+        RiveWorker::get()->parallelFor(count, work);
+    }
+};
+} // namespace rive
+#endif
+#endif
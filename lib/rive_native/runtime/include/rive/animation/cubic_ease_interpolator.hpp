@@ -9,6 +9,9 @@ class CubicEaseInterpolator : public CubicEaseInterpolatorBase
 public:
     float transformValue(float valueFrom, float valueTo, float factor) override;
     float transform(float factor) const override;
+    float transformValueForT(float valueFrom,
+                             float valueTo,
+                             float t) override;
 };
 } // namespace rive
 
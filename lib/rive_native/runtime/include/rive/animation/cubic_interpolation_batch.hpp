@@ -0,0 +1,51 @@
+#ifndef _RIVE_CUBIC_INTERPOLATION_BATCH_HPP_
+#define _RIVE_CUBIC_INTERPOLATION_BATCH_HPP_
+
+#include <vector>
+
+namespace rive
+{
+class Core;
+class CubicInterpolator;
+class CubicInterpolatorSolver;
+class KeyFrame;
+
+/// Collects the cubic interpolated double keyframes applied by an animation
+/// so their eased factors can be solved together with
+/// CubicInterpolatorSolver::getTBatch before being applied.
+class CubicInterpolationBatch
+{
+public:
+    /// Queues the interpolation from fromFrame to toFrame. Returns false if
+    /// the frame isn't a cubic interpolated double, in which case the caller
+    /// must apply it directly.
+    bool add(Core* object,
+             int propertyKey,
+             float seconds,
+             const KeyFrame* fromFrame,
+             const KeyFrame* toFrame,
+             float mix);
+
+    /// Solves and applies every queued frame, in the order they were added.
+    void apply();
+
+    bool empty() const { return m_entries.empty(); }
+
+private:
+    struct Entry
+    {
+        Core* object;
+        int propertyKey;
+        float mix;
+        float valueFrom;
+        float valueTo;
+        CubicInterpolator* interpolator;
+    };
+    std::vector<Entry> m_entries;
+    std::vector<const CubicInterpolatorSolver*> m_solvers;
+    std::vector<float> m_factors;
+    std::vector<float> m_ts;
+};
+} // namespace rive
+
+#endif
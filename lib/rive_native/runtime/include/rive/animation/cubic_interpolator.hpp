@@ -11,6 +11,15 @@ public:
     StatusCode onAddedDirty(CoreContext* context) override;
     void initialize() override;
 
+    const CubicInterpolatorSolver& solver() const { return m_solver; }
+
+    /// Same as transformValue but with t already solved for the factor, lets
+    /// callers solve many factors at once with
+    /// CubicInterpolatorSolver::getTBatch.
+    virtual float transformValueForT(float valueFrom,
+                                     float valueTo,
+                                     float t) = 0;
+
 protected:
     CubicInterpolatorSolver m_solver;
 };
@@ -1,6 +1,8 @@
 #ifndef _RIVE_CUBIC_INTERPOLATOR_SOLVER_HPP_
 #define _RIVE_CUBIC_INTERPOLATOR_SOLVER_HPP_
 
+#include <cstddef>
+
 namespace rive
 {
 // A helper for finding T based on X value.
@@ -11,13 +13,29 @@ public:
     float getT(float x) const;
     static float calcBezier(float aT, float aA1, float aA2);
 
+    /// Finds T for count X values at once, xs[i] is solved with solvers[i]
+    /// and written to ts[i]. Values are solved four at a time, yielding the
+    /// same results as calling getT on each.
+    static void getTBatch(const CubicInterpolatorSolver* const* solvers,
+                          const float* xs,
+                          float* ts,
+                          size_t count);
+
 private:
     static constexpr int SplineTableSize = 11;
     static constexpr float SampleStepSize = 1.0f / (SplineTableSize - 1.0f);
     float m_values[SplineTableSize];
     float m_x1;
     float m_x2;
+    // Whether m_values is sorted, which is the case when x1 and x2 are in
+    // [0, 1]. The batched table search relies on it.
+    bool m_isMonotonic;
+
+    static void getT4(const CubicInterpolatorSolver* const* solvers,
+                      const float* xs,
+                      float* ts);
+    float bisect(float x, float intervalStart) const;
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
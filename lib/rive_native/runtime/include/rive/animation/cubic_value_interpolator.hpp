@@ -19,6 +19,9 @@ public:
     CubicValueInterpolator();
     float transformValue(float valueFrom, float valueTo, float factor) override;
     float transform(float factor) const override;
+    float transformValueForT(float valueFrom,
+                             float valueTo,
+                             float t) override;
     StatusCode onAddedDirty(CoreContext* context) override;
 };
 } // namespace rive
@@ -5,6 +5,7 @@
 namespace rive
 {
 class Artboard;
+class CubicInterpolationBatch;
 class KeyedProperty;
 class KeyedCallbackReporter;
 class KeyedObject : public KeyedObjectBase
@@ -20,7 +21,11 @@ public:
                               float secondsFrom,
                               float secondsTo,
                               bool isAtStartFrame) const;
-    void apply(Artboard* coreContext, float time, float mix);
+    void apply(Artboard* coreContext,
+               float time,
+               float mix,
+               CubicInterpolationBatch* batch = nullptr,
+               uint32_t* keyFrameCursors = nullptr);
 
     StatusCode import(ImportStack& importStack) override;
 
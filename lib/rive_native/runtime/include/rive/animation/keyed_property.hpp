@@ -4,6 +4,7 @@
 #include <vector>
 namespace rive
 {
+class CubicInterpolationBatch;
 class KeyFrame;
 class KeyedCallbackReporter;
 class KeyedProperty : public KeyedPropertyBase
@@ -22,8 +23,15 @@ public:
                               float secondsTo,
                               bool isAtStartFrame) const;
 
-    /// Apply interpolating key frames.
-    void apply(Core* object, float time, float mix);
+    /// Apply interpolating key frames. Cubic interpolated frames are queued
+    /// to batch instead, when provided, and applied when it is. keyFrameCursor
+    /// optionally remembers the keyframe index between applies so it can be
+    /// found again without a binary search.
+    void apply(Core* object,
+               float time,
+               float mix,
+               CubicInterpolationBatch* batch = nullptr,
+               uint32_t* keyFrameCursor = nullptr);
 
     StatusCode import(ImportStack& importStack) override;
     KeyFrame* first() const
@@ -37,7 +45,11 @@ public:
 
 private:
     int closestFrameIndex(float seconds, int exactOffset = 0) const;
+    int closestFrameIndex(float seconds, uint32_t& cursor) const;
     std::vector<std::unique_ptr<KeyFrame>> m_keyFrames;
+    // The seconds of each keyframe, packed so searches don't have to chase
+    // the keyframe pointers.
+    std::vector<float> m_keyFrameSeconds;
 };
 } // namespace rive
 
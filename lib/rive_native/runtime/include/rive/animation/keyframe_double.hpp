@@ -12,6 +12,12 @@ public:
                             float seconds,
                             const KeyFrame* nextFrame,
                             float mix) override;
+
+    /// Mixes value into the object's double property.
+    static void applyValue(Core* object,
+                           int propertyKey,
+                           float mix,
+                           float value);
 };
 } // namespace rive
 
@@ -13,6 +13,7 @@ class LinearAnimation : public LinearAnimationBase
 {
 private:
     std::vector<std::unique_ptr<KeyedObject>> m_KeyedObjects;
+    size_t m_keyedPropertyCount = 0;
 
     friend class Artboard;
 
@@ -22,7 +23,16 @@ public:
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
     void addKeyedObject(std::unique_ptr<KeyedObject>);
-    void apply(Artboard* artboard, float time, float mix = 1.0f) const;
+    /// Applies the animation at time. keyFrameCursors, when provided, holds
+    /// one entry per keyed property (see keyedPropertyCount) remembering the
+    /// keyframe last applied so it can be found again without searching.
+    void apply(Artboard* artboard,
+               float time,
+               float mix = 1.0f,
+               uint32_t* keyFrameCursors = nullptr) const;
+
+    /// Total number of properties keyed by this animation.
+    size_t keyedPropertyCount() const { return m_keyedPropertyCount; }
 
     Loop loop() const { return (Loop)loopValue(); }
 
@@ -62,7 +62,10 @@ public:
     // other animations applied to the artboard.
     void apply(float mix = 1.0f) const
     {
-        m_animation->apply(m_artboardInstance, m_time, mix);
+        m_animation->apply(m_artboardInstance,
+                           m_time,
+                           mix,
+                           m_keyFrameCursors.data());
     }
 
     // Set when the animation is advanced, true if the animation has stopped
@@ -120,6 +123,10 @@ private:
     float m_direction;
     bool m_didLoop;
     int m_loopValue = -1;
+
+    // The keyframe index each keyed property applied last, see
+    // LinearAnimation::apply.
+    mutable std::vector<uint32_t> m_keyFrameCursors;
 };
 } // namespace rive
 #endif
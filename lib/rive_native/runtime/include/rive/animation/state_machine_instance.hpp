@@ -94,6 +94,13 @@ public:
     // Returns true when the StateMachineInstance has more data to process.
     bool needsAdvance() const;
 
+    /// Returns true when the last advanceAndApply settled (no transitions,
+    /// animations or events left to play) and nothing changed since: no
+    /// input changes, no dirty data binds, no dirty components, including in
+    /// nested artboards. Advancing a quiescent instance is a no-op, so hosts
+    /// can skip it and keep its last rendered frame.
+    bool isQuiescent() const;
+
     // Returns a pointer to the instance's stateMachine
     const StateMachine* stateMachine() const { return m_machine; }
 
@@ -188,6 +195,9 @@ private:
     std::vector<EventReport> m_reportedEvents;
     const StateMachine* m_machine;
     bool m_needsAdvance = false;
+    // Set when advanceAndApply had nothing left to do, cleared by anything
+    // that calls markNeedsAdvance.
+    bool m_settled = false;
     std::vector<SMIInput*> m_inputInstances; // we own each pointer
     size_t m_layerCount;
     StateMachineLayerInstance* m_layers;
@@ -4,7 +4,9 @@
 #include "rive/advance_flags.hpp"
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/state_machine.hpp"
+#include "rive/component_update_scheduler.hpp"
 #include "rive/core_context.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/data_bind.hpp"
 #include "rive/data_bind/data_context.hpp"
 #include "rive/data_bind/data_bind_context.hpp"
@@ -14,11 +16,14 @@
 #include "rive/hit_info.hpp"
 #include "rive/math/aabb.hpp"
 #include "rive/renderer.hpp"
+#include "rive/text/text_render_mode.hpp"
 #include "rive/text/text_value_run.hpp"
+#include "rive/transform_arrays.hpp"
 #include "rive/event.hpp"
 #include "rive/audio/audio_engine.hpp"
 #include "rive/math/raw_path.hpp"
 
+#include <atomic>
 #include <queue>
 #include <unordered_set>
 #include <vector>
@@ -37,6 +42,7 @@ class LinearAnimationInstance;
 class Scene;
 class StateMachineInstance;
 class Joystick;
+class Text;
 class TextValueRun;
 class Event;
 class SMIBool;
@@ -85,6 +91,87 @@ private:
                               Core* clone,
                               Artboard* artboard) const;
 
+    // Backing storage for the cloned objects of an arena instance, released
+    // after the destructor has destroyed every object it holds.
+    std::unique_ptr<CoreArena> m_objectArena;
+    // Bytes the cloned objects of this artboard needed the last time it was
+    // instanced into an arena, used to size the next arena in one block.
+    mutable std::atomic<size_t> m_instanceArenaSize{0};
+
+    template <typename T> std::unique_ptr<T> cloneInstance(bool useArena) const
+    {
+        std::unique_ptr<T> artboardClone(new T);
+        artboardClone->copy(*this);
+
+        artboardClone->m_Factory = m_Factory;
+        artboardClone->m_FrameOrigin = m_FrameOrigin;
+        artboardClone->m_DataContext = m_DataContext;
+        artboardClone->m_IsInstance = true;
+        artboardClone->m_originalWidth = m_originalWidth;
+        artboardClone->m_originalHeight = m_originalHeight;
+        cloneObjectDataBinds(this, artboardClone.get(), artboardClone.get());
+
+        std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
+        cloneObjects.reserve(m_Objects.size());
+        cloneObjects.push_back(artboardClone.get());
+
+        if (!m_Objects.empty())
+        {
+            if (useArena)
+            {
+                artboardClone->m_objectArena = std::unique_ptr<CoreArena>(
+                    new CoreArena(m_instanceArenaSize.load(
+                        std::memory_order_relaxed)));
+            }
+            CoreArena* arena = artboardClone->m_objectArena.get();
+
+            // Skip first object (artboard).
+            auto itr = m_Objects.begin();
+            while (++itr != m_Objects.end())
+            {
+                auto object = *itr;
+                Core* clone = nullptr;
+                if (object != nullptr)
+                {
+                    // Only the object itself goes in the arena, anything its
+                    // clone makes in turn is owned (and deleted) by it.
+                    CoreArena::Scope arenaScope(arena);
+                    clone = object->clone();
+                }
+                cloneObjects.push_back(clone);
+                // For each object, clone its data bind objects and target their
+                // clones
+                cloneObjectDataBinds(object,
+                                     cloneObjects.back(),
+                                     artboardClone.get());
+            }
+
+            if (useArena)
+            {
+                m_instanceArenaSize.store(
+                    artboardClone->m_objectArena->bytesUsed(),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        for (auto animation : m_Animations)
+        {
+            artboardClone->m_Animations.push_back(animation);
+        }
+        for (auto stateMachine : m_StateMachines)
+        {
+            artboardClone->m_StateMachines.push_back(stateMachine);
+        }
+
+        if (artboardClone->initialize() != StatusCode::Ok)
+        {
+            artboardClone = nullptr;
+        }
+
+        assert(artboardClone->isInstance());
+        return artboardClone;
+    }
+
     // Variable that tracks whenever the draw order changes. It is used by the
     // state machine controllers to sort their hittable components when they are
     // out of sync
@@ -94,7 +181,41 @@ private:
     rcp<AudioEngine> m_audioEngine;
 #endif
 
+    // Groups of components that only depend on each other (and the artboard)
+    // and are all safe to update off the calling thread. Each island keeps
+    // its components in dependency order.
+    std::vector<std::vector<Component*>> m_UpdateIslands;
+    ComponentUpdateScheduler* m_UpdateScheduler = nullptr;
+    // Set on the calling thread while islands are updated through the
+    // scheduler, so dirt raised from an island for a component outside of it
+    // is deferred until they all completed.
+    bool m_UpdatingIslands = false;
+    struct DeferredIslandDirt
+    {
+        Component* component;
+        ComponentDirt value;
+        bool recurse;
+    };
+    // One list per island, only written by the thread updating it.
+    std::vector<std::vector<DeferredIslandDirt>> m_DeferredIslandDirt;
+    // Text components, shaped through the scheduler ahead of the update
+    // pass when more than one of them needs shaping.
+    std::vector<Text*> m_TextComponents;
+    TextRenderMode m_TextRenderMode = TextRenderMode::useDefault;
+    void markTextRenderModeDirty();
+
+    // Plain nodes swept in bulk at the start of every update pass, only
+    // populated while flattenTransforms is set.
+    TransformArrays m_TransformArrays;
+    bool m_FlattenTransforms = false;
+
     void sortDependencies();
+    void buildUpdateIslands();
+    void updateIsland(size_t index);
+    static bool deferIslandDirt(Component* component,
+                                ComponentDirt value,
+                                bool recurse);
+    void prepareTextShapes(ComponentUpdateScheduler* scheduler);
     void sortDrawOrder();
     void updateDataBinds();
     void updateRenderPath() override;
@@ -142,6 +263,49 @@ public:
     /// Update components that depend on each other in DAG order.
     bool updateComponents();
 
+    /// When set, independent islands of transform/path components are
+    /// updated through the scheduler while the rest of the dependency order
+    /// is updated serially on the calling thread. The result matches the
+    /// fully serial update. Text components that need shaping are also
+    /// shaped through the scheduler before the update pass (which means
+    /// Font::gFallbackProc must be safe to call from any thread). Nested
+    /// artboards without their own scheduler use their host's. Pass nullptr
+    /// to go back to serial updates.
+    void updateScheduler(ComponentUpdateScheduler* scheduler)
+    {
+        m_UpdateScheduler = scheduler;
+    }
+    ComponentUpdateScheduler* updateScheduler() const
+    {
+        return m_UpdateScheduler;
+    }
+
+    /// The scheduler updates of this artboard run through, nullptr when
+    /// neither it nor any artboard hosting it has one.
+    ComponentUpdateScheduler* effectiveUpdateScheduler() const;
+
+    /// Selects how the Text in this artboard draws its glyphs. useDefault
+    /// follows the hosting artboard (for nested artboards), and then
+    /// gDefaultTextRenderMode.
+    void textRenderMode(TextRenderMode mode);
+    TextRenderMode textRenderMode() const { return m_TextRenderMode; }
+
+    /// The mode Text in this artboard draws with, never useDefault.
+    TextRenderMode effectiveTextRenderMode() const;
+
+    /// Mode used by artboards left at TextRenderMode::useDefault. Changing
+    /// it only affects Text that is built after the change.
+    static TextRenderMode gDefaultTextRenderMode;
+
+    /// When set, the transforms of plain nodes (no constraints, parented to
+    /// the artboard or to other plain nodes) are copied into structure of
+    /// arrays form and recomputed in one sweep per update pass instead of
+    /// one Node::update at a time. Meant for artboards with thousands of
+    /// nodes, the results match the regular update.
+    void flattenTransforms(bool value);
+    bool flattenTransforms() const { return m_FlattenTransforms; }
+    TransformArrays& transformArrays() { return m_TransformArrays; }
+
     // Update layouts and components. Returns true if it updated something.
     bool updatePass(bool isRoot);
 
@@ -186,12 +350,15 @@ public:
 #endif
 
     const std::vector<Core*>& objects() const { return m_Objects; }
-    const std::vector<NestedArtboard*> nestedArtboards() const
+    const std::vector<NestedArtboard*>& nestedArtboards() const
     {
         return m_NestedArtboards;
     }
     const std::vector<DataBind*> dataBinds() const { return m_DataBinds; }
-    const std::vector<DataBind*> allDataBinds() const { return m_AllDataBinds; }
+    const std::vector<DataBind*>& allDataBinds() const
+    {
+        return m_AllDataBinds;
+    }
     DataContext* dataContext() { return m_DataContext; }
     NestedArtboard* nestedArtboard(const std::string& name) const;
     NestedArtboard* nestedArtboardAtPath(const std::string& path) const;
@@ -302,55 +469,23 @@ public:
     /// Make an instance of this artboard.
     template <typename T = ArtboardInstance> std::unique_ptr<T> instance() const
     {
-        std::unique_ptr<T> artboardClone(new T);
-        artboardClone->copy(*this);
-
-        artboardClone->m_Factory = m_Factory;
-        artboardClone->m_FrameOrigin = m_FrameOrigin;
-        artboardClone->m_DataContext = m_DataContext;
-        artboardClone->m_IsInstance = true;
-        artboardClone->m_originalWidth = m_originalWidth;
-        artboardClone->m_originalHeight = m_originalHeight;
-        cloneObjectDataBinds(this, artboardClone.get(), artboardClone.get());
-
-        std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
-        cloneObjects.push_back(artboardClone.get());
-
-        if (!m_Objects.empty())
-        {
-            // Skip first object (artboard).
-            auto itr = m_Objects.begin();
-            while (++itr != m_Objects.end())
-            {
-                auto object = *itr;
-                cloneObjects.push_back(object == nullptr ? nullptr
-                                                         : object->clone());
-                // For each object, clone its data bind objects and target their
-                // clones
-                cloneObjectDataBinds(object,
-                                     cloneObjects.back(),
-                                     artboardClone.get());
-            }
-        }
-
-        for (auto animation : m_Animations)
-        {
-            artboardClone->m_Animations.push_back(animation);
-        }
-        for (auto stateMachine : m_StateMachines)
-        {
-            artboardClone->m_StateMachines.push_back(stateMachine);
-        }
-
-        if (artboardClone->initialize() != StatusCode::Ok)
-        {
-            artboardClone = nullptr;
-        }
+        return cloneInstance<T>(false);
+    }
 
-        assert(artboardClone->isInstance());
-        return artboardClone;
+    /// Make an instance of this artboard with all of its cloned objects
+    /// placed in a single CoreArena owned by the instance. The arena is sized
+    /// from what the previous arena instance of this artboard needed, so
+    /// repeated instancing takes one allocation for the whole object graph
+    /// and releases it at once when the instance is destroyed.
+    template <typename T = ArtboardInstance>
+    std::unique_ptr<T> arenaInstance() const
+    {
+        return cloneInstance<T>(true);
     }
 
+    /// Returns true if the cloned objects of this instance live in an arena.
+    bool usesObjectArena() const { return m_objectArena != nullptr; }
+
     /// Returns true if the artboard is an instance of another
     bool isInstance() const { return m_IsInstance; }
 
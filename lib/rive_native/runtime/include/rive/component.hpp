@@ -15,11 +15,17 @@ class Artboard;
 class Component : public ComponentBase
 {
     friend class Artboard;
+    friend class DependencySorter;
+    friend class TransformArrays;
 
 private:
     ContainerComponent* m_Parent = nullptr;
 
     unsigned int m_GraphOrder;
+    // 1 based index into the artboard's update islands, 0 when this
+    // component is always updated serially.
+    unsigned int m_UpdateIsland = 0;
+    uint32_t m_SortMark = 0;
     Artboard* m_Artboard = nullptr;
 
 protected:
@@ -0,0 +1,24 @@
+#ifndef _RIVE_COMPONENT_UPDATE_SCHEDULER_HPP_
+#define _RIVE_COMPONENT_UPDATE_SCHEDULER_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace rive
+{
+/// Lets the host run independent groups of artboard components on its own
+/// thread pool during Artboard::updateComponents. See
+/// Artboard::updateScheduler.
+class ComponentUpdateScheduler
+{
+public:
+    virtual ~ComponentUpdateScheduler() {}
+
+    /// Call work(index) once for every index in [0, count), potentially
+    /// concurrently from any thread, and return once every call completed.
+    virtual void parallelFor(size_t count,
+                             const std::function<void(size_t)>& work) = 0;
+};
+} // namespace rive
+
+#endif
@@ -13,6 +13,7 @@
 
 namespace rive
 {
+class CoreArena;
 class CoreContext;
 class ImportStack;
 class Core
@@ -23,6 +24,13 @@ public:
     const uint32_t emptyId = -1;
     static const int invalidPropertyKey = 0;
     virtual ~Core() {}
+
+    static void* operator new(size_t size) { return ::operator new(size); }
+    static void operator delete(void* ptr) { ::operator delete(ptr); }
+    /// Allocates in arena, or on the heap when it's nullptr. Objects placed
+    /// in an arena are released with CoreArena::destroy.
+    static void* operator new(size_t size, CoreArena* arena);
+    static void operator delete(void* ptr, CoreArena* arena);
     virtual uint16_t coreType() const = 0;
     virtual bool isTypeOf(uint16_t typeKey) const = 0;
     virtual bool deserialize(uint16_t propertyKey, BinaryReader& reader) = 0;
@@ -0,0 +1,84 @@
+#ifndef _RIVE_CORE_ARENA_HPP_
+#define _RIVE_CORE_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+class Core;
+
+/// A bump allocator that backs the Core objects of an artboard instance.
+/// Allocation is opt-in per object: while a CoreArena::Scope is active on the
+/// current thread, the next Core cloned with clone() is placed in the arena.
+/// Objects in an arena must be released with destroy() (which only runs the
+/// destructor), the memory is released all at once when the arena is
+/// destroyed.
+class CoreArena
+{
+public:
+    static constexpr size_t kDefaultBlockSize = 16 * 1024;
+
+    /// The first block is sized to initialCapacity (or kDefaultBlockSize when
+    /// 0), subsequent blocks are only allocated if the first one overflows.
+    explicit CoreArena(size_t initialCapacity = 0);
+    ~CoreArena();
+
+    CoreArena(const CoreArena&) = delete;
+    CoreArena& operator=(const CoreArena&) = delete;
+
+    /// Returns size bytes aligned to alignof(std::max_align_t).
+    void* allocate(size_t size);
+
+    /// Total number of bytes handed out by allocate, including alignment
+    /// padding. Useful to size a future arena for the same set of objects.
+    size_t bytesUsed() const { return m_bytesUsed; }
+
+    /// Number of blocks backing this arena, 1 when it was sized correctly.
+    size_t blockCount() const { return m_blocks.size(); }
+
+    /// Returns true if ptr was allocated from this arena.
+    bool owns(const void* ptr) const;
+
+    /// Destroys object, deleting it unless it lives in arena. arena may be
+    /// nullptr.
+    static void destroy(CoreArena* arena, Core* object);
+
+    /// Returns the arena the next clone on this thread should be placed in
+    /// and clears it, so objects that clone makes in turn (and later clones)
+    /// go to the heap. Used by the generated clone() implementations.
+    static CoreArena* claimForClone();
+
+    /// Places the next Core cloned on this thread, within this scope, in
+    /// arena.
+    class Scope
+    {
+    public:
+        explicit Scope(CoreArena* arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CoreArena* m_previous;
+    };
+
+private:
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> memory;
+        size_t size;
+    };
+
+    void addBlock(size_t size);
+
+    std::vector<Block> m_blocks;
+    uint8_t* m_cursor = nullptr;
+    uint8_t* m_end = nullptr;
+    size_t m_bytesUsed = 0;
+};
+} // namespace rive
+#endif
@@ -8,6 +8,28 @@
 #include <unordered_map>
 namespace rive
 {
+class FormulaTokenValue;
+
+enum class FormulaOpcode : uint8_t
+{
+    pushConstant,
+    pushInput,
+    // A value token driven by a data bind, read at evaluation time.
+    pushToken,
+    operation,
+    function,
+};
+
+struct FormulaInstruction
+{
+    FormulaOpcode opcode;
+    // Number of stack values consumed by a function.
+    uint8_t argumentsCount;
+    // ArithmeticOperation or FunctionType.
+    int type;
+    float value;
+    FormulaTokenValue* token;
+};
 
 class DataConverterFormula : public DataConverterFormulaBase
 {
@@ -31,13 +53,23 @@ private:
     int getPrecedence(FormulaToken*);
     float getRandom(int);
     float applyOperation(float left, float right, int operationType);
-    float applyFunction(std::vector<float>& stack,
+    float applyFunction(const float* arguments,
                         int functionTypeIndex,
                         int totalArguments);
+    // Compiles m_outputQueue into m_program, folding constant subexpressions
+    // and resolving how many values every instruction consumes.
+    void compile();
+    float evaluate(float inputValue);
     std::vector<FormulaToken*> m_tokens;
     std::vector<FormulaToken*> m_outputQueue;
     std::vector<float> m_randoms;
     std::unordered_map<FormulaToken*, int> m_argumentsCount;
+    std::vector<FormulaInstruction> m_program;
+    // Sized to the program's maximum depth by compile.
+    std::vector<float> m_stack;
+    // Whether a well formed program leaves exactly one value on the stack,
+    // otherwise the input passes through unchanged.
+    bool m_hasResult = false;
     bool m_isInstance = false;
 };
 } // namespace rive
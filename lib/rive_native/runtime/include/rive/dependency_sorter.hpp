@@ -1,7 +1,7 @@
 #ifndef _RIVE_DEPENDENCYSORTER_HPP_
 #define _RIVE_DEPENDENCYSORTER_HPP_
 
-#include <unordered_set>
+#include <cstdint>
 #include <vector>
 
 namespace rive
@@ -10,14 +10,18 @@ class Component;
 class DependencySorter
 {
 private:
-    std::unordered_set<Component*> m_Perm;
-    std::unordered_set<Component*> m_Temp;
+    // Visit marks are stored on the components themselves and compared
+    // against these, so a new sort never has to clear the previous marks.
+    uint32_t m_TempMark;
+    uint32_t m_PermMark;
+
+    bool visit(Component* component, std::vector<Component*>& order);
 
 public:
+    DependencySorter();
     void sort(Component* root, std::vector<Component*>& order);
     void sort(std::vector<Component*> roots, std::vector<Component*>& order);
-    bool visit(Component* component, std::vector<Component*>& order);
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
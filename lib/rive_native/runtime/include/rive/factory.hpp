@@ -14,17 +14,20 @@
 
 #include <stdio.h>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace rive
 {
 
 class RawPath;
+class GlyphAtlas;
 
 class Factory
 {
 public:
-    Factory() {}
-    virtual ~Factory() {}
+    Factory();
+    virtual ~Factory();
 
     virtual rcp<RenderBuffer> makeRenderBuffer(RenderBufferType,
                                                RenderBufferFlags,
@@ -60,6 +63,15 @@ public:
 
     virtual rcp<RenderImage> decodeImage(Span<const uint8_t>) = 0;
 
+    // Makes an image from width * height premultiplied RGBA pixels. Returns
+    // null if this factory can't.
+    virtual rcp<RenderImage> makeImage(uint32_t width,
+                                       uint32_t height,
+                                       const uint8_t premulRGBA[])
+    {
+        return nullptr;
+    }
+
     rcp<Font> decodeFont(Span<const uint8_t>);
 
     rcp<AudioSource> decodeAudio(Span<const uint8_t>);
@@ -67,6 +79,20 @@ public:
     // Non-virtual helpers
 
     rcp<RenderPath> makeRenderPath(const AABB&);
+
+    // Glyph atlas shared by all text drawn in TextRenderMode::glyphAtlas with
+    // this factory. Null if the factory can't make images.
+    GlyphAtlas* glyphAtlas();
+
+protected:
+    // Drops the images the glyph atlas made with this factory. Factories whose
+    // images hold resources that can go away before the factory does (e.g. a
+    // GPU context) must call this first.
+    void releaseGlyphAtlasImages();
+
+private:
+    std::once_flag m_glyphAtlasOnce;
+    std::unique_ptr<GlyphAtlas> m_glyphAtlas;
 };
 
 } // namespace rive
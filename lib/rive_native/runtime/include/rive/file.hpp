@@ -12,6 +12,7 @@
 #include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
 #include "rive/viewmodel/viewmodel_instance_list_item.hpp"
 #include "rive/animation/keyframe_interpolator.hpp"
+#include <mutex>
 #include <vector>
 #include <set>
 #include <unordered_map>
@@ -26,6 +27,7 @@ class RuntimeHeader;
 class Factory;
 class ScrollPhysics;
 class ViewModelRuntime;
+class ImportStack;
 
 ///
 /// Tracks the success/failure result when importing a Rive file.
@@ -68,6 +70,24 @@ public:
                                         ImportResult* result = nullptr,
                                         FileAssetLoader* assetLoader = nullptr);
 
+    ///
+    /// Imports a Rive file from a binary buffer without copying it. Only the
+    /// backboard, assets, view models, enums and data converters are read
+    /// up front, artboards are indexed in a single pass and their objects
+    /// are only deserialized the first time they're requested via
+    /// artboard(), artboardAt(), artboardNamed() or artboardDefault().
+    /// @param data the raw data of the file, typically a memory-mapped
+    /// buffer. It must outlive the returned file.
+    /// @param result is an optional status result.
+    /// @param assetLoader is an optional helper to load assets which
+    /// cannot be found in-band.
+    /// @returns a pointer to the file, or null on failure.
+    static std::unique_ptr<File> importLazy(
+        Span<const uint8_t> data,
+        Factory*,
+        ImportResult* result = nullptr,
+        FileAssetLoader* assetLoader = nullptr);
+
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_backboard; }
 
@@ -92,6 +112,10 @@ public:
     /// index is out of range.
     Artboard* artboard(size_t index) const;
 
+    /// @returns true if the artboard's objects have been deserialized. This is
+    /// always the case for files that weren't imported with importLazy.
+    bool isArtboardLoaded(size_t index) const;
+
     /// @returns a view model instance of the view model with the specified
     /// name.
     rcp<ViewModelInstance> createViewModelInstance(std::string name) const;
@@ -154,6 +178,44 @@ public:
 
 private:
     ImportResult read(BinaryReader&, const RuntimeHeader&);
+    ImportResult readLazy(BinaryReader&, const RuntimeHeader&);
+    bool importObject(Core* object,
+                      ImportStack& importStack,
+                      Core*& lastBindableObject);
+
+    /// Deserializes the objects of an artboard indexed by readLazy, returns
+    /// false if they failed to import.
+    bool loadArtboard(Artboard* artboard) const;
+    bool loadLazyArtboard(size_t lazyIndex);
+
+    enum class LazyArtboardState : uint8_t
+    {
+        unloaded,
+        loading,
+        loaded,
+        failed
+    };
+
+    /// Byte ranges, relative to m_lazyData, of the objects that belong to an
+    /// artboard. Objects owned by the file (view models, converters, etc.)
+    /// can be interleaved with them, so an artboard may span multiple ranges.
+    struct LazyArtboard
+    {
+        /// Null when the artboard itself failed to import, we still keep an
+        /// entry so the indices match the ids nested artboards refer to.
+        Artboard* artboard = nullptr;
+        std::vector<std::pair<size_t, size_t>> ranges;
+        LazyArtboardState state = LazyArtboardState::unloaded;
+    };
+
+    /// The caller owned buffer a lazily imported file reads artboards from.
+    Span<const uint8_t> m_lazyData;
+    std::unique_ptr<RuntimeHeader> m_lazyHeader;
+    std::vector<LazyArtboard> m_lazyArtboards;
+    /// Serializes loading lazy artboards, which can be triggered from const
+    /// accessors on any thread. Recursive as loading an artboard loads the
+    /// sources of its nested artboards.
+    mutable std::recursive_mutex m_lazyMutex;
 
     /// The file's backboard. All Rive files have a single backboard
     /// where the artboards live.
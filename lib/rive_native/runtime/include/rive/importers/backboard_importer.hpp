@@ -38,6 +38,12 @@ public:
     void addMissingArtboard();
     void addNestedArtboard(NestedArtboard* artboard);
     void addFileAsset(FileAsset* asset);
+    /// Registers an asset that was already imported (and had its id made
+    /// unique) by another backboard importer of the same file.
+    void addImportedFileAsset(FileAsset* asset)
+    {
+        m_FileAssets.push_back(asset);
+    }
     void addFileAssetReferencer(FileAssetReferencer* referencer);
     void addDataConverterReferencer(DataBind* referencer);
     void addDataConverter(DataConverter* converter);
@@ -763,6 +763,7 @@ using uint4 = uvec<4>;
 using int8x8 = simd::gvec<int8_t, 8>;
 using int8x16 = simd::gvec<int8_t, 16>;
 using int8x32 = simd::gvec<int8_t, 32>;
+using int8x64 = simd::gvec<int8_t, 64>;
 
 using uint8x8 = simd::gvec<uint8_t, 8>;
 using uint8x16 = simd::gvec<uint8_t, 16>;
@@ -4,6 +4,9 @@
 #include "rive/factory.hpp"
 #include "rive/text_engine.hpp"
 
+#include <list>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 struct hb_font_t;
@@ -44,11 +47,27 @@ public:
     static float GetStyle(hb_font_t*, uint32_t);
     hb_font_t* font() const { return m_font; }
 
+    // Runs shaped with this font are cached, so a run is only reshaped when
+    // its text or style changes.
+    struct ShapeCacheStats
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t entryCount = 0;
+    };
+    ShapeCacheStats shapeCacheStats() const;
+
+    // Maximum number of glyphs kept in each font's shape cache. 0 disables
+    // the cache.
+    static size_t gShapeCacheGlyphBudget;
+
 private:
     HBFont(hb_font_t* font,
            std::unordered_map<uint32_t, float> axisValues,
            std::unordered_map<uint32_t, uint32_t> featureValues,
-           std::vector<hb_feature_t> features);
+           std::vector<hb_feature_t> features,
+           rive::rcp<rive::GlyphPathCache> glyphPathCache,
+           uint64_t variationKey);
 
 public:
     hb_font_t* m_font;
@@ -63,6 +82,12 @@ public:
     // The features list to pass directly to Harfbuzz.
     std::vector<hb_feature_t> m_features;
 
+    // Returns the run shaped from text[0..textRun.unicharCount), from the
+    // shape cache when possible. textIndices are offset by textOffset.
+    rive::GlyphRun shapeRun(const rive::Unichar text[],
+                            const rive::TextRun& textRun,
+                            unsigned textOffset) const;
+
 private:
     hb_draw_funcs_t* m_drawFuncs;
 
@@ -71,6 +96,26 @@ private:
 
     // Axis value lookup based on for the feature.
     std::unordered_map<uint32_t, float> m_axisValues;
+
+    // Shaped runs, most recently used first. The runs don't reference this
+    // font (to avoid a cycle) and their textIndices start at 0.
+    struct ShapedRun
+    {
+        uint64_t hash;
+        std::vector<rive::Unichar> text;
+        float size;
+        float letterSpacing;
+        uint32_t script;
+        uint8_t level;
+        rive::GlyphRun glyphRun;
+    };
+    mutable std::mutex m_shapeCacheMutex;
+    mutable std::list<ShapedRun> m_shapedRuns;
+    mutable std::unordered_map<uint64_t, std::list<ShapedRun>::iterator>
+        m_shapedRunLookup;
+    mutable size_t m_shapedGlyphCount = 0;
+    mutable size_t m_shapeCacheHitCount = 0;
+    mutable size_t m_shapeCacheMissCount = 0;
 };
 
 #endif
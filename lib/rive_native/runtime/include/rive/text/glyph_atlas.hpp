@@ -0,0 +1,142 @@
+#ifndef _RIVE_TEXT_GLYPH_ATLAS_HPP_
+#define _RIVE_TEXT_GLYPH_ATLAS_HPP_
+
+#include "rive/math/aabb.hpp"
+#include "rive/refcnt.hpp"
+#include "rive/shapes/paint/color.hpp"
+#include "rive/text/glyph_path_cache.hpp"
+#include <stdint.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+class Factory;
+class RenderImage;
+
+/// Coverage atlas for TextRenderMode::glyphAtlas. Glyph outlines are
+/// rasterized on the CPU, once per pixel size, and packed into a single
+/// coverage page. Renderers can't tint images, so the page is uploaded as a
+/// separate premultiplied image for each fill color it is drawn with, for at
+/// most kMaxColoredImages colors at a time. When the page fills up it is
+/// cleared and the generation bumps, which tells users to look their glyphs
+/// up again. Safe to use from multiple threads.
+class GlyphAtlas
+{
+public:
+    static constexpr uint32_t kPageSize = 1024;
+
+    /// Colored copies of the page kept at once. The least recently used one
+    /// is dropped to make room for a new color.
+    static constexpr size_t kMaxColoredImages = 4;
+
+    /// Glyphs whose em square is larger than this many pixels are drawn as
+    /// paths instead.
+    static float gMaxPixelSize;
+
+    /// Pixels per artboard unit used to pick the size glyphs are rasterized
+    /// at. Raise it for high density displays.
+    static float gPixelScale;
+
+    /// Where a glyph was rasterized. bounds is relative to the glyph's origin
+    /// in em units, uvs are the matching corners in the page.
+    struct Glyph
+    {
+        AABB bounds;
+        AABB uvs;
+    };
+
+    explicit GlyphAtlas(Factory* factory) : m_factory(factory) {}
+
+    /// Finds the glyph's rasterization at emPixelSize (rounded to a whole
+    /// number of pixels), rasterizing it if needed. Returns false when the
+    /// glyph is empty or doesn't fit.
+    bool find(const rcp<GlyphPath>& glyphPath, float emPixelSize, Glyph* out);
+
+    /// Bumped every time the page is cleared to make room.
+    uint32_t generation() const;
+
+    /// The page, colored with the RGB of color, for drawImageMesh. (The
+    /// color's alpha is left for the draw's opacity.) Uploads the page again
+    /// if glyphs were added since the last call for this color.
+    rcp<RenderImage> image(ColorInt color);
+
+    /// Drops the colored images, e.g. before the factory's GPU resources go
+    /// away. They are uploaded again on demand.
+    void releaseImages();
+
+private:
+    struct Key
+    {
+        const GlyphPath* glyphPath;
+        uint32_t pixelSize;
+
+        bool operator==(const Key& other) const
+        {
+            return glyphPath == other.glyphPath &&
+                   pixelSize == other.pixelSize;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return reinterpret_cast<size_t>(key.glyphPath) * 31 +
+                   key.pixelSize;
+        }
+    };
+
+    struct Entry
+    {
+        // Keeps the outline alive so its address can't be reused by another
+        // glyph while it's a key.
+        rcp<GlyphPath> glyphPath;
+        bool empty;
+        Glyph glyph;
+    };
+
+    struct ColoredImage
+    {
+        rcp<RenderImage> image;
+        uint32_t version;
+        uint64_t lastUse;
+    };
+
+    // Must be called with m_mutex held.
+    bool allocate(uint32_t width, uint32_t height, uint32_t* x, uint32_t* y);
+    void clear();
+    void tintPixels(ColorInt color);
+
+    Factory* const m_factory;
+    mutable std::mutex m_mutex;
+    uint32_t m_generation = 0;
+    // Bumped whenever the coverage changes.
+    uint32_t m_version = 0;
+    std::vector<uint8_t> m_coverage;
+    // m_version when each row of the page last changed.
+    std::vector<uint32_t> m_rowVersions;
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+    std::unordered_map<ColorInt, ColoredImage> m_images;
+    uint64_t m_imageUseCount = 0;
+
+    // The page tinted with m_pixelsColor as of m_pixelsVersion. Rows past
+    // m_pixelsRowCount are transparent. Only the rows that changed since are
+    // tinted again when the same color is requested next.
+    std::vector<uint8_t> m_pixels;
+    ColorInt m_pixelsColor = 0;
+    uint32_t m_pixelsVersion = 0;
+    uint32_t m_pixelsRowCount = 0;
+
+    // Shelf packer.
+    uint32_t m_shelfX = 0;
+    uint32_t m_shelfY = 0;
+    uint32_t m_shelfHeight = 0;
+
+    // Rasterizer scratch.
+    std::vector<float> m_accumulation;
+};
+} // namespace rive
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef _RIVE_TEXT_GLYPH_PATH_CACHE_HPP_
+#define _RIVE_TEXT_GLYPH_PATH_CACHE_HPP_
+
+#include "rive/math/raw_path.hpp"
+#include "rive/refcnt.hpp"
+#include <stdint.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace rive
+{
+using GlyphID = uint16_t;
+
+/// An immutable, 1-point glyph outline. Copied out of the path the font
+/// extracted, so its storage is exactly sized.
+class GlyphPath : public RefCnt<GlyphPath>
+{
+public:
+    explicit GlyphPath(const RawPath& rawPath) : m_rawPath(rawPath) {}
+
+    const RawPath& rawPath() const { return m_rawPath; }
+
+    /// Memory held by this outline, for the cache's byte budget.
+    size_t byteSize() const;
+
+private:
+    const RawPath m_rawPath;
+};
+
+/// Glyph outlines shared by every variation of a font. Entries are keyed by
+/// glyph ID and a hash of the variation axis values the outline was extracted
+/// at. Once the outlines exceed the byte budget, the least recently used ones
+/// are evicted. Safe to use from multiple threads.
+class GlyphPathCache : public RefCnt<GlyphPathCache>
+{
+public:
+    struct Stats
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t evictionCount = 0;
+        size_t entryCount = 0;
+        size_t byteCount = 0;
+    };
+
+    explicit GlyphPathCache(size_t byteBudget) : m_byteBudget(byteBudget) {}
+
+    /// Returns the cached outline, or null if it isn't cached.
+    rcp<GlyphPath> find(uint64_t variationKey, GlyphID);
+
+    /// Caches a copy of rawPath and returns it. Evicts outlines as needed to
+    /// stay within the byte budget. (When the budget is 0, nothing is cached
+    /// but the copy is still returned.)
+    rcp<GlyphPath> insert(uint64_t variationKey, GlyphID, const RawPath&);
+
+    void setByteBudget(size_t byteBudget);
+    size_t byteBudget() const { return m_byteBudget; }
+
+    void clear();
+
+    Stats stats() const;
+
+private:
+    struct Key
+    {
+        uint64_t variationKey;
+        GlyphID glyphId;
+
+        bool operator==(const Key& other) const
+        {
+            return variationKey == other.variationKey &&
+                   glyphId == other.glyphId;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return static_cast<size_t>(key.variationKey * 31 + key.glyphId);
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        rcp<GlyphPath> glyphPath;
+    };
+
+    // Must be called with m_mutex held.
+    void evictToBudget();
+
+    mutable std::mutex m_mutex;
+    size_t m_byteBudget;
+    size_t m_byteCount = 0;
+    size_t m_hitCount = 0;
+    size_t m_missCount = 0;
+    size_t m_evictionCount = 0;
+
+    // Most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_lookup;
+};
+} // namespace rive
+
+#endif
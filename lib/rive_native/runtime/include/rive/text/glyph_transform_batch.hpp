@@ -0,0 +1,58 @@
+#ifndef _RIVE_TEXT_GLYPH_TRANSFORM_BATCH_HPP_
+#define _RIVE_TEXT_GLYPH_TRANSFORM_BATCH_HPP_
+
+#include "rive/math/mat2d.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace rive
+{
+class TextModifierGroup;
+
+/// Structure of arrays copy of the per glyph state Text::buildRenderStyles
+/// needs to apply its modifier groups. Glyphs are collected first, then every
+/// group is applied to all of them four glyphs at a time, leaving the final
+/// transform and opacity of each glyph ready to add its path with.
+class GlyphTransformBatch
+{
+public:
+    void clear() { m_size = 0; }
+
+    /// Adds a glyph whose font sized outline is transformed by
+    /// glyphTransform (relative to the glyph's center) and then translated by
+    /// translation. textIndex and codePointCount locate the glyph's modifier
+    /// coverage.
+    void add(const Mat2D& glyphTransform,
+             Vec2D translation,
+             float opacity,
+             uint32_t textIndex,
+             uint32_t codePointCount);
+
+    size_t size() const { return m_size; }
+
+    /// Same result as calling TextModifierGroup::transform and
+    /// TextModifierGroup::computeOpacity on every glyph with its coverage.
+    /// Groups with follow path modifiers need per glyph line information and
+    /// aren't supported.
+    void applyModifierGroup(const TextModifierGroup& group);
+
+    Mat2D transform(size_t index) const;
+    float opacity(size_t index) const { return m_opacity[index]; }
+
+private:
+    // Every array is padded so full groups of four can be loaded from any
+    // multiple of four. Padding lanes aren't cleared and may hold stale
+    // glyphs.
+    size_t m_size = 0;
+    std::vector<float> m_matrix[6];
+    std::vector<float> m_translateX;
+    std::vector<float> m_translateY;
+    std::vector<float> m_opacity;
+    std::vector<float> m_coverage;
+    std::vector<uint32_t> m_textIndex;
+    std::vector<uint32_t> m_codePointCount;
+};
+} // namespace rive
+
+#endif
@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <vector>
 #include "rive/text/glyph_lookup.hpp"
+#include "rive/text/glyph_transform_batch.hpp"
 namespace rive
 {
 
@@ -208,6 +209,14 @@ public:
     void markPaintDirty();
     void update(ComponentDirt value) override;
     void onDirty(ComponentDirt value) override;
+
+    /// Shapes the current text ahead of update so that independent Text
+    /// components can shape concurrently. Only touches this Text's own
+    /// state. The next update uses the result if the styled text still
+    /// matches, and shapes again otherwise. Texts with modifier groups
+    /// shape during update, as their shape depends on the modifiers'
+    /// coverage.
+    void prepareShape();
     Mat2D m_transform;
     Mat2D m_shapeWorldTransform;
 
@@ -252,13 +261,19 @@ public:
         const SimpleArray<Paragraph>& paragraphs,
         float width,
         TextAlign align,
-        TextWrap wrap);
+        TextWrap wrap,
+        const SimpleArray<Paragraph>* previousParagraphs = nullptr,
+        SimpleArray<SimpleArray<GlyphLine>>* previousLines = nullptr);
 #endif
 
 #ifdef WITH_RIVE_LAYOUT
     void markLayoutNodeDirty();
 #endif
 
+    // Adds every style's atlas glyphs as paths instead, for when the atlas
+    // can't hold them this frame.
+    void addAtlasGlyphsAsPaths();
+
     bool haveModifiers() const
     {
 #ifdef WITH_RIVE_TEXT
@@ -281,6 +296,7 @@ public:
     {
         return m_styledText.unichars();
     }
+    bool hasPreparedShape() const { return m_hasPreparedShape; }
 #endif
 
 protected:
@@ -302,6 +318,28 @@ private:
     SimpleArray<Paragraph> m_modifierShape;
     SimpleArray<SimpleArray<GlyphLine>> m_lines;
     SimpleArray<SimpleArray<GlyphLine>> m_modifierLines;
+    // Constraints m_lines were broken to, so unchanged paragraphs can keep
+    // their lines when the text is reshaped.
+    float m_lineBreakWidth = NAN;
+    TextWrap m_lineBreakWrap = TextWrap::wrap;
+    // Glyphs laid out by buildRenderStyles, kept around to reuse their
+    // storage.
+    GlyphTransformBatch m_glyphTransforms;
+    std::vector<rcp<GlyphPath>> m_glyphPaths;
+    std::vector<TextStyle*> m_glyphStyles;
+    // Pixels per glyph transform unit the styles' atlas glyphs were sized
+    // for, 0 when they were added as paths.
+    float m_glyphAtlasPixelScale = 0.0f;
+    // Largest glyph scale when the glyphs were added as paths only for being
+    // too large for the atlas, 0 otherwise.
+    float m_glyphAtlasMaxGlyphScale = 0.0f;
+    // Pixels per glyph transform unit at the current world transform.
+    float glyphAtlasPixelScale() const;
+    bool glyphAtlasScaleChanged() const;
+    // Result of prepareShape, consumed by the next update.
+    StyledText m_preparedStyledText;
+    SimpleArray<Paragraph> m_preparedShape;
+    bool m_hasPreparedShape = false;
     // Runs ordered by paragraph line.
     std::vector<OrderedLine> m_orderedLines;
     GlyphRun m_ellipsisRun;
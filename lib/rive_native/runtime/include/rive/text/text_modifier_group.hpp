@@ -57,8 +57,8 @@ public:
     void computeCoverage(uint32_t textSize);
     Text* textComponent() const;
     void resetTextFollowPath();
-    float glyphCoverage(uint32_t textIndex, uint32_t codePointCount);
-    float coverage(uint32_t textIndex)
+    float glyphCoverage(uint32_t textIndex, uint32_t codePointCount) const;
+    float coverage(uint32_t textIndex) const
     {
         assert(textIndex < m_coverage.size());
         return m_coverage[textIndex];
@@ -106,6 +106,14 @@ public:
                0;
     }
 
+    bool invertsOpacity() const
+    {
+        return (modifierFlags() &
+                (uint32_t)TextModifierFlags::invertOpacity) != 0;
+    }
+
+    bool followsPath() const { return !m_followPathModifiers.empty(); }
+
     float computeOpacity(float current, float t) const;
     bool needsShape() const;
     void onTextWorldTransformDirty();
@@ -113,6 +121,10 @@ public:
 #ifdef TESTING
     const std::vector<TextModifierRange*>& ranges() const { return m_ranges; }
     const std::vector<TextModifier*>& modifiers() const { return m_modifiers; }
+    void coverage(std::vector<float> coverage)
+    {
+        m_coverage = std::move(coverage);
+    }
 #endif
 
 protected:
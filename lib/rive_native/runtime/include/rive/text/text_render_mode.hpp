@@ -0,0 +1,26 @@
+#ifndef _RIVE_TEXT_RENDER_MODE_HPP_
+#define _RIVE_TEXT_RENDER_MODE_HPP_
+
+#include <cstdint>
+
+namespace rive
+{
+
+/// How Text components draw their glyphs. See Artboard::textRenderMode.
+enum class TextRenderMode : uint8_t
+{
+    /// Use the hosting artboard's mode, or Artboard::gDefaultTextRenderMode
+    /// for top level artboards.
+    useDefault,
+
+    /// Draw glyphs as paths.
+    vector,
+
+    /// Draw glyphs as textured quads from the factory's GlyphAtlas. Text that
+    /// the atlas can't represent (large, rotated or skewed glyphs, paints
+    /// other than a single solid fill, follow path modifiers) is still drawn
+    /// as paths.
+    glyphAtlas,
+};
+} // namespace rive
+#endif
@@ -6,6 +6,7 @@
 #include "rive/assets/file_asset_referencer.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/font_asset.hpp"
+#include "rive/text/glyph_path_cache.hpp"
 #include <unordered_map>
 
 namespace rive
@@ -17,6 +18,8 @@ class Renderer;
 class RenderPath;
 class RenderPaint;
 
+class Factory;
+class GlyphAtlas;
 class TextVariationHelper;
 class TextStyleAxis;
 class TextStyleFeature;
@@ -37,8 +40,27 @@ public:
 
     FontAsset* fontAsset() const { return (FontAsset*)m_fileAsset; }
 
-    bool addPath(const RawPath& rawPath, float opacity);
+    bool addPath(const RawPath& rawPath,
+                 float opacity,
+                 const Mat2D* transform = nullptr);
     void rewindPath();
+
+    /// Whether this style's paint can be drawn from a GlyphAtlas: a single
+    /// solid fill without feathering.
+    bool canDrawFromAtlas() const;
+
+    /// Draws the glyph from the atlas instead of adding its path. transform
+    /// maps the outline to the text, emPixelSize is the size of the glyph's
+    /// em square on screen. Returns true if this was the first glyph or path
+    /// added since the last rewind, like addPath.
+    bool addAtlasGlyph(const rcp<GlyphPath>& glyphPath,
+                       float emPixelSize,
+                       const Mat2D& transform,
+                       float opacity);
+
+    /// Adds the paths of the glyphs added with addAtlasGlyph since the last
+    /// rewind, and draws them as paths from then on.
+    void addAtlasGlyphsAsPaths();
     void draw(Renderer* renderer, const Mat2D& worldTransform);
     Core* clone() const override;
     void addVariation(TextStyleAxis* axis);
@@ -57,6 +79,37 @@ protected:
     void letterSpacingChanged() override;
 
 private:
+    struct AtlasGlyph
+    {
+        rcp<GlyphPath> glyphPath;
+        float emPixelSize;
+        Mat2D transform;
+        float opacity;
+    };
+
+    // Quads for the atlas glyphs sharing an opacity, split to fit 16 bit
+    // indices.
+    struct AtlasMesh
+    {
+        float opacity;
+        uint32_t quadCount;
+        uint32_t quadCapacity;
+        rcp<RenderBuffer> vertices;
+        rcp<RenderBuffer> uvs;
+        rcp<RenderBuffer> indices;
+    };
+
+    /// Returns false if the glyphs couldn't all be found in the same
+    /// generation of the atlas page.
+    bool buildAtlasMeshes(Factory* factory, GlyphAtlas* atlas);
+    void drawFromAtlas(Renderer* renderer, const Mat2D& worldTransform);
+
+    std::vector<AtlasGlyph> m_atlasGlyphs;
+    std::vector<AtlasMesh> m_atlasMeshes;
+    size_t m_atlasMeshCount = 0;
+    bool m_atlasMeshesDirty = false;
+    uint32_t m_atlasGeneration = 0;
+
     std::unique_ptr<TextVariationHelper> m_variationHelper;
     std::unordered_map<float, ShapePaintPath> m_opacityPaths;
     rcp<Font> m_variableFont;
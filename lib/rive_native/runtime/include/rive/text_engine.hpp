@@ -9,6 +9,7 @@
 #include "rive/refcnt.hpp"
 #include "rive/span.hpp"
 #include "rive/simple_array.hpp"
+#include "rive/text/glyph_path_cache.hpp"
 
 namespace rive
 {
@@ -198,6 +199,28 @@ public:
     //
     virtual RawPath getPath(GlyphID) const = 0;
 
+    // Returns the same path as getPath(), from a cache shared by every
+    // variation of this font. The path is immutable; transform it while adding
+    // it to its destination instead of copying it.
+    rcp<GlyphPath> glyphPath(GlyphID) const;
+
+    // Hit rate and memory use of the glyph path cache shared by this font and
+    // its variations.
+    GlyphPathCache::Stats glyphPathCacheStats() const
+    {
+        return m_glyphPathCache->stats();
+    }
+
+    // Maximum bytes of glyph paths cached for this font and its variations.
+    // 0 disables the cache.
+    void setGlyphPathCacheByteBudget(size_t byteBudget)
+    {
+        m_glyphPathCache->setByteBudget(byteBudget);
+    }
+
+    // Byte budget for the glyph path caches of newly decoded fonts.
+    static size_t gGlyphPathCacheByteBudget;
+
     SimpleArray<Paragraph> shapeText(Span<const Unichar> text,
                                      Span<const TextRun> runs,
                                      int textDirectionFlag = -1) const;
@@ -215,7 +238,25 @@ public:
     static constexpr unsigned kRegularWeight = 400;
 
 protected:
-    Font(const LineMetrics& lm) : m_lineMetrics(lm) {}
+    Font(const LineMetrics& lm) :
+        Font(lm, make_rcp<GlyphPathCache>(gGlyphPathCacheByteBudget), 0)
+    {}
+
+    // For variations of a font: shares the base font's glyph path cache
+    // instead of allocating one. variationKey identifies the variation axis
+    // values this font's paths are extracted at.
+    Font(const LineMetrics& lm,
+         rcp<GlyphPathCache> glyphPathCache,
+         uint64_t variationKey) :
+        m_lineMetrics(lm),
+        m_glyphPathCache(std::move(glyphPathCache)),
+        m_variationKey(variationKey)
+    {}
+
+    const rcp<GlyphPathCache>& glyphPathCache() const
+    {
+        return m_glyphPathCache;
+    }
 
     virtual SimpleArray<Paragraph> onShapeText(Span<const Unichar> text,
                                                Span<const TextRun> runs,
@@ -224,6 +265,9 @@ protected:
 private:
     /// The font specified line metrics (automatic line metrics).
     const LineMetrics m_lineMetrics;
+
+    const rcp<GlyphPathCache> m_glyphPathCache;
+    const uint64_t m_variationKey;
 };
 
 // A user defined styling guide for a set of unicode codepoints within a larger
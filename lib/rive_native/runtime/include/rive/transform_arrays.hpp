@@ -0,0 +1,68 @@
+#ifndef _RIVE_TRANSFORM_ARRAYS_HPP_
+#define _RIVE_TRANSFORM_ARRAYS_HPP_
+
+#include "rive/math/mat2d.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace rive
+{
+class Component;
+class Node;
+
+/// Structure of arrays copy of the plain Node hierarchy of an artboard. Nodes
+/// without constraints whose parent is the artboard or another flattened node
+/// are grouped by depth, which lets every level be swept four nodes at a time:
+/// first the local transforms from x/y/rotation/scale, then the world
+/// transforms from the parent's world transform. See
+/// Artboard::flattenTransforms.
+class TransformArrays
+{
+public:
+    /// Collects the nodes to flatten from an artboard's dependency order,
+    /// replacing any previously flattened set.
+    void build(const std::vector<Component*>& dependencyOrder);
+    /// Detaches the flattened nodes, they go back to updating themselves.
+    void clear();
+
+    bool empty() const { return m_nodes.size() <= 1; }
+
+    /// Number of flattened nodes.
+    size_t size() const { return empty() ? 0 : m_nodes.size() - 1; }
+
+    /// Recomputes every flattened node with Transform or WorldTransform dirt,
+    /// writes the results back to the nodes and clears that dirt so the
+    /// regular update loop only handles what's left (opacity, etc.).
+    /// rootWorld is the world transform of the artboard.
+    void update(const Mat2D& rootWorld);
+
+    /// Keeps the arrays in sync when a flattened node gets updated by the
+    /// regular update loop, i.e. when it was dirtied after the sweep ran.
+    void store(uint32_t index, const Mat2D& transform, const Mat2D& world);
+
+private:
+    void resize(size_t count);
+    void updateLocal();
+    void updateWorld(uint32_t begin, uint32_t end);
+
+    // Slot 0 is reserved for the artboard so that every flattened node has a
+    // parent index, the nodes follow sorted by depth. Every array is padded
+    // so full groups of four can be loaded from any index.
+    std::vector<Node*> m_nodes;
+    std::vector<uint32_t> m_parents;
+    std::vector<uint32_t> m_levelEnds;
+    std::vector<uint8_t> m_dirt;
+
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_rotation;
+    std::vector<float> m_scaleX;
+    std::vector<float> m_scaleY;
+
+    std::vector<float> m_local[6];
+    std::vector<float> m_world[6];
+};
+} // namespace rive
+
+#endif
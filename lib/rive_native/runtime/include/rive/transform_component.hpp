@@ -14,6 +14,12 @@ class AABB;
 class TransformComponent : public TransformComponentBase,
                            public IntrinsicallySizeable
 {
+    friend class TransformArrays;
+
+private:
+    // Index into the artboard's TransformArrays, 0 when not flattened.
+    uint32_t m_FlatTransformIndex = 0;
+
 protected:
     Mat2D m_Transform;
     float m_RenderOpacity = 0.0f;
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace rive
+{
+// Calls runFrame(frame) frameCount times and returns the median frame time, in
+// units of Period (e.g. std::micro), divided by itemCount. The median is less
+// sensitive to noise than the mean.
+//
+// When runFrame returns a std::chrono::duration, that is taken as the frame's
+// time, so a frame can leave out work it doesn't want timed. Otherwise the
+// whole call is timed.
+template <typename Period, typename Fn>
+double time_frames(int frameCount, size_t itemCount, Fn&& runFrame)
+{
+    std::vector<double> frameTimes;
+    frameTimes.reserve(frameCount);
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        std::chrono::duration<double, Period> elapsed;
+        if constexpr (std::is_void_v<decltype(runFrame(frame))>)
+        {
+            auto start = std::chrono::steady_clock::now();
+            runFrame(frame);
+            elapsed = std::chrono::steady_clock::now() - start;
+        }
+        else
+        {
+            elapsed = runFrame(frame);
+        }
+        frameTimes.push_back(elapsed.count());
+    }
+    std::nth_element(frameTimes.begin(),
+                     frameTimes.begin() + frameCount / 2,
+                     frameTimes.end());
+    return frameTimes[frameCount / 2] / itemCount;
+}
+} // namespace rive
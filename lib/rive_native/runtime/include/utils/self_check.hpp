@@ -0,0 +1,28 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include <cstdio>
+
+// Reporting for the self-checking test programs, which print every check and
+// exit with 1 if any of them failed.
+namespace rive
+{
+// Number of checks that failed so far.
+inline int g_checkFailureCount = 0;
+
+// Prints the check's name and whether it passed, and counts it if it didn't.
+inline void check(const char* name, bool passed)
+{
+    printf("%-40s %s\n", name, passed ? "ok" : "FAILED");
+    if (!passed)
+    {
+        g_checkFailureCount++;
+    }
+}
+
+// The exit status of a self-checking test: 1 if any check failed.
+inline int check_exit_status() { return g_checkFailureCount == 0 ? 0 : 1; }
+} // namespace rive
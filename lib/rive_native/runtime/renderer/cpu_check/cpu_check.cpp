@@ -0,0 +1,294 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Self-checking test for RenderContextCPUImpl. Renders small scenes headlessly
+// and checks known pixels, prints every check and exits with 1 if any of them
+// failed.
+//
+//   cpu_check
+//
+// "solid fill": pixels inside and outside an opaque rect.
+// "msaa": frames in an interlock mode the backend doesn't support are skipped
+//     and leave the target untouched.
+// "scheduled": a scene with strokes, gradients and overlapping blends renders
+//     byte-identically with and without a FlushTaskScheduler, from
+//     byte-identical tessellation span and contour buffers.
+
+#include "rive/renderer/cpu/render_context_cpu_impl.hpp"
+#include "rive/renderer/flush_task_scheduler.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/math/raw_path.hpp"
+#include "utils/self_check.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+static constexpr uint32_t kWidth = 128;
+static constexpr uint32_t kHeight = 96;
+
+// RenderTargetCPU pixels are premultiplied, little-endian RGBA8.
+static constexpr uint32_t kOpaqueRed = 0xff0000ff;
+static constexpr uint32_t kOpaqueBlue = 0xffff0000;
+
+// Splits every batch across a few std::threads.
+class ThreadScheduler : public FlushTaskScheduler
+{
+public:
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)>& work) override
+    {
+        constexpr size_t kThreadCount = 4;
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < kThreadCount; t++)
+        {
+            threads.emplace_back([&, t]() {
+                for (size_t i = t; i < count; i += kThreadCount)
+                {
+                    work(i);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+};
+
+static uint32_t pixel_at(RenderTargetCPU* target, uint32_t x, uint32_t y)
+{
+    return target->pixels()[y * target->width() + x];
+}
+
+static void begin_frame(RenderContext* context,
+                        ColorInt clearColor,
+                        int msaaSampleCount = 0)
+{
+    RenderContext::FrameDescriptor frameDescriptor;
+    frameDescriptor.renderTargetWidth = kWidth;
+    frameDescriptor.renderTargetHeight = kHeight;
+    frameDescriptor.loadAction = LoadAction::clear;
+    frameDescriptor.clearColor = clearColor;
+    frameDescriptor.msaaSampleCount = msaaSampleCount;
+    context->beginFrame(frameDescriptor);
+}
+
+static void fill_rect(RenderContext* context,
+                      Renderer* renderer,
+                      const AABB& rect,
+                      ColorInt color)
+{
+    RawPath rawPath;
+    rawPath.addRect(rect);
+    rcp<RenderPath> path = context->makeRenderPath(rawPath, FillRule::nonZero);
+    rcp<RenderPaint> paint = context->makeRenderPaint();
+    paint->color(color);
+    renderer->drawPath(path.get(), paint.get());
+}
+
+static void check_solid_fill(RenderContext* context, RenderTargetCPU* target)
+{
+    begin_frame(context, 0x00000000);
+    RiveRenderer renderer(context);
+    fill_rect(context, &renderer, {16, 16, 48, 40}, 0xffff0000);
+    context->flush({.renderTarget = target});
+
+    check("solid fill: inside", pixel_at(target, 30, 30) == kOpaqueRed);
+    check("solid fill: outside", pixel_at(target, 80, 60) == 0);
+    check("solid fill: corners",
+          pixel_at(target, 16, 16) == kOpaqueRed &&
+              pixel_at(target, 47, 39) == kOpaqueRed &&
+              pixel_at(target, 48, 40) == 0);
+}
+
+static void check_msaa_skipped(RenderContext* context, RenderTargetCPU* target)
+{
+    begin_frame(context, 0xff0000ff);
+    RiveRenderer renderer(context);
+    fill_rect(context, &renderer, {0, 0, kWidth, kHeight}, 0xff0000ff);
+    context->flush({.renderTarget = target});
+    check("msaa: setup", pixel_at(target, 80, 60) == kOpaqueBlue);
+
+    std::vector<uint32_t> before(target->pixels(),
+                                 target->pixels() + kWidth * kHeight);
+    begin_frame(context, 0xffff0000, 4);
+    fill_rect(context, &renderer, {16, 16, 48, 40}, 0xff00ff00);
+    context->flush({.renderTarget = target});
+    check("msaa: target untouched",
+          memcmp(before.data(),
+                 target->pixels(),
+                 before.size() * sizeof(uint32_t)) == 0);
+
+    // The next supported frame renders normally.
+    check_solid_fill(context, target);
+}
+
+static void draw_scene(RenderContext* context)
+{
+    begin_frame(context, 0xff202020);
+    RiveRenderer renderer(context);
+
+    const ColorInt colors[] = {0xffff0000, 0x8000ff00, 0xff0000ff};
+    const float stops[] = {0, .5f, 1};
+    RawPath oval;
+    oval.addOval({8, 8, 88, 72});
+    rcp<RenderPath> ovalPath = context->makeRenderPath(oval, FillRule::nonZero);
+    rcp<RenderPaint> gradient = context->makeRenderPaint();
+    gradient->shader(context->makeLinearGradient(8, 8, 88, 72, colors, stops, 3));
+    renderer.drawPath(ovalPath.get(), gradient.get());
+
+    RawPath curve;
+    curve.moveTo(10, 90);
+    curve.cubicTo(40, -20, 90, 120, 120, 10);
+    rcp<RenderPath> curvePath =
+        context->makeRenderPath(curve, FillRule::nonZero);
+    rcp<RenderPaint> stroke = context->makeRenderPaint();
+    stroke->style(RenderPaintStyle::stroke);
+    stroke->thickness(6);
+    stroke->join(StrokeJoin::round);
+    stroke->cap(StrokeCap::round);
+    stroke->color(0xc0ffffff);
+    renderer.drawPath(curvePath.get(), stroke.get());
+
+    RawPath star;
+    star.moveTo(100, 20);
+    star.lineTo(116, 80);
+    star.lineTo(70, 40);
+    star.lineTo(126, 40);
+    star.lineTo(80, 80);
+    star.close();
+    rcp<RenderPath> starPath = context->makeRenderPath(star, FillRule::evenOdd);
+    rcp<RenderPaint> multiply = context->makeRenderPaint();
+    multiply->color(0xffffff00);
+    multiply->blendMode(BlendMode::multiply);
+    renderer.drawPath(starPath.get(), multiply.get());
+
+    // Enough segments that the tessellation spans wrap rows of the
+    // tessellation texture. Lines never straddle a row, so the row breaks a
+    // worst case span count allows for don't all happen.
+    RawPath zigzag;
+    zigzag.moveTo(2, 2);
+    for (int i = 0; i < 3000; i++)
+    {
+        zigzag.lineTo(2 + (i % 124), i % 2 == 0 ? 94 : 2);
+    }
+    rcp<RenderPath> zigzagPath =
+        context->makeRenderPath(zigzag, FillRule::nonZero);
+    rcp<RenderPaint> hairline = context->makeRenderPaint();
+    hairline->style(RenderPaintStyle::stroke);
+    hairline->thickness(.5f);
+    hairline->color(0x40ff00ff);
+    renderer.drawPath(zigzagPath.get(), hairline.get());
+
+    RawPath waves;
+    for (int i = 0; i < 40; i++)
+    {
+        float y = 4 + i * 2.f;
+        waves.moveTo(4, y);
+        waves.cubicTo(30 + i, y - 30, 90 - i, y + 30, 124, y);
+    }
+    rcp<RenderPath> wavesPath =
+        context->makeRenderPath(waves, FillRule::nonZero);
+    rcp<RenderPaint> thinStroke = context->makeRenderPaint();
+    thinStroke->style(RenderPaintStyle::stroke);
+    thinStroke->thickness(1.5f);
+    thinStroke->join(StrokeJoin::miter);
+    thinStroke->cap(StrokeCap::square);
+    thinStroke->color(0x6000ffff);
+    for (int i = 0; i < 8; i++)
+    {
+        renderer.save();
+        renderer.translate(i * .5f, i * .25f);
+        renderer.drawPath(wavesPath.get(), thinStroke.get());
+        renderer.restore();
+    }
+}
+
+// Bytes of the buffers a context's last flush read. (The buffer structs are
+// write-only, so they can't be copied as structs.)
+struct FlushBuffers
+{
+    std::vector<uint8_t> tessSpans;
+    std::vector<uint8_t> contours;
+
+    template <typename T>
+    static void record(std::vector<uint8_t>* bytes, Span<const T> data)
+    {
+        bytes->resize(data.size_bytes());
+        if (!data.empty())
+        {
+            memcpy(bytes->data(), data.data(), data.size_bytes());
+        }
+    }
+
+    std::function<void(Span<const TessVertexSpan>, Span<const ContourData>)>
+    recorder()
+    {
+        return [this](Span<const TessVertexSpan> spans,
+                      Span<const ContourData> contourData) {
+            record(&tessSpans, spans);
+            record(&contours, contourData);
+        };
+    }
+};
+
+static void check_scheduled()
+{
+    FlushBuffers serialBuffers;
+    std::unique_ptr<RenderContext> serialContext =
+        RenderContextCPUImpl::MakeContext(
+            {.onFlushBuffers = serialBuffers.recorder()});
+    ThreadScheduler scheduler;
+    FlushBuffers scheduledBuffers;
+    std::unique_ptr<RenderContext> scheduledContext =
+        RenderContextCPUImpl::MakeContext(
+            {.taskScheduler = &scheduler,
+             .onFlushBuffers = scheduledBuffers.recorder()});
+    rcp<RenderTargetCPU> serialTarget =
+        make_rcp<RenderTargetCPU>(kWidth, kHeight);
+    rcp<RenderTargetCPU> scheduledTarget =
+        make_rcp<RenderTargetCPU>(kWidth, kHeight);
+
+    draw_scene(serialContext.get());
+    serialContext->flush({.renderTarget = serialTarget.get()});
+    draw_scene(scheduledContext.get());
+    scheduledContext->flush({.renderTarget = scheduledTarget.get()});
+
+    bool drewSomething = false;
+    for (uint32_t i = 0; i < kWidth * kHeight; i++)
+    {
+        drewSomething =
+            drewSomething || serialTarget->pixels()[i] != 0xff202020;
+    }
+    check("scheduled: scene drawn", drewSomething);
+    check("scheduled: matches serial",
+          memcmp(serialTarget->pixels(),
+                 scheduledTarget->pixels(),
+                 size_t(kWidth) * kHeight * sizeof(uint32_t)) == 0);
+    check("scheduled: tessellation spans match",
+          !serialBuffers.tessSpans.empty() &&
+              serialBuffers.tessSpans == scheduledBuffers.tessSpans);
+    check("scheduled: contours match",
+          !serialBuffers.contours.empty() &&
+              serialBuffers.contours == scheduledBuffers.contours);
+}
+
+int main()
+{
+    std::unique_ptr<RenderContext> context =
+        RenderContextCPUImpl::MakeContext({});
+    rcp<RenderTargetCPU> target = make_rcp<RenderTargetCPU>(kWidth, kHeight);
+
+    check_solid_fill(context.get(), target.get());
+    check_msaa_skipped(context.get(), target.get());
+    check_scheduled();
+    return check_exit_status();
+}
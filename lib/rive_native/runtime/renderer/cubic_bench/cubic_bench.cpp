@@ -0,0 +1,165 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for cubic easing. Builds many CubicInterpolatorSolvers, then
+// times solving a stream of x values through them one at a time with getT and
+// in batches with getTBatch, the way LinearAnimation::apply does, and reports
+// the median time per solve.
+//
+//   cubic_bench [-n frames] [--solvers count]
+//
+// "eases" are the usual ease, ease-in, ease-out and ease-in-out curves.
+// "random" has x1 and x2 anywhere in [0, 1]. "unsorted" has x1 and x2 outside
+// [0, 1], so the solvers' tables aren't sorted and getTBatch falls back to
+// getT.
+//
+// getTBatch only solves four at a time when built with clang. Elsewhere it
+// calls getT, so the two columns should match.
+
+#include "rive/animation/cubic_interpolator_solver.hpp"
+#include "utils/bench_timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace rive;
+
+enum class SolverSet
+{
+    eases,
+    random,
+    unsorted,
+};
+
+constexpr static SolverSet kSolverSets[] = {
+    SolverSet::eases,
+    SolverSet::random,
+    SolverSet::unsorted,
+};
+
+static const char* solver_set_name(SolverSet set)
+{
+    switch (set)
+    {
+        case SolverSet::eases:
+            return "eases";
+        case SolverSet::random:
+            return "random";
+        case SolverSet::unsorted:
+            return "unsorted";
+    }
+    return "";
+}
+
+static std::vector<CubicInterpolatorSolver> make_solvers(SolverSet set,
+                                                         int count)
+{
+    constexpr static float kEases[][2] = {
+        {.25f, .25f}, // ease
+        {.42f, 1.0f}, // ease-in
+        {0.0f, .58f}, // ease-out
+        {.42f, .58f}, // ease-in-out
+    };
+    std::mt19937 random(set == SolverSet::random ? 1 : 2);
+    std::uniform_real_distribution<float> unit(0, 1);
+    std::uniform_real_distribution<float> outside(1.1f, 2);
+    std::vector<CubicInterpolatorSolver> solvers(count);
+    for (int i = 0; i < count; ++i)
+    {
+        switch (set)
+        {
+            case SolverSet::eases:
+                solvers[i].build(kEases[i % 4][0], kEases[i % 4][1]);
+                break;
+            case SolverSet::random:
+                solvers[i].build(unit(random), unit(random));
+                break;
+            case SolverSet::unsorted:
+                solvers[i].build(-outside(random), outside(random));
+                break;
+        }
+    }
+    return solvers;
+}
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 50;
+    int solverCount = 10000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--solvers") && i + 1 < argc)
+        {
+            solverCount = std::max(atoi(argv[++i]), 1);
+        }
+        else
+        {
+            fprintf(stderr,
+                    "usage: cubic_bench [-n frames] [--solvers count]\n");
+            return 1;
+        }
+    }
+
+    printf("%i frames of %i solves\n", frameCount, solverCount);
+    printf("%-10s %12s %12s %8s\n", "solvers", "ns/getT", "ns/batch", "match");
+    for (SolverSet set : kSolverSets)
+    {
+        std::vector<CubicInterpolatorSolver> solvers =
+            make_solvers(set, solverCount);
+        std::vector<const CubicInterpolatorSolver*> solverPointers;
+        for (const CubicInterpolatorSolver& solver : solvers)
+        {
+            solverPointers.push_back(&solver);
+        }
+        // Each frame advances the x values, like an animation playing.
+        std::vector<float> xs(solverCount);
+        std::vector<float> ts(solverCount);
+        std::vector<float> batchTs(solverCount);
+        auto advanceXs = [&](int frame) {
+            for (int i = 0; i < solverCount; ++i)
+            {
+                xs[i] = static_cast<float>((i * 7 + frame) % 101) / 100;
+            }
+        };
+
+        double getTTime =
+            time_frames<std::nano>(frameCount, solverCount, [&](int frame) {
+                advanceXs(frame);
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < solverCount; ++i)
+                {
+                    ts[i] = solvers[i].getT(xs[i]);
+                }
+                return std::chrono::steady_clock::now() - start;
+            });
+        double batchTime =
+            time_frames<std::nano>(frameCount, solverCount, [&](int frame) {
+                advanceXs(frame);
+                auto start = std::chrono::steady_clock::now();
+                CubicInterpolatorSolver::getTBatch(solverPointers.data(),
+                                                   xs.data(),
+                                                   batchTs.data(),
+                                                   solverCount);
+                return std::chrono::steady_clock::now() - start;
+            });
+        // Both ran the same frame last, so they should agree bit for bit.
+        bool match = memcmp(ts.data(),
+                            batchTs.data(),
+                            solverCount * sizeof(float)) == 0;
+        printf("%-10s %12.2f %12.2f %8s\n",
+               solver_set_name(set),
+               getTTime,
+               batchTime,
+               match ? "yes" : "NO");
+    }
+    return 0;
+}
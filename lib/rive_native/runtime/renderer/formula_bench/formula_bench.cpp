@@ -0,0 +1,237 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for DataConverterFormula. Builds a few formulas from tokens
+// the way a .riv file lays them out, then times cloning them (which compiles
+// their program, as every artboard instance does) and converting a stream of
+// inputs through them, and reports the median time per call.
+//
+//   formula_bench [-n frames] [--converts count]
+//
+// "linear" is a plain expression of the input, "constants" is mostly
+// subexpressions that get folded at compile time, "functions" calls several
+// math functions on the input and "nested" nests functions inside functions.
+
+#include "rive/animation/arithmetic_operation.hpp"
+#include "rive/data_bind/converters/data_converter_formula.hpp"
+#include "rive/data_bind/converters/formula/formula_token_argument_separator.hpp"
+#include "rive/data_bind/converters/formula/formula_token_function.hpp"
+#include "rive/data_bind/converters/formula/formula_token_input.hpp"
+#include "rive/data_bind/converters/formula/formula_token_operation.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_close.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_open.hpp"
+#include "rive/data_bind/converters/formula/formula_token_value.hpp"
+#include "rive/data_bind/data_values/data_value_number.hpp"
+#include "rive/function_type.hpp"
+#include "utils/bench_timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rive;
+
+struct Formula
+{
+    const char* name;
+    // Space separated tokens. "x" is the input, "name(" starts a function
+    // call.
+    const char* tokens;
+};
+
+constexpr static Formula kFormulas[] = {
+    {"linear", "x * 2 + 1"},
+    {"constants", "x * ( 3 + 4 ) / ( 2 * 5 ) + max( 1 , 2 , 3 ) - ( 8 % 3 )"},
+    {"functions", "sin( x ) * cos( x / 2 ) + pow( x , 2 ) - sqrt( x * x + 1 )"},
+    {"nested", "min( max( round( x * 10 ) / 10 , 0 ) , atan2( x , 3 ) ) / 4"},
+};
+
+struct FunctionName
+{
+    const char* name;
+    FunctionType type;
+};
+
+constexpr static FunctionName kFunctionNames[] = {
+    {"min(", FunctionType::min},
+    {"max(", FunctionType::max},
+    {"round(", FunctionType::round},
+    {"sqrt(", FunctionType::sqrt},
+    {"pow(", FunctionType::pow},
+    {"cos(", FunctionType::cosine},
+    {"sin(", FunctionType::sine},
+    {"atan2(", FunctionType::atangent2},
+};
+
+static FormulaToken* make_operation(ArithmeticOperation operation)
+{
+    auto token = new FormulaTokenOperation();
+    token->operationType(static_cast<uint32_t>(operation));
+    return token;
+}
+
+// Returns null if a token isn't recognized.
+static std::unique_ptr<DataConverterFormula> make_formula(const char* tokens)
+{
+    auto formula = std::make_unique<DataConverterFormula>();
+    std::istringstream stream(tokens);
+    std::string text;
+    while (stream >> text)
+    {
+        FormulaToken* token = nullptr;
+        if (text == "x")
+        {
+            token = new FormulaTokenInput();
+        }
+        else if (text == "(")
+        {
+            token = new FormulaTokenParenthesisOpen();
+        }
+        else if (text == ")")
+        {
+            token = new FormulaTokenParenthesisClose();
+        }
+        else if (text == ",")
+        {
+            token = new FormulaTokenArgumentSeparator();
+        }
+        else if (text == "+")
+        {
+            token = make_operation(ArithmeticOperation::add);
+        }
+        else if (text == "-")
+        {
+            token = make_operation(ArithmeticOperation::subtract);
+        }
+        else if (text == "*")
+        {
+            token = make_operation(ArithmeticOperation::multiply);
+        }
+        else if (text == "/")
+        {
+            token = make_operation(ArithmeticOperation::divide);
+        }
+        else if (text == "%")
+        {
+            token = make_operation(ArithmeticOperation::modulo);
+        }
+        else if (text.back() == '(')
+        {
+            for (const FunctionName& function : kFunctionNames)
+            {
+                if (text == function.name)
+                {
+                    auto functionToken = new FormulaTokenFunction();
+                    functionToken->functionType(
+                        static_cast<uint32_t>(function.type));
+                    token = functionToken;
+                }
+            }
+        }
+        else
+        {
+            char* end = nullptr;
+            float value = strtof(text.c_str(), &end);
+            if (*end == '\0')
+            {
+                auto valueToken = new FormulaTokenValue();
+                valueToken->operationValue(value);
+                token = valueToken;
+            }
+        }
+        if (token == nullptr)
+        {
+            fprintf(stderr, "unknown token: %s\n", text.c_str());
+            return nullptr;
+        }
+        formula->addToken(token);
+    }
+    formula->initialize();
+    return formula;
+}
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 50;
+    int convertCount = 100000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--converts") && i + 1 < argc)
+        {
+            convertCount = std::max(atoi(argv[++i]), 1);
+        }
+        else
+        {
+            fprintf(stderr,
+                    "usage: formula_bench [-n frames] [--converts count]\n");
+            return 1;
+        }
+    }
+
+    // Clones are created in batches so their deletion is timed too.
+    constexpr static int kCloneCount = 1000;
+
+    printf("%i frames of %i clones and %i converts\n",
+           frameCount,
+           kCloneCount,
+           convertCount);
+    printf("%-10s %12s %12s %12s\n",
+           "formula",
+           "ns/clone",
+           "ns/convert",
+           "sum");
+    for (const Formula& formulaDesc : kFormulas)
+    {
+        std::unique_ptr<DataConverterFormula> formula =
+            make_formula(formulaDesc.tokens);
+        if (formula == nullptr)
+        {
+            return 1;
+        }
+        // Cloning is public through Core.
+        const Core* source = formula.get();
+
+        std::vector<std::unique_ptr<Core>> clones;
+        clones.reserve(kCloneCount);
+        double cloneTime =
+            time_frames<std::nano>(frameCount, kCloneCount, [&](int) {
+                for (int i = 0; i < kCloneCount; ++i)
+                {
+                    clones.emplace_back(source->clone());
+                }
+                clones.clear();
+            });
+
+        // Convert through an instance, like a data bind does.
+        std::unique_ptr<Core> instance(source->clone());
+        DataConverter* converter = instance->as<DataConverter>();
+        DataValueNumber input;
+        // Keeps the results alive, and shows when two builds disagree.
+        double sum = 0.0;
+        double convertTime =
+            time_frames<std::nano>(frameCount, convertCount, [&](int) {
+                for (int i = 0; i < convertCount; ++i)
+                {
+                    input.value(static_cast<float>(i % 1000) * .01f);
+                    DataValue* output = converter->convert(&input, nullptr);
+                    sum += output->as<DataValueNumber>()->value();
+                }
+            });
+        printf("%-10s %12.2f %12.2f %12.6g\n",
+               formulaDesc.name,
+               cloneTime,
+               convertTime,
+               sum / frameCount);
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include "rive/renderer/render_context_helper_impl.hpp"
+#include "rive/span.hpp"
+#include <functional>
+#include <vector>
+
+namespace rive::gpu
+{
+class FlushTaskScheduler;
+class CPURasterizer;
+struct CPUFlushData;
+
+// CPU backend implementation of RenderTarget. The pixels live in host memory as
+// premultiplied, little-endian RGBA8, with the top row first.
+class RenderTargetCPU : public RenderTarget
+{
+public:
+    RenderTargetCPU(uint32_t width, uint32_t height) :
+        RenderTarget(width, height), m_pixels(size_t(width) * height, 0)
+    {}
+    ~RenderTargetCPU() override {}
+
+    uint32_t* pixels() { return m_pixels.data(); }
+    const uint32_t* pixels() const { return m_pixels.data(); }
+
+private:
+    std::vector<uint32_t> m_pixels;
+};
+
+// Reference implementation of RenderContextImpl that runs entirely on the CPU.
+//
+// It consumes the exact same flush data as the GPU backends (storage buffers,
+// gradient spans, tessellation spans, patches, and draw batches), and executes
+// ports of the shaders with a tiled software rasterizer. This makes it usable
+// for headless rendering on machines without a GPU, and as a pixel reference
+// for the other backends.
+//
+// Only InterlockMode::rasterOrdering is supported. Flushes in any other mode
+// (e.g. frames that set msaaSampleCount) are skipped and leave the target
+// untouched.
+class RenderContextCPUImpl : public RenderContextHelperImpl
+{
+public:
+    struct ContextOptions
+    {
+        // Optional. When provided, tessellation and rasterization are split up
+        // across the scheduler's threads, and it's also installed as the
+        // context's flush task scheduler (see
+        // RenderContext::setFlushTaskScheduler()). Otherwise everything runs
+        // on the thread that calls flush().
+        FlushTaskScheduler* taskScheduler = nullptr;
+
+        // Optional. Called at the start of every flush with the tessellation
+        // spans and contours it reads, so tests can compare the buffers a
+        // flush was built from.
+        std::function<void(Span<const TessVertexSpan>,
+                           Span<const ContourData>)>
+            onFlushBuffers;
+    };
+
+    static std::unique_ptr<RenderContext> MakeContext(const ContextOptions&);
+
+    ~RenderContextCPUImpl() override;
+
+    rcp<RenderTargetCPU> makeRenderTarget(uint32_t width, uint32_t height)
+    {
+        return make_rcp<RenderTargetCPU>(width, height);
+    }
+
+private:
+    RenderContextCPUImpl(const ContextOptions&);
+
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType,
+                                       RenderBufferFlags,
+                                       size_t) override;
+
+    rcp<Texture> makeImageTexture(uint32_t width,
+                                  uint32_t height,
+                                  uint32_t mipLevelCount,
+                                  const uint8_t imageDataRGBAPremul[]) override;
+
+    std::unique_ptr<BufferRing> makeUniformBufferRing(
+        size_t capacityInBytes) override;
+    std::unique_ptr<BufferRing> makeStorageBufferRing(
+        size_t capacityInBytes,
+        gpu::StorageBufferStructure) override;
+    std::unique_ptr<BufferRing> makeVertexBufferRing(
+        size_t capacityInBytes) override;
+
+    void resizeGradientTexture(uint32_t width, uint32_t height) override;
+    void resizeTessellationTexture(uint32_t width, uint32_t height) override;
+    void resizeAtlasTexture(uint32_t width, uint32_t height) override;
+
+    void flush(const FlushDescriptor&) override;
+
+    // Flush steps, in the order they execute.
+    void renderColorRamps(const FlushDescriptor&);
+    void renderTessellationTexture(const FlushDescriptor&,
+                                   const CPUFlushData&);
+    void renderAtlas(const FlushDescriptor&, const CPUFlushData&);
+    void renderDrawList(const FlushDescriptor&, const CPUFlushData&);
+
+    FlushTaskScheduler* const m_taskScheduler;
+    const std::function<void(Span<const TessVertexSpan>,
+                             Span<const ContourData>)>
+        m_onFlushBuffers;
+
+    PatchVertex m_patchVertices[kPatchVertexBufferCount];
+    uint16_t m_patchIndices[kPatchIndexBufferCount];
+
+    // Unmultiplied RGBA8 color ramps.
+    std::vector<uint32_t> m_gradTexture;
+    uint32_t m_gradTextureHeight = 0;
+
+    // RGBA32UI tessellated vertices, 4 uint32_t's per texel.
+    std::vector<uint32_t> m_tessTexture;
+
+    // Feathered coverage masks. (R16F on the GPU backends.)
+    std::vector<float> m_atlasTexture;
+    uint32_t m_atlasTextureWidth = 0;
+    uint32_t m_atlasTextureHeight = 0;
+
+    // Bins triangles into screen tiles and walks them in parallel. Also owns
+    // the non-color pixel local storage planes.
+    std::unique_ptr<CPURasterizer> m_rasterizer;
+};
+} // namespace rive::gpu
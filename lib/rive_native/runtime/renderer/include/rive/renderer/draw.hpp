@@ -267,6 +267,20 @@ public:
                                uint32_t* tessVertexCount,
                                uint32_t* tessBaseVertex);
 
+    // Writes the TessVertexSpans and contours for this PathDraw at the given
+    // location. LogicalFlush calls this directly for tessellations that were
+    // deferred by pushTessellationData().
+    void writeTessellationData(RenderContext::LogicalFlush*,
+                               uint32_t tessVertexCount,
+                               uint32_t tessLocation,
+                               RenderContext::DeferredTessellation*);
+
+    // Upper bound on the TessVertexSpans writeTessellationData() pushes at
+    // the given location. Sizes the scratch range of a deferred
+    // tessellation.
+    uint32_t maxTessSpanCount(uint32_t tessVertexCount,
+                              uint32_t tessLocation) const;
+
     void releaseRefs() override;
 
 protected:
@@ -291,6 +305,15 @@ protected:
                                       RawPath*,
                                       TriangulatorAxis);
 
+    // Splits the tessellation at the given location into its forward and
+    // mirrored ranges.
+    void resolveTessellationRanges(uint32_t tessVertexCount,
+                                   uint32_t tessLocation,
+                                   uint32_t* forwardTessVertexCount,
+                                   uint32_t* forwardTessLocation,
+                                   uint32_t* mirroredTessVertexCount,
+                                   uint32_t* mirroredTessLocation) const;
+
     uint32_t allocateTessellationVertices(RenderContext::LogicalFlush* flush,
                                           uint32_t tessVertexCount)
     {
@@ -309,7 +332,9 @@ protected:
         gpu::ShaderMiscFlags = gpu::ShaderMiscFlags::none);
 
     // Pushes TessVertexSpans that will tessellate this PathDraw at the given
-    // location.
+    // location, or reserves room for them and defers writing them to the end
+    // of LogicalFlush::writeResources() when the context has a
+    // FlushTaskScheduler.
     void pushTessellationData(RenderContext::LogicalFlush*,
                               uint32_t tessVertexCount,
                               uint32_t tessLocation);
@@ -344,8 +369,12 @@ protected:
     // for large paths, and since we're triangulating the path interior anyway,
     // adding complexity to only run Wang's formula and chop once would save
     // about ~5% of the total CPU time. (And large paths are GPU-bound anyway.)
+    //
+    // When a TriangulationCache is provided, the interior triangulation is
+    // looked up there first and reused across frames.
     void iterateInteriorTriangulation(InteriorTriangulationOp op,
                                       TrivialBlockAllocator*,
+                                      TriangulationCache*,
                                       RawPath* scratchPath,
                                       TriangulatorAxis,
                                       RenderContext::TessellationWriter*);
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include "rive/renderer/gpu.hpp"
+
+namespace rive
+{
+class File;
+} // namespace rive
+
+namespace rive::gpu
+{
+// Conservative summary of the GPU work it might take to draw a File. Backends
+// use this to compile pipelines before the File's first frame.
+struct FileDrawRequirements
+{
+    // Every shader feature the File's content could turn on. Any subset of
+    // these may appear in a given batch.
+    ShaderFeatures shaderFeatures = ShaderFeatures::NONE;
+
+    // The File contains images or meshes.
+    bool drawsImages = false;
+};
+
+// Scans every artboard in the File, so nested artboards are included.
+FileDrawRequirements FindFileDrawRequirements(const File&);
+} // namespace rive::gpu
@@ -0,0 +1,24 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace rive::gpu
+{
+// Lets the host run the CPU side of RenderContext::flush() on its own thread
+// pool. See RenderContext::setFlushTaskScheduler().
+class FlushTaskScheduler
+{
+public:
+    virtual ~FlushTaskScheduler() {}
+
+    // Call work(index) once for every index in [0, count), potentially
+    // concurrently from any thread, and return once every call completed.
+    virtual void parallelFor(size_t count,
+                             const std::function<void(size_t)>& work) = 0;
+};
+} // namespace rive::gpu
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rive::gpu
+{
+// Receives timing and counter events from RenderContext::flush(). See
+// RenderContext::setFlushTraceSink().
+//
+// Events are delivered on the thread that called flush(). Names are string
+// literals, so sinks may hold on to them. Times are in seconds, as measured by
+// RenderContextImpl::secondsNow().
+class FlushTraceSink
+{
+public:
+    virtual ~FlushTraceSink() {}
+
+    // A stage of flush() that ran from startSeconds to endSeconds.
+    virtual void traceEvent(const char* name,
+                            double startSeconds,
+                            double endSeconds) = 0;
+
+    // The value of one of RenderContext::FlushStats' counters at the end of a
+    // flush.
+    virtual void traceCounter(const char* name,
+                              double timeSeconds,
+                              double value) = 0;
+};
+
+// Records events in the Chrome trace event format, which chrome://tracing and
+// https://ui.perfetto.dev can open.
+class ChromeTraceWriter : public FlushTraceSink
+{
+public:
+    void traceEvent(const char* name,
+                    double startSeconds,
+                    double endSeconds) override;
+    void traceCounter(const char* name,
+                      double timeSeconds,
+                      double value) override;
+
+    size_t eventCount() const { return m_events.size(); }
+
+    // Returns every event recorded so far as a JSON document.
+    std::string json() const;
+
+    void clear() { m_events.clear(); }
+
+private:
+    struct Event
+    {
+        const char* name;
+        bool isCounter;
+        double timeSeconds;
+        double value; // End time for events, or the counter's value.
+    };
+
+    std::vector<Event> m_events;
+};
+} // namespace rive::gpu
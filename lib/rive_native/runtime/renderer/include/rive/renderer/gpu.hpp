@@ -129,6 +129,16 @@ struct PlatformFeatures
     // implementation to opt in to always feathering to the atlas instead of
     // rendering directly to the screen.
     bool alwaysFeatherToAtlas = false;
+    // Complex color ramps normally stay cached in the gradient texture across
+    // flushes. Implementations that can't preserve the gradient texture's
+    // contents from one flush to the next opt out here, and every flush renders
+    // all of its color ramps again.
+    bool alwaysRerenderColorRamps = false;
+    // The atlas texture keeps its contents from one flush to the next, and
+    // atlas passes leave the rows above FlushDescriptor::atlasCacheHeight
+    // intact. Enables caching the coverage masks of feathered paths across
+    // flushes.
+    bool supportsPersistentAtlas = false;
     // clipSpaceBottomUp specifies whether the top of the viewport, in clip
     // coordinates, is at Y=+1 (OpenGL, Metal, D3D, WebGPU) or Y=-1 (Vulkan).
     //
@@ -377,9 +387,10 @@ enum class PaintType : uint32_t
 
 // Specifies the location of a simple or complex horizontal color ramp within
 // the gradient texture. A simple color ramp is two texels wide, beginning at
-// the specified row and column. A complex color ramp spans the entire width of
-// the gradient texture, on the row:
-//     "GradTextureLayout::complexOffsetY + ColorRampLocation::row".
+// the specified column, on the row:
+//     "GradTextureLayout::simpleOffsetY + ColorRampLocation::row".
+// A complex color ramp spans the entire width of the gradient texture, on the
+// specified row.
 struct ColorRampLocation
 {
     constexpr static uint16_t kComplexGradientMarker = 0xffff;
@@ -435,13 +446,13 @@ private:
 };
 
 // Specifies the height of the gradient texture, and the row at which we
-// transition from simple color ramps to complex.
+// transition from complex color ramps to simple.
 //
-// This information is computed at flush time, once we know exactly how many
-// color ramps of each type will be in the gradient texture.
+// Complex ramps are cached at the top of the gradient texture across flushes.
+// Simple ramps are rendered every flush, on the rows immediately after them.
 struct GradTextureLayout
 {
-    uint32_t complexOffsetY; // Row of the first complex gradient.
+    uint32_t simpleOffsetY; // Row of the first simple gradient.
     float inverseHeight;     // 1 / textureHeight
 };
 
@@ -639,8 +650,11 @@ enum class DrawType : uint8_t
     msaaOuterCubics,
 
     // Clear or intersect (based on DrawContents) the stencil clip bit.
+    // (Must stay last: kDrawTypeCount is derived from it.)
     msaaStencilClipReset,
 };
+constexpr static size_t kDrawTypeCount =
+    static_cast<size_t>(DrawType::msaaStencilClipReset) + 1;
 
 constexpr static bool DrawTypeIsImageDraw(DrawType drawType)
 {
@@ -1028,6 +1042,12 @@ struct FlushDescriptor
     uint16_t atlasContentWidth;
     uint16_t atlasContentHeight;
 
+    // Rows at the top of the atlas that hold coverage masks cached from
+    // previous flushes. Atlas passes only clear [0, atlasContentWidth) x
+    // [atlasCacheHeight, atlasContentHeight). Always 0 unless
+    // PlatformFeatures::supportsPersistentAtlas is set.
+    uint16_t atlasCacheHeight = 0;
+
     // Monotonically increasing prefix that gets appended to the most
     // significant "32 - CLOCKWISE_COVERAGE_BIT_COUNT" bits of coverage buffer
     // values.
@@ -1526,6 +1546,14 @@ public:
     }
     void skip_back() { push(); }
 
+    // Reserves the next 'count' items and returns a separate writer for them.
+    // This lets a range be filled in later (or from another thread) while the
+    // buffer keeps advancing.
+    WriteOnlyMappedMemory reserve_back(size_t count)
+    {
+        return WriteOnlyMappedMemory(push(count), count);
+    }
+
 private:
     RIVE_ALWAYS_INLINE T& push()
     {
@@ -35,13 +35,19 @@ class Draw;
 class Gradient;
 class RenderContextImpl;
 class PathDraw;
+class TriangulationCache;
+class GradientRampCache;
+class AtlasCache;
+struct AtlasCacheKey;
+class FlushTaskScheduler;
+class FlushTraceSink;
 
 // Used as a key for complex gradients.
 class GradientContentKey
 {
 public:
-    inline GradientContentKey(rcp<const Gradient> gradient);
-    inline GradientContentKey(GradientContentKey&& other);
+    GradientContentKey(rcp<const Gradient> gradient);
+    GradientContentKey(GradientContentKey&& other);
     bool operator==(const GradientContentKey&) const;
     const Gradient* gradient() const { return m_gradient.get(); }
 
@@ -213,13 +219,113 @@ public:
         uint64_t safeFrameNumber = 0;
     };
 
+    // Work done by a call to flush(), summed across all of its logical
+    // flushes.
+    struct FlushStats
+    {
+        size_t logicalFlushCount = 0;
+        // Draws issued to the backend, by gpu::DrawType. A path that renders in
+        // several parts (e.g., outer curves plus an interior triangulation)
+        // counts once toward each of their types.
+        std::array<size_t, gpu::kDrawTypeCount> drawCounts{};
+        // Draws after merging into gpu::DrawBatches.
+        size_t batchCount = 0;
+        // Estimated batchCount if every group of non-overlapping draws had
+        // been issued in sorted order, without reversing any to continue the
+        // previous group's batch.
+        size_t batchCountBeforeReordering = 0;
+        size_t tessVertexCount = 0;
+        size_t gradSpanCount = 0;
+        // Area of the masks rendered to the feather atlas (excluding masks
+        // found in the atlas cache).
+        size_t atlasPixelCount = 0;
+        // Bytes written to the mapped resource buffers.
+        size_t uploadedBufferBytes = 0;
+        // CPU time spent in each stage of flush(): laying out the frame's
+        // resources, (re)allocating and mapping them, writing them, and
+        // handing the logical flushes to the backend.
+        double layoutSeconds = 0;
+        double prepareSeconds = 0;
+        double writeResourcesSeconds = 0;
+        double submitSeconds = 0;
+        double totalSeconds = 0;
+    };
+
     // Submits all GPU commands that have been built up since beginFrame().
-    void flush(const FlushResources&);
+    FlushStats flush(const FlushResources&);
+
+    // Stats from the most recent flush().
+    const FlushStats& lastFlushStats() const { return m_lastFlushStats; }
+
+    // When set, flush() reports the duration of each of its stages and the
+    // counters in FlushStats to the sink. The sink must remain valid until it
+    // is unset.
+    void setFlushTraceSink(FlushTraceSink* sink) { m_flushTraceSink = sink; }
+    FlushTraceSink* flushTraceSink() const { return m_flushTraceSink; }
 
     // Called when the client will stop rendering. Releases all CPU and GPU
     // resources associated with this render context.
     void releaseResources();
 
+    // The interior triangulations of large filled paths are kept across
+    // frames and reused for as long as the path and its matrix don't change.
+    struct TriangulationCacheStats
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t entryCount = 0;
+    };
+    TriangulationCacheStats triangulationCacheStats() const;
+
+    // Maximum number of triangulations kept across frames. 0 disables the
+    // cache.
+    void setTriangulationCacheCapacity(size_t);
+
+    // Complex color ramps stay in the gradient texture across frames, and are
+    // only rendered again when a gradient is new or has changed.
+    // "gradSpanCount" is the number of GradientSpans the most recent frame
+    // had to render (simple ramps are always rendered).
+    struct GradientRampCacheStats
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t rowCount = 0;
+        size_t gradSpanCount = 0;
+    };
+    GradientRampCacheStats gradientRampCacheStats() const;
+
+    // Number of complex color ramps kept across frames. 0 disables the cache.
+    void setGradientRampCacheCapacity(size_t);
+
+    // On backends with PlatformFeatures::supportsPersistentAtlas, the coverage
+    // masks of feathered paths stay in the atlas across frames, and are only
+    // rendered again when the path, its transform, or its visible bounds
+    // change.
+    struct AtlasCacheStats
+    {
+        size_t hitCount = 0;
+        size_t missCount = 0;
+        size_t entryCount = 0;
+    };
+    AtlasCacheStats atlasCacheStats() const;
+
+    // Number of rows at the top of the atlas reserved for cached masks. 0
+    // disables the cache.
+    void setAtlasCacheCapacity(uint32_t rowCount);
+
+    // When set, flush() writes the tessellation data of its paths from the
+    // scheduler's threads. The spans and contours are byte-identical to the
+    // ones written serially. The scheduler must remain valid until it is
+    // unset.
+    void setFlushTaskScheduler(FlushTaskScheduler* scheduler)
+    {
+        m_flushTaskScheduler = scheduler;
+    }
+    FlushTaskScheduler* flushTaskScheduler() const
+    {
+        return m_flushTaskScheduler;
+    }
+
     // Returns the context's TrivialBlockAllocator, which is automatically reset
     // at the end of every frame. (Memory in this allocator is preserved between
     // logical flushes.)
@@ -266,6 +372,9 @@ public:
                                        RenderBufferFlags,
                                        size_t) override;
     rcp<RenderImage> decodeImage(Span<const uint8_t>) override;
+    rcp<RenderImage> makeImage(uint32_t width,
+                               uint32_t height,
+                               const uint8_t premulRGBA[]) override;
 
 private:
     friend class Draw;
@@ -373,6 +482,23 @@ private:
     std::vector<int64_t> m_indirectDrawList;
     std::unique_ptr<IntersectionBoard> m_intersectionBoard;
 
+    // Interior triangulations that outlive the frame they were made in.
+    constexpr static size_t kDefaultTriangulationCacheCapacity = 64;
+    std::unique_ptr<TriangulationCache> m_triangulationCache;
+
+    // Complex color ramps that outlive the flush they were rendered in.
+    constexpr static size_t kDefaultGradientRampCacheCapacity = 128;
+    std::unique_ptr<GradientRampCache> m_gradientRampCache;
+
+    // Feathered coverage masks that outlive the flush they were rendered in.
+    constexpr static uint32_t kDefaultAtlasCacheCapacity = 512;
+    std::unique_ptr<AtlasCache> m_atlasCache;
+
+    FlushTaskScheduler* m_flushTaskScheduler = nullptr;
+
+    FlushStats m_lastFlushStats;
+    FlushTraceSink* m_flushTraceSink = nullptr;
+
     WriteOnlyMappedMemory<gpu::FlushUniforms> m_flushUniformData;
     WriteOnlyMappedMemory<gpu::PathData> m_pathData;
     WriteOnlyMappedMemory<gpu::PaintData> m_paintData;
@@ -411,6 +537,26 @@ private:
 
     class TessellationWriter;
 
+    // Tessellation data for a single PathDraw that LogicalFlush writes after
+    // the draw loop, potentially from a FlushTaskScheduler thread.
+    struct DeferredTessellation
+    {
+        PathDraw* draw;
+        uint32_t tessVertexCount;
+        uint32_t tessLocation;
+        // Contour records are reserved in draw order, so the contour IDs
+        // match the ones the serial path would assign.
+        WriteOnlyMappedMemory<gpu::ContourData> contourData;
+        uint32_t currentContourID;
+        // Spans are first written to a range of scratch memory sized for the
+        // worst case, starting at firstScratchSpan. Once every tessellation
+        // is written, they are copied to the tessellation buffer in draw
+        // order, so the buffer matches the serial path byte for byte.
+        size_t firstScratchSpan;
+        size_t tessSpanCount;
+        WriteOnlyMappedMemory<gpu::TessVertexSpan> tessSpanData;
+    };
+
     // Manages a list of high-level Draws and their required resources.
     //
     // Since textures have hard size limits, we can't always fit an entire frame
@@ -451,6 +597,10 @@ private:
             return m_flushDesc;
         }
 
+        // Adds this flush's draw, batch, and atlas counts to stats. Only valid
+        // after writeResources().
+        void accumulateStats(FlushStats* stats) const;
+
         // Generates a unique clip ID that is guaranteed to not exist in the
         // current clip buffer.
         //
@@ -565,7 +715,13 @@ private:
         // Attempts to leave a border of "desiredPadding" pixels surrounding the
         // rectangular region, but the allocation may not be padded if the path
         // is up against an edge.
+        //
+        // If cacheKey is provided, the region may come from the context's
+        // AtlasCache instead. When it already holds the draw's mask, the draw
+        // skips pushAtlasTessellation() and doesn't use its tessellation
+        // vertices or contours.
         bool allocateAtlasDraw(PathDraw*,
+                               const AtlasCacheKey* cacheKey,
                                uint16_t drawWidth,
                                uint16_t drawHeight,
                                uint16_t desiredPadding,
@@ -592,6 +748,26 @@ private:
                              ResourceCounters* runningFrameResourceCounts,
                              LayoutCounters* runningFrameLayoutCounts);
 
+        // Carves out this flush's GradientSpans within the frame's gradient
+        // span buffer. Called by layoutResources(), and again if the gradient
+        // texture has to be reallocated after layout.
+        void layoutGradSpans(LayoutCounters* runningFrameLayoutCounts);
+
+        // Schedules every complex ramp this flush references for rendering,
+        // including ones that were found in the gradient ramp cache. Used when
+        // the gradient texture gets reallocated and loses its contents.
+        void rerenderCachedGradients();
+
+        // Extent of the atlas this flush renders to or reads from.
+        uint32_t atlasWidth() const { return m_atlasMaxX; }
+        uint32_t atlasHeight() const { return m_atlasMaxY; }
+
+        // Renders every coverage mask this flush reads from the atlas cache
+        // again, and clears the whole atlas content area first. Used when the
+        // atlas texture is about to get reallocated and lose its contents.
+        // Must be called before layoutResources().
+        void discardCachedAtlasDraws();
+
         // Called after all flushes in a frame have done their layout and the
         // render context has allocated and mapped its resource buffers. Writes
         // the GPU data for this flush to the context's actively mapped resource
@@ -643,6 +819,14 @@ private:
                                            bool closed,
                                            uint32_t vertexIndex0);
 
+        // When the context has a FlushTaskScheduler, reserves the contour
+        // records of 'draw' and records its tessellation to be written at the
+        // end of writeResources(). Returns false if the caller needs to write
+        // the tessellation immediately instead.
+        bool deferTessellationData(PathDraw* draw,
+                                   uint32_t tessVertexCount,
+                                   uint32_t tessLocation);
+
         // Writes padding vertices to the tessellation texture, with an invalid
         // contour ID that is guaranteed to not be the same ID as any neighbors.
         void pushPaddingVertices(uint32_t count, uint32_t tessLocation);
@@ -721,6 +905,12 @@ private:
                             uint32_t elementCount,
                             uint32_t baseElement);
 
+        // Writes every tessellation recorded by deferTessellationData() on the
+        // FlushTaskScheduler, then reserves their exact span counts in the
+        // tessellation buffer in the order they were recorded and copies the
+        // spans over.
+        void writeDeferredTessellationData();
+
         // Instance pointer to the outer parent class.
         RenderContext* const m_ctx;
 
@@ -742,9 +932,22 @@ private:
         // should be scaled to a ramp where every stop lands exactly on a pixel
         // center, but for now we just always scale them to the entire gradient
         // texture width.
+        //
+        // Their rows are assigned by the context's GradientRampCache, and only
+        // the ones that aren't in the texture yet get rendered.
+        struct ComplexGradDraw
+        {
+            const Gradient* gradient;
+            uint16_t row;
+        };
         std::unordered_map<GradientContentKey, uint16_t, DeepHashGradient>
             m_complexGradients; // [colors[0..n], stops[0..n]] -> rowIdx
-        std::vector<const Gradient*> m_pendingComplexGradDraws;
+        std::vector<ComplexGradDraw> m_pendingComplexGradDraws;
+
+        // Rows at the top of the gradient texture that were reserved for
+        // cached complex ramps when this flush last allocated a gradient.
+        // Simple ramps begin immediately after them.
+        uint32_t m_complexGradRowCount;
 
         // Simple and complex gradients both get uploaded to the GPU as sets of
         // "GradientSpan" instances.
@@ -773,18 +976,47 @@ private:
         gpu::FlushDescriptor m_flushDesc;
 
         BlockAllocatedLinkedList<DrawBatch> m_drawList;
+        // Batches saved by reversing groups of non-overlapping draws. (For
+        // FlushStats.)
+        int64_t m_reorderedBatchSavings;
         gpu::ShaderFeatures m_combinedShaderFeatures;
 
+        // Draws pushed by pushDraw(), by DrawType. (For FlushStats.)
+        std::array<uint32_t, gpu::kDrawTypeCount> m_drawCounts;
+
         // Most recent path and contour state.
         uint32_t m_currentPathID;
         uint32_t m_currentContourID;
 
-        // Atlas for offscreen feathering.
+        std::vector<DeferredTessellation> m_deferredTessellations;
+        // Spans of the deferred tessellations before they are copied to the
+        // tessellation buffer. Reused across flushes until resetContainers().
+        std::vector<gpu::TessVertexSpan> m_deferredTessSpanScratch;
+
+        // Atlas for offscreen feathering. When the atlas cache is enabled,
+        // the rectanizer only covers the rows below the cache's band, starting
+        // at m_atlasRectanizerTop.
         std::unique_ptr<skgpu::RectanizerSkyline> m_atlasRectanizer;
+        uint16_t m_atlasRectanizerTop = 0;
         uint32_t m_atlasMaxX = 0;
         uint32_t m_atlasMaxY = 0;
         std::vector<PathDraw*> m_pendingAtlasDraws;
 
+        // Atlas draws whose masks were already in the context's AtlasCache.
+        // Their tessellation vertices and contours were left out of
+        // m_resourceCounts and are tallied here instead.
+        std::vector<PathDraw*> m_cachedAtlasDraws;
+        ResourceCounters m_cachedAtlasResourceCounts;
+        // Masks reserved in the AtlasCache by the batch currently being pushed,
+        // so they can be forgotten again if the batch doesn't fit.
+        std::vector<AtlasCacheKey> m_atlasCacheInsertions;
+        bool m_usesAtlasCache;
+        uint64_t m_atlasCacheGeneration;
+        // This flush's atlas rectanizer overlaps the cache's band.
+        bool m_atlasCacheBlocked;
+        // Set by discardCachedAtlasDraws().
+        bool m_atlasCacheDiscarded;
+
         // Total coverage allocated via allocateCoverageBufferRange().
         // (clockwiseAtomic mode only.)
         uint32_t m_coverageBufferLength = 0;
@@ -816,13 +1048,18 @@ private:
         // & mirroredTessVertexCount must both be equal, and
         // forwardTessLocation & mirroredTessLocation must both be valid.
         // Otherwise, one span or the other may be empty.
+        //
+        // If 'deferred' is not null, contours and spans are written to its
+        // reserved ranges instead of the flush's, which makes the writer safe
+        // to use from another thread.
         TessellationWriter(LogicalFlush* flush,
                            uint32_t pathID,
                            gpu::ContourDirections,
                            uint32_t forwardTessVertexCount,
                            uint32_t forwardTessLocation,
                            uint32_t mirroredTessVertexCount = 0,
-                           uint32_t mirroredTessLocation = 0);
+                           uint32_t mirroredTessLocation = 0,
+                           DeferredTessellation* deferred = nullptr);
 
         ~TessellationWriter();
 
@@ -911,6 +1148,7 @@ private:
 
     private:
         LogicalFlush* const m_flush;
+        DeferredTessellation* const m_deferred;
         WriteOnlyMappedMemory<gpu::TessVertexSpan>& m_tessSpanData;
         const uint32_t m_pathID;
         const gpu::ContourDirections m_contourDirections;
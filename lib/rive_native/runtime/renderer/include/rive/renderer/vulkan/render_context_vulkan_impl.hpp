@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include "rive/renderer/file_draw_requirements.hpp"
 #include "rive/renderer/render_context_impl.hpp"
 #include "rive/renderer/vulkan/vulkan_context.hpp"
 #include <chrono>
 #include <map>
+#include <unordered_set>
 #include <vulkan/vulkan.h>
 
 namespace rive::gpu
@@ -116,12 +118,35 @@ private:
 class RenderContextVulkanImpl : public RenderContextImpl
 {
 public:
+    struct ContextOptions
+    {
+        // Optional. Seeds the VkPipelineCache with data previously returned by
+        // pipelineCacheData(), e.g., from a file saved by an earlier run. Data
+        // from a different driver or device is ignored.
+        Span<const uint8_t> pipelineCacheData;
+    };
+
     static std::unique_ptr<RenderContext> MakeContext(
         VkInstance,
         VkPhysicalDevice,
         VkDevice,
         const VulkanFeatures&,
-        PFN_vkGetInstanceProcAddr);
+        PFN_vkGetInstanceProcAddr,
+        const ContextOptions&);
+    static std::unique_ptr<RenderContext> MakeContext(
+        VkInstance instance,
+        VkPhysicalDevice physicalDevice,
+        VkDevice device,
+        const VulkanFeatures& features,
+        PFN_vkGetInstanceProcAddr pfnvkGetInstanceProcAddr)
+    {
+        return MakeContext(instance,
+                           physicalDevice,
+                           device,
+                           features,
+                           pfnvkGetInstanceProcAddr,
+                           ContextOptions());
+    }
     ~RenderContextVulkanImpl();
 
     VulkanContext* vulkanContext() const { return m_vk.get(); }
@@ -149,9 +174,26 @@ public:
 
     void hotloadShaders(rive::Span<const uint32_t> spirvData);
 
+    // Returns the contents of the VkPipelineCache that every pipeline is
+    // created with, for the client to save and pass back in via
+    // ContextOptions::pipelineCacheData on a later run.
+    std::vector<uint8_t> pipelineCacheData() const;
+
+    // Starts creating, on a background thread, the draw pipelines that a File
+    // with the given requirements may use when rendered in 'interlockMode' to
+    // a render target of 'framebufferFormat'. Call this after loading a File
+    // so its first frames don't stall on pipeline compilation.
+    //
+    // Pipelines are handed over to flush() as they finish. flush() still
+    // creates any pipeline it needs that isn't ready yet.
+    void precompileDrawPipelines(const gpu::FileDrawRequirements&,
+                                 gpu::InterlockMode,
+                                 VkFormat framebufferFormat);
+
 private:
     RenderContextVulkanImpl(rcp<VulkanContext>,
-                            const VkPhysicalDeviceProperties&);
+                            const VkPhysicalDeviceProperties&,
+                            const ContextOptions&);
 
     // Called outside the constructor so we can use virtual methods.
     void initGPUObjects();
@@ -239,6 +281,10 @@ private:
     const uint32_t m_vendorID;
     const VkFormat m_atlasFormat;
 
+    // Every pipeline is created with this cache. VkPipelineCache is internally
+    // synchronized, so the background compiler shares it.
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+
     // Rive buffer pools. These don't need to be rcp<> because the destructor of
     // RenderContextVulkanImpl is already synchronized.
     vkutil::BufferPool m_flushUniformBufferPool;
@@ -294,6 +340,8 @@ private:
     rcp<vkutil::Texture> m_gradientTexture;
     rcp<vkutil::TextureView> m_gradTextureView;
     rcp<vkutil::Framebuffer> m_gradTextureFramebuffer;
+    // UNDEFINED until the first flush after the gradient texture is created.
+    VkImageLayout m_gradTextureLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
     // Renders tessellated vertices to the tessellation texture.
     class TessellatePipeline;
@@ -321,11 +369,28 @@ private:
                gpu::kInterlockModeCount * (1 << kDrawPipelineLayoutOptionCount)>
         m_drawPipelineLayouts;
 
+    // Returns (creating if needed) the pipeline layout for a flush with the
+    // given interlock mode and combined shader features.
+    DrawPipelineLayout& drawPipelineLayout(
+        gpu::InterlockMode,
+        gpu::ShaderFeatures combinedShaderFeatures);
+
     class DrawShader;
     std::map<uint32_t, DrawShader> m_drawShaders;
 
     class DrawPipeline;
-    std::map<uint32_t, DrawPipeline> m_drawPipelines;
+    std::map<uint32_t, std::unique_ptr<DrawPipeline>> m_drawPipelines;
+
+    // Creates DrawPipelines for precompileDrawPipelines().
+    class BackgroundPipelineCompiler;
+    std::unique_ptr<BackgroundPipelineCompiler> m_backgroundPipelineCompiler;
+    // Keys of pipelines that have been sent to the background compiler and not
+    // yet collected by flush().
+    std::unordered_set<uint32_t> m_backgroundPipelineKeys;
+
+    // Moves pipelines that finished compiling in the background into
+    // m_drawPipelines.
+    void collectBackgroundPipelines();
 
     // Gaussian integral table for feathering.
     rcp<TextureVulkanImpl> m_featherTexture;
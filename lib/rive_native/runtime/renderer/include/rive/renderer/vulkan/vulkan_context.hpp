@@ -79,6 +79,7 @@ public:
     F(CreateFramebuffer)                                                       \
     F(CreateGraphicsPipelines)                                                 \
     F(CreateImageView)                                                         \
+    F(CreatePipelineCache)                                                     \
     F(CreatePipelineLayout)                                                    \
     F(CreateRenderPass)                                                        \
     F(CreateSampler)                                                           \
@@ -88,10 +89,12 @@ public:
     F(DestroyFramebuffer)                                                      \
     F(DestroyImageView)                                                        \
     F(DestroyPipeline)                                                         \
+    F(DestroyPipelineCache)                                                    \
     F(DestroyPipelineLayout)                                                   \
     F(DestroyRenderPass)                                                       \
     F(DestroySampler)                                                          \
     F(DestroyShaderModule)                                                     \
+    F(GetPipelineCacheData)                                                    \
     F(ResetDescriptorPool)                                                     \
     F(UpdateDescriptorSets)
 
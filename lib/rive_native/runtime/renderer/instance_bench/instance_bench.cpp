@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for artboard instancing. Imports a .riv file, then times
+// creating and destroying instances of its default artboard, with every cloned
+// object on the heap (Artboard::instance) and in a single CoreArena
+// (Artboard::arenaInstance), and reports the median time per instance.
+//
+//   instance_bench [-n frames] [--instances count] <file.riv>
+//
+// The heap numbers double as a check that the arena support costs nothing when
+// it isn't used: compare them against a build without it.
+
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "utils/bench_timer.hpp"
+#include "utils/no_op_factory.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace rive;
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 50;
+    int instanceCount = 100;
+    const char* rivPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--instances") && i + 1 < argc)
+        {
+            instanceCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (argv[i][0] != '-' && rivPath == nullptr)
+        {
+            rivPath = argv[i];
+        }
+        else
+        {
+            rivPath = nullptr;
+            break;
+        }
+    }
+    if (rivPath == nullptr)
+    {
+        fprintf(stderr,
+                "usage: instance_bench [-n frames] [--instances count] "
+                "<file.riv>\n");
+        return 1;
+    }
+
+    std::ifstream rivStream(rivPath, std::ios::binary);
+    std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(rivStream),
+                                  {});
+    NoOpFactory factory;
+    std::unique_ptr<File> file = File::import(rivBytes, &factory);
+    Artboard* artboard = file != nullptr ? file->artboard() : nullptr;
+    if (artboard == nullptr)
+    {
+        fprintf(stderr, "failed to import: %s\n", rivPath);
+        return 1;
+    }
+
+    printf("%s: %zu objects, %i frames of %i instances\n",
+           artboard->name().c_str(),
+           artboard->objects().size(),
+           frameCount,
+           instanceCount);
+    printf("%-8s %12s\n", "mode", "us/instance");
+
+    std::vector<std::unique_ptr<ArtboardInstance>> instances;
+    instances.reserve(instanceCount);
+    double heapTime =
+        time_frames<std::micro>(frameCount, instanceCount, [&](int) {
+            for (int i = 0; i < instanceCount; ++i)
+            {
+                instances.push_back(artboard->instance());
+            }
+            instances.clear();
+        });
+    printf("%-8s %12.2f\n", "heap", heapTime);
+
+    double arenaTime =
+        time_frames<std::micro>(frameCount, instanceCount, [&](int) {
+            for (int i = 0; i < instanceCount; ++i)
+            {
+                instances.push_back(artboard->arenaInstance());
+            }
+            instances.clear();
+        });
+    printf("%-8s %12.2f\n", "arena", arenaTime);
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for IntersectionBoard, which assigns a groupIndex to every
+// draw when the renderer reorders draws. Feeds a few synthetic distributions of
+// rectangles through IntersectionBoard::addRectangle and reports the median
+// time per rectangle.
+//
+//   intersection_bench [-n frames] [--rects count] [--size WxH]
+//
+// Build with -mavx2 (or /arch:AVX2) to measure the 256-bit search, or with
+// clang to measure the two chunk gvec search. The checksum of every
+// distribution must match between builds.
+
+#include "intersection_board.hpp"
+#include "rive/rive_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+enum class Distribution
+{
+    // Small rectangles spread uniformly across the viewport. Most tests don't
+    // intersect anything.
+    scattered,
+
+    // Medium-sized rectangles clustered around the center, like a busy UI
+    // stacked in panels. Most tests intersect many rectangles.
+    overlapping,
+
+    // Full-width rows that walk down the viewport, like the items of a
+    // scrolling list.
+    rows,
+
+    // Small cells laid out in reading order, like glyphs or icons in a grid.
+    // Consecutive rectangles are neighbors, so the bounding box of each chunk
+    // is tight.
+    grid,
+
+    // A mix of the above, with an occasional rectangle covering the whole
+    // viewport.
+    mixed,
+};
+
+constexpr static Distribution kDistributions[] = {
+    Distribution::scattered,
+    Distribution::overlapping,
+    Distribution::rows,
+    Distribution::grid,
+    Distribution::mixed,
+};
+
+static const char* distribution_name(Distribution distribution)
+{
+    switch (distribution)
+    {
+        case Distribution::scattered:
+            return "scattered";
+        case Distribution::overlapping:
+            return "overlapping";
+        case Distribution::rows:
+            return "rows";
+        case Distribution::grid:
+            return "grid";
+        case Distribution::mixed:
+            return "mixed";
+    }
+    return "";
+}
+
+static std::vector<int4> make_rectangles(Distribution distribution,
+                                         int count,
+                                         int2 viewportSize)
+{
+    // Fixed seed so every run and every build tests the same rectangles.
+    std::mt19937 rng(0x1234);
+    auto randInt = [&rng](int lo, int hi) {
+        return std::uniform_int_distribution<int>(lo, hi)(rng);
+    };
+    int2 center = viewportSize / 2;
+    std::vector<int4> rects;
+    rects.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        Distribution d = distribution;
+        if (d == Distribution::mixed)
+        {
+            if (randInt(0, 999) == 0)
+            {
+                rects.push_back({0, 0, viewportSize.x, viewportSize.y});
+                continue;
+            }
+            d = kDistributions[randInt(0, 3)];
+        }
+        int2 topLeft, size;
+        switch (d)
+        {
+            case Distribution::scattered:
+                size = {randInt(4, 64), randInt(4, 64)};
+                topLeft = {randInt(0, viewportSize.x - 1),
+                           randInt(0, viewportSize.y - 1)};
+                break;
+            case Distribution::overlapping:
+                size = {randInt(50, 600), randInt(50, 600)};
+                topLeft = {center.x + randInt(-300, 300) - size.x / 2,
+                           center.y + randInt(-300, 300) - size.y / 2};
+                break;
+            case Distribution::rows:
+            {
+                int rowHeight = 48;
+                int row = i % (viewportSize.y / rowHeight);
+                size = {viewportSize.x - 32, rowHeight - 4};
+                topLeft = {16, row * rowHeight + 2};
+                break;
+            }
+            case Distribution::grid:
+            {
+                int2 cellSize = {14, 20};
+                int2 gridSize = viewportSize / cellSize;
+                int cell = i % (gridSize.x * gridSize.y);
+                size = {randInt(8, 18), randInt(12, 24)};
+                topLeft = int2{cell % gridSize.x, cell / gridSize.x} * cellSize;
+                break;
+            }
+            case Distribution::mixed:
+                RIVE_UNREACHABLE();
+        }
+        rects.push_back(simd::join(topLeft, topLeft + size));
+    }
+    return rects;
+}
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 200;
+    int rectCount = 4000;
+    int width = 1920, height = 1080;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--rects") && i + 1 < argc)
+        {
+            // Group indices are 16-bit.
+            rectCount = std::clamp(atoi(argv[++i]), 1, 30000);
+        }
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%ix%i", &width, &height) != 2 ||
+                width <= 0 || height <= 0)
+            {
+                fprintf(stderr, "invalid --size: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf(stderr,
+                    "usage: intersection_bench [-n frames] [--rects count] "
+                    "[--size WxH]\n");
+            return 1;
+        }
+    }
+
+#ifdef __AVX2__
+    printf("[avx2] ");
+#endif
+    printf("%i rectangles, %i frames, %ix%i\n",
+           rectCount,
+           frameCount,
+           width,
+           height);
+    printf("%-12s %12s %12s %10s\n",
+           "distribution",
+           "ns/rect",
+           "max group",
+           "checksum");
+
+    IntersectionBoard board;
+    for (Distribution distribution : kDistributions)
+    {
+        std::vector<int4> rects =
+            make_rectangles(distribution, rectCount, {width, height});
+        uint32_t checksum = 0;
+        int16_t maxGroupIndex = 0;
+        std::vector<double> frameTimes;
+        frameTimes.reserve(frameCount);
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            auto start = std::chrono::steady_clock::now();
+            board.resizeAndReset(width, height);
+            for (const int4& rect : rects)
+            {
+                int16_t groupIndex = board.addRectangle(rect);
+                checksum = checksum * 31 + groupIndex;
+                maxGroupIndex = std::max(maxGroupIndex, groupIndex);
+            }
+            std::chrono::duration<double, std::nano> elapsed =
+                std::chrono::steady_clock::now() - start;
+            frameTimes.push_back(elapsed.count());
+        }
+        // Report the median frame, which is less sensitive to noise than the
+        // mean.
+        std::nth_element(frameTimes.begin(),
+                         frameTimes.begin() + frameCount / 2,
+                         frameTimes.end());
+        printf("%-12s %12.2f %12i %10x\n",
+               distribution_name(distribution),
+               frameTimes[frameCount / 2] / rectCount,
+               maxGroupIndex,
+               checksum);
+    }
+    return 0;
+}
@@ -0,0 +1,331 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Self-checking test for File::importLazy. Imports each .riv file eagerly and
+// lazily, then compares what the two files hold. Prints every check and exits
+// with 1 if any of them failed.
+//
+//   lazy_check <file.riv>...
+//
+// The files should have nested artboards and data binds between them, for
+// example example/assets/hero.riv and example/assets/rewards.riv. Each file
+// prints how many of each it covered.
+//
+// "unloaded": a lazy import doesn't load any artboard up front, an eager one
+// loads them all.
+// "objects": every artboard has the same objects in the same order, with the
+// same types and names.
+// "nested": nested artboards point at the same source artboards, and loading
+// an artboard loaded those sources too.
+// "data binds": every artboard has the same data binds, with the same
+// properties, flags, targets and converters.
+// "instances": instances of every artboard, bound to their default view model
+// instance and advanced through their default state machine, end up with the
+// same world transforms.
+// "threads": a lazy import whose artboards are loaded from several threads at
+// once, while they poll isArtboardLoaded, matches the eager import.
+
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/artboard.hpp"
+#include "rive/data_bind/converters/data_converter.hpp"
+#include "rive/data_bind/data_bind.hpp"
+#include "rive/file.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/world_transform_component.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/self_check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rive;
+
+static std::string component_name(const Core* object)
+{
+    return object->is<Component>() ? object->as<Component>()->name() : "";
+}
+
+static uint16_t core_type(const Core* object)
+{
+    return object != nullptr ? object->coreType() : 0;
+}
+
+static bool objects_match(const Artboard* eager, const Artboard* lazy)
+{
+    const std::vector<Core*>& eagerObjects = eager->objects();
+    const std::vector<Core*>& lazyObjects = lazy->objects();
+    if (eagerObjects.size() != lazyObjects.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < eagerObjects.size(); i++)
+    {
+        if (core_type(eagerObjects[i]) != core_type(lazyObjects[i]) ||
+            (eagerObjects[i] != nullptr &&
+             component_name(eagerObjects[i]) !=
+                 component_name(lazyObjects[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t artboard_index(const File* file, const Artboard* artboard)
+{
+    for (size_t i = 0; i < file->artboardCount(); i++)
+    {
+        if (file->artboard(i) == artboard)
+        {
+            return i;
+        }
+    }
+    return file->artboardCount();
+}
+
+static bool nested_match(const File* eagerFile,
+                         const File* lazyFile,
+                         const Artboard* eager,
+                         const Artboard* lazy)
+{
+    const std::vector<NestedArtboard*>& eagerNested = eager->nestedArtboards();
+    const std::vector<NestedArtboard*>& lazyNested = lazy->nestedArtboards();
+    if (eagerNested.size() != lazyNested.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < eagerNested.size(); i++)
+    {
+        Artboard* eagerSource = eagerNested[i]->sourceArtboard();
+        Artboard* lazySource = lazyNested[i]->sourceArtboard();
+        if ((eagerSource == nullptr) != (lazySource == nullptr))
+        {
+            return false;
+        }
+        if (eagerSource == nullptr)
+        {
+            continue;
+        }
+        size_t lazyIndex = artboard_index(lazyFile, lazySource);
+        if (artboard_index(eagerFile, eagerSource) != lazyIndex ||
+            !lazyFile->isArtboardLoaded(lazyIndex) ||
+            !objects_match(eagerSource, lazySource))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool data_binds_match(const Artboard* eager, const Artboard* lazy)
+{
+    std::vector<DataBind*> eagerBinds = eager->dataBinds();
+    std::vector<DataBind*> lazyBinds = lazy->dataBinds();
+    if (eagerBinds.size() != lazyBinds.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < eagerBinds.size(); i++)
+    {
+        const DataBind* eagerBind = eagerBinds[i];
+        const DataBind* lazyBind = lazyBinds[i];
+        if (eagerBind->propertyKey() != lazyBind->propertyKey() ||
+            eagerBind->flags() != lazyBind->flags() ||
+            core_type(eagerBind->target()) != core_type(lazyBind->target()) ||
+            component_name(eagerBind->target()) !=
+                component_name(lazyBind->target()) ||
+            core_type(eagerBind->converter()) !=
+                core_type(lazyBind->converter()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// World transforms of an instance of the artboard after a second of frames.
+static std::vector<Mat2D> advanced_transforms(const File* file,
+                                              Artboard* artboard)
+{
+    constexpr static int kFrameCount = 60;
+    constexpr static float kFrameSeconds = 1.0f / kFrameCount;
+
+    std::unique_ptr<ArtboardInstance> instance = artboard->instance();
+    std::unique_ptr<StateMachineInstance> stateMachine =
+        instance->defaultStateMachine();
+    if (stateMachine == nullptr && instance->stateMachineCount() > 0)
+    {
+        stateMachine = instance->stateMachineAt(0);
+    }
+    // State machine layers seed rand() from the clock, and random transitions
+    // and formulas draw from it. Reseed so both files make the same draws.
+    srand(0);
+    rcp<ViewModelInstance> viewModelInstance =
+        file->createDefaultViewModelInstance(artboard);
+    if (viewModelInstance != nullptr)
+    {
+        if (stateMachine != nullptr)
+        {
+            stateMachine->bindViewModelInstance(viewModelInstance);
+        }
+        else
+        {
+            instance->bindViewModelInstance(viewModelInstance);
+        }
+    }
+    for (int frame = 0; frame < kFrameCount; frame++)
+    {
+        if (stateMachine != nullptr)
+        {
+            stateMachine->advanceAndApply(kFrameSeconds);
+        }
+        else
+        {
+            instance->advance(kFrameSeconds);
+        }
+    }
+
+    std::vector<Mat2D> transforms;
+    for (const Core* object : instance->objects())
+    {
+        if (object != nullptr && object->is<WorldTransformComponent>())
+        {
+            transforms.push_back(
+                object->as<WorldTransformComponent>()->worldTransform());
+        }
+    }
+    return transforms;
+}
+
+static void check_file(const char* rivPath, Factory* factory)
+{
+    std::ifstream rivStream(rivPath, std::ios::binary);
+    std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(rivStream),
+                                  {});
+    const char* fileName = strrchr(rivPath, '/');
+    std::string prefix = std::string(fileName ? fileName + 1 : rivPath) + ": ";
+    auto checkFile = [&](const char* name, bool passed) {
+        check((prefix + name).c_str(), passed);
+    };
+
+    std::unique_ptr<File> eagerFile = File::import(rivBytes, factory);
+    std::unique_ptr<File> lazyFile = File::importLazy(rivBytes, factory);
+    checkFile("import", eagerFile != nullptr && lazyFile != nullptr);
+    if (eagerFile == nullptr || lazyFile == nullptr)
+    {
+        return;
+    }
+    size_t artboardCount = eagerFile->artboardCount();
+    checkFile("artboards",
+              artboardCount > 0 && lazyFile->artboardCount() == artboardCount);
+    if (lazyFile->artboardCount() != artboardCount)
+    {
+        return;
+    }
+
+    bool unloaded = true;
+    for (size_t i = 0; i < artboardCount; i++)
+    {
+        unloaded = unloaded && eagerFile->isArtboardLoaded(i) &&
+                   !lazyFile->isArtboardLoaded(i) &&
+                   lazyFile->artboardNameAt(i) == eagerFile->artboardNameAt(i);
+    }
+    checkFile("unloaded", unloaded);
+
+    bool objects = true;
+    bool nested = true;
+    bool dataBinds = true;
+    bool instances = true;
+    size_t nestedCount = 0;
+    size_t dataBindCount = 0;
+    for (size_t i = 0; i < artboardCount; i++)
+    {
+        Artboard* eager = eagerFile->artboard(i);
+        Artboard* lazy = lazyFile->artboard(i);
+        if (eager == nullptr || lazy == nullptr)
+        {
+            objects = objects && eager == lazy;
+            continue;
+        }
+        objects = objects && lazyFile->isArtboardLoaded(i) &&
+                  objects_match(eager, lazy);
+        nested = nested &&
+                 nested_match(eagerFile.get(), lazyFile.get(), eager, lazy);
+        dataBinds = dataBinds && data_binds_match(eager, lazy);
+        instances = instances &&
+                    advanced_transforms(eagerFile.get(), eager) ==
+                        advanced_transforms(lazyFile.get(), lazy);
+        nestedCount += eager->nestedArtboards().size();
+        dataBindCount += eager->dataBinds().size();
+    }
+    checkFile("objects", objects);
+    checkFile("nested", nested);
+    checkFile("data binds", dataBinds);
+    checkFile("instances", instances);
+
+    constexpr static size_t kThreadCount = 4;
+    std::unique_ptr<File> threadedFile = File::importLazy(rivBytes, factory);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; t++)
+    {
+        // Each thread starts at a different artboard.
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < artboardCount; i++)
+            {
+                size_t index = (i + t) % artboardCount;
+                if (!threadedFile->isArtboardLoaded(index))
+                {
+                    threadedFile->artboard(index);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    bool threaded = true;
+    for (size_t i = 0; i < artboardCount; i++)
+    {
+        Artboard* eager = eagerFile->artboard(i);
+        Artboard* lazy = threadedFile->artboard(i);
+        if (eager == nullptr || lazy == nullptr)
+        {
+            threaded = threaded && eager == lazy;
+            continue;
+        }
+        threaded = threaded && threadedFile->isArtboardLoaded(i) &&
+                   objects_match(eager, lazy);
+    }
+    checkFile("threads", threaded);
+    printf("%s%zu artboards, %zu nested artboards, %zu data binds\n",
+           prefix.c_str(),
+           artboardCount,
+           nestedCount,
+           dataBindCount);
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: lazy_check <file.riv>...\n");
+        return 1;
+    }
+
+    NoOpFactory factory;
+    for (int i = 1; i < argc; i++)
+    {
+        check_file(argv[i], &factory);
+    }
+    return check_exit_status();
+}
@@ -35,8 +35,12 @@ public:
         rive_vkb::load_vulkan();
 
         uint32_t glfwExtensionCount = 0;
-        const char** glfwExtensions;
-        glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+        const char** glfwExtensions = nullptr;
+        if (!m_options.allowHeadlessRendering)
+        {
+            glfwExtensions =
+                glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+        }
 
         m_instance = VKB_CHECK(
             vkb::InstanceBuilder()
@@ -48,6 +52,7 @@ public:
                     m_options.enableVulkanValidationLayers)
 #endif
                 .enable_extensions(glfwExtensionCount, glfwExtensions)
+                .set_headless(m_options.allowHeadlessRendering)
                 .require_api_version(1, options.coreFeaturesOnly ? 0 : 3, 0)
                 .set_minimum_instance_version(1, 0, 0)
                 .build());
@@ -119,6 +124,27 @@ public:
             m_swapchain = nullptr;
         }
 
+        if (m_options.allowHeadlessRendering)
+        {
+            // Render to an offscreen texture instead of a window surface.
+            m_swapchain = std::make_unique<rive_vkb::Swapchain>(
+                m_device,
+                ref_rcp(vk()),
+                width,
+                height,
+                VK_FORMAT_R8G8B8A8_UNORM,
+                m_options.coreFeaturesOnly
+                    ? VK_IMAGE_USAGE_TRANSFER_DST_BIT
+                    : VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT,
+                currentFrameNumber);
+            m_renderTarget =
+                impl()->makeRenderTarget(width,
+                                         height,
+                                         m_swapchain->imageFormat(),
+                                         m_swapchain->imageUsageFlags());
+            return;
+        }
+
         if (m_windowSurface != VK_NULL_HANDLE)
         {
             m_instanceDispatchTable.destroySurfaceKHR(m_windowSurface, nullptr);
@@ -169,6 +169,413 @@ if not _OPTIONS['with-webgpu'] then
             buildoutputs({ '%{cfg.targetdir}/%{file.name}' })
         end
     end
+
+    -- Headless benchmark: renders a corpus of .riv files offscreen and reports
+    -- advance/draw/flush time percentiles. Shares path_fiddle's FiddleContexts.
+    project('rive_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({
+            'include',
+            'path_fiddle',
+            RIVE_RUNTIME_DIR .. '/include',
+            RIVE_RUNTIME_DIR .. '/renderer/src',
+            RIVE_RUNTIME_DIR .. '/renderer/shader_hotload',
+        })
+        externalincludedirs({
+            'glad',
+            RIVE_RUNTIME_DIR .. '/skia/dependencies/glfw/include',
+            yoga,
+        })
+
+        flags({ 'FatalCompileWarnings' })
+
+        defines({ 'YOGA_EXPORT=' })
+
+        files({
+            'rive_bench/**.cpp',
+            'path_fiddle/fiddle_context_*.cpp',
+            'shader_hotload/**.cpp',
+        })
+
+        links({
+            'rive',
+            'rive_pls_renderer',
+            'rive_decoders',
+            'libwebp',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+        filter({ 'options:not no_rive_png' })
+        do
+            links({ 'zlib', 'libpng' })
+        end
+        filter({ 'options:not no_rive_jpeg' })
+        do
+            links({ 'libjpeg' })
+        end
+        filter({})
+
+        if _OPTIONS['with_vulkan'] then
+            dofile('rive_vk_bootstrap/bootstrap_project.lua')
+        end
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+            libdirs({
+                RIVE_RUNTIME_DIR .. '/skia/dependencies/glfw_build/src/Release',
+            })
+            links({ 'glfw3', 'opengl32', 'd3d11', 'dxgi', 'd3dcompiler' })
+        end
+
+        filter('system:macosx')
+        do
+            files({ 'path_fiddle/fiddle_context_*.mm' })
+            buildoptions({ '-fobjc-arc' })
+            links({
+                'glfw3',
+                'Cocoa.framework',
+                'Metal.framework',
+                'QuartzCore.framework',
+                'IOKit.framework',
+            })
+            libdirs({ RIVE_RUNTIME_DIR .. '/skia/dependencies/glfw_build/src' })
+        end
+
+        filter('system:linux')
+        do
+            links({ 'glfw3' })
+            libdirs({ RIVE_RUNTIME_DIR .. '/skia/dependencies/glfw_build/src' })
+        end
+    end
+
+    -- Micro-benchmark for IntersectionBoard over synthetic rectangle
+    -- distributions. Needs no GPU or window.
+    project('intersection_bench')
+    do
+        kind('ConsoleApp')
+        includedirs({
+            RIVE_RUNTIME_DIR .. '/include',
+            RIVE_RUNTIME_DIR .. '/renderer/src',
+        })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({
+            'intersection_bench/**.cpp',
+            'src/intersection_board.cpp',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Micro-benchmark for heap vs. arena artboard instancing. Needs no GPU or
+    -- window.
+    project('instance_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include', RIVE_RUNTIME_DIR })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({
+            'instance_bench/**.cpp',
+            RIVE_RUNTIME_DIR .. '/utils/no_op_factory.cpp',
+        })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Micro-benchmark for the text pipeline on a long paragraph. Needs no GPU
+    -- or window.
+    project('text_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include' })
+
+        flags({ 'FatalCompileWarnings' })
+
+        defines({ 'WITH_RIVE_TEXT' })
+
+        files({ 'text_bench/**.cpp' })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Micro-benchmark for compiling and evaluating formula converters. Needs
+    -- no GPU or window.
+    project('formula_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include' })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({ 'formula_bench/**.cpp' })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Micro-benchmark for solving cubic easing curves one at a time and in
+    -- batches. Needs no GPU or window.
+    project('cubic_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include' })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({ 'cubic_bench/**.cpp' })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Self-checking test for the optional Text update paths, exits with 1 on
+    -- failure. Needs no GPU or window.
+    project('text_check')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include', RIVE_RUNTIME_DIR })
+
+        flags({ 'FatalCompileWarnings' })
+
+        defines({ 'WITH_RIVE_TEXT', 'TESTING' })
+
+        -- The rive library isn't built with TESTING, so the SimpleArray
+        -- counters the TESTING headers refer to come from here.
+        files({
+            'text_check/**.cpp',
+            RIVE_RUNTIME_DIR .. '/src/simple_array.cpp',
+            RIVE_RUNTIME_DIR .. '/utils/no_op_factory.cpp',
+        })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Self-checking test for lazy file imports, exits with 1 on failure. Needs
+    -- no GPU or window.
+    project('lazy_check')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ RIVE_RUNTIME_DIR .. '/include', RIVE_RUNTIME_DIR })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({
+            'lazy_check/**.cpp',
+            RIVE_RUNTIME_DIR .. '/utils/no_op_factory.cpp',
+        })
+
+        links({
+            'rive',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+end
+
+if _OPTIONS['with_cpu_renderer'] then
+    -- Self-checking test for the CPU backend, exits with 1 on failure. Needs
+    -- no GPU or window.
+    project('cpu_check')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ 'include', RIVE_RUNTIME_DIR .. '/include' })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({ 'cpu_check/**.cpp' })
+
+        links({
+            'rive',
+            'rive_pls_renderer',
+            'rive_decoders',
+            'libwebp',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+        filter({ 'options:not no_rive_png' })
+        do
+            links({ 'zlib', 'libpng' })
+        end
+        filter({ 'options:not no_rive_jpeg' })
+        do
+            links({ 'libjpeg' })
+        end
+        filter({})
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
+
+    -- Micro-benchmark for the interior triangulation cache, on the CPU
+    -- backend. Needs no GPU or window.
+    project('triangulation_bench')
+    do
+        dependson('rive')
+        kind('ConsoleApp')
+        includedirs({ 'include', RIVE_RUNTIME_DIR .. '/include' })
+
+        flags({ 'FatalCompileWarnings' })
+
+        files({ 'triangulation_bench/**.cpp' })
+
+        links({
+            'rive',
+            'rive_pls_renderer',
+            'rive_decoders',
+            'libwebp',
+            'rive_harfbuzz',
+            'rive_sheenbidi',
+            'rive_yoga',
+        })
+        filter({ 'options:not no_rive_png' })
+        do
+            links({ 'zlib', 'libpng' })
+        end
+        filter({ 'options:not no_rive_jpeg' })
+        do
+            links({ 'libjpeg' })
+        end
+        filter({})
+
+        filter({ 'toolset:not msc' })
+        do
+            buildoptions({ '-Wshorten-64-to-32' })
+        end
+
+        filter('system:windows')
+        do
+            architecture('x64')
+            defines({ 'RIVE_WINDOWS', '_CRT_SECURE_NO_WARNINGS' })
+        end
+    end
 end
 
 if _OPTIONS['with-webgpu'] or _OPTIONS['with-dawn'] then
@@ -146,6 +146,10 @@ newoption({
     trigger = 'universal-release',
     description = '(Apple only): build a universal binary to release to the store',
 })
+newoption({
+    trigger = 'with_cpu_renderer',
+    description = 'compile the headless CPU reference backend (RenderContextCPUImpl)',
+})
 newoption({
     trigger = 'no_ffp_contract',
     description = 'exclue -ffp-contract=on and -fassociative-math from builoptions',
@@ -164,6 +168,9 @@ do
     flags({ 'FatalCompileWarnings' })
 
     files({ 'src/*.cpp', 'renderer/decoding/*.cpp' })
+    if _OPTIONS['with_cpu_renderer'] then
+        files({ 'src/cpu/*.cpp' })
+    end
 
     if _OPTIONS['with_vulkan'] then
         externalincludedirs({
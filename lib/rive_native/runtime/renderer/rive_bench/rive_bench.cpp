@@ -0,0 +1,661 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Headless renderer benchmark. Renders each .riv file in a corpus offscreen for
+// a fixed number of frames, and reports percentiles of the CPU time spent in
+// advance, draw, and RenderContext::flush() per file.
+//
+//   rive_bench [--gl | --vk | --sw] [--atomic] [--text-atlas] [-n frames]
+//              [--size WxH] [--out results.json] [--baseline baseline.json]
+//              [--threshold percent] <.riv files or directories>...
+//
+// GPU-less Linux CI can run it on the SwiftShader built by make_swiftshader.sh
+// (--sw), or on Mesa llvmpipe (--gl, under Xvfb). Results saved with --out can
+// be passed back in with --baseline, in which case rive_bench exits with a
+// nonzero status if any file's median regressed by more than the threshold.
+//
+// --text-atlas draws small text from the glyph atlas instead of as paths. To
+// compare the two, save a run without it with --out and pass that file as the
+// --baseline of a run with it.
+
+#include "fiddle_context.hpp"
+
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "rive/layout.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/static_scene.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define GLFW_INCLUDE_NONE
+#include "GLFW/glfw3.h"
+
+using namespace rive;
+
+constexpr static char kSwiftShaderICD[] = "dependencies/SwiftShader/build/"
+#ifdef __APPLE__
+                                          "Darwin"
+#elif defined(_WIN32)
+                                          "Windows"
+#else
+                                          "Linux"
+#endif
+                                          "/vk_swiftshader_icd.json";
+
+// Frames rendered before timing starts, so shader compilation and resource
+// allocation don't show up in the results.
+constexpr static int kWarmupFrames = 10;
+
+// Medians below this many milliseconds apart are considered noise when
+// comparing against a baseline.
+constexpr static double kNoiseFloorMs = .01;
+
+enum class API
+{
+    gl,
+    vulkan,
+};
+
+struct Percentiles
+{
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+};
+
+// A .riv file to benchmark. Results are keyed by the path relative to the
+// directory given on the command line (or by the path as given, for files), so
+// baselines match across checkouts and same-named files in different
+// subdirectories don't collide.
+struct RivFile
+{
+    std::string path;
+    std::string key;
+};
+
+// Percentiles of each file's per-frame timings, in milliseconds.
+struct Result
+{
+    std::string file;
+    Percentiles advance;
+    Percentiles draw;
+    Percentiles flush;
+};
+
+struct Metric
+{
+    const char* name;
+    Percentiles Result::*percentiles;
+};
+
+constexpr static Metric kMetrics[] = {
+    {"advance", &Result::advance},
+    {"draw", &Result::draw},
+    {"flush", &Result::flush},
+};
+
+static double seconds_now()
+{
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void set_environment_variable(const char* name, const char* value)
+{
+#ifdef _WIN32
+    SetEnvironmentVariableA(name, value);
+#else
+    setenv(name, value, /*overwrite=*/true);
+#endif
+}
+
+static Percentiles compute_percentiles(std::vector<double> samplesMs)
+{
+    Percentiles percentiles;
+    if (samplesMs.empty())
+    {
+        return percentiles;
+    }
+    std::sort(samplesMs.begin(), samplesMs.end());
+    // Nearest rank.
+    auto at = [&samplesMs](double p) {
+        size_t rank = static_cast<size_t>(p * samplesMs.size());
+        return samplesMs[std::min(rank, samplesMs.size() - 1)];
+    };
+    percentiles.p50 = at(.5);
+    percentiles.p90 = at(.9);
+    percentiles.p99 = at(.99);
+    return percentiles;
+}
+
+class Bench
+{
+public:
+    Bench(API api, GLFWwindow* window, int width, int height, bool atomic) :
+        m_window(window), m_width(width), m_height(height), m_atomic(atomic)
+    {
+        FiddleContextOptions options;
+        options.allowHeadlessRendering = true;
+        options.disableRasterOrdering = atomic;
+        m_fiddleContext = api == API::vulkan
+                              ? FiddleContext::MakeVulkanPLS(options)
+                              : FiddleContext::MakeGLPLS(options);
+        if (m_fiddleContext != nullptr)
+        {
+            m_fiddleContext->onSizeChanged(m_window, m_width, m_height, 0);
+            m_renderer = m_fiddleContext->makeRenderer(m_width, m_height);
+        }
+    }
+
+    bool valid() const { return m_fiddleContext != nullptr; }
+
+    bool run(const RivFile& rivFile, int frameCount, Result* result)
+    {
+        const std::string& rivPath = rivFile.path;
+        std::ifstream rivStream(rivPath, std::ios::binary);
+        std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(rivStream),
+                                      {});
+        std::unique_ptr<File> file =
+            File::import(rivBytes, m_fiddleContext->factory());
+        if (file == nullptr)
+        {
+            fprintf(stderr, "%s: failed to import\n", rivPath.c_str());
+            return false;
+        }
+
+        std::unique_ptr<ArtboardInstance> artboard = file->artboardDefault();
+        if (artboard == nullptr)
+        {
+            fprintf(stderr, "%s: no artboard\n", rivPath.c_str());
+            return false;
+        }
+        std::unique_ptr<Scene> scene = artboard->stateMachineAt(0);
+        if (scene == nullptr)
+        {
+            scene = artboard->animationAt(0);
+        }
+        if (scene == nullptr)
+        {
+            scene = std::make_unique<StaticScene>(artboard.get());
+        }
+        rcp<ViewModelInstance> viewModelInstance =
+            file->createViewModelInstance(artboard.get());
+        artboard->bindViewModelInstance(viewModelInstance);
+        if (viewModelInstance != nullptr)
+        {
+            scene->bindViewModelInstance(viewModelInstance);
+        }
+
+        Mat2D alignment = computeAlignment(Fit::contain,
+                                           Alignment::center,
+                                           AABB(0, 0, m_width, m_height),
+                                           artboard->bounds());
+
+        std::vector<double> advanceMs, drawMs, flushMs;
+        advanceMs.reserve(frameCount);
+        drawMs.reserve(frameCount);
+        flushMs.reserve(frameCount);
+        for (int i = -kWarmupFrames; i < frameCount; ++i)
+        {
+            double t0 = seconds_now();
+            scene->advanceAndApply(1 / 60.f);
+            double t1 = seconds_now();
+
+            m_fiddleContext->begin({
+                .renderTargetWidth = static_cast<uint32_t>(m_width),
+                .renderTargetHeight = static_cast<uint32_t>(m_height),
+                .clearColor = 0xff303030,
+                .disableRasterOrdering = m_atomic,
+            });
+            double t2 = seconds_now();
+            m_renderer->save();
+            m_renderer->transform(alignment);
+            scene->draw(m_renderer.get());
+            m_renderer->restore();
+            double t3 = seconds_now();
+
+            m_fiddleContext->end(m_window);
+            if (m_window != nullptr)
+            {
+                glfwSwapBuffers(m_window);
+            }
+
+            if (i >= 0)
+            {
+                advanceMs.push_back((t1 - t0) * 1e3);
+                drawMs.push_back((t3 - t2) * 1e3);
+                flushMs.push_back(m_fiddleContext->renderContextOrNull()
+                                      ->lastFlushStats()
+                                      .totalSeconds *
+                                  1e3);
+            }
+        }
+
+        result->file = rivFile.key;
+        result->advance = compute_percentiles(std::move(advanceMs));
+        result->draw = compute_percentiles(std::move(drawMs));
+        result->flush = compute_percentiles(std::move(flushMs));
+        return true;
+    }
+
+private:
+    GLFWwindow* const m_window;
+    const int m_width;
+    const int m_height;
+    const bool m_atomic;
+    std::unique_ptr<FiddleContext> m_fiddleContext;
+    std::unique_ptr<Renderer> m_renderer;
+};
+
+static std::string json_escape(const std::string& str)
+{
+    std::string escaped;
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped.push_back('\\');
+            escaped.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char code[7];
+            snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        }
+        else
+        {
+            escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+// Reads a string written by json_escape(), starting just after its opening
+// quote.
+static bool read_json_string(const std::string& line,
+                             size_t start,
+                             std::string* str)
+{
+    str->clear();
+    for (size_t i = start; i < line.size(); ++i)
+    {
+        if (line[i] == '"')
+        {
+            return true;
+        }
+        if (line[i] != '\\')
+        {
+            str->push_back(line[i]);
+        }
+        else if (i + 1 < line.size() && line[i + 1] == 'u')
+        {
+            str->push_back(
+                static_cast<char>(strtol(line.substr(i + 2, 4).c_str(),
+                                         nullptr,
+                                         16)));
+            i += 5;
+        }
+        else if (++i < line.size())
+        {
+            str->push_back(line[i]);
+        }
+    }
+    return false;
+}
+
+static void write_results(FILE* out,
+                          const char* apiName,
+                          int frameCount,
+                          const std::vector<Result>& results)
+{
+    // One file per line, so read_baseline() doesn't need a JSON parser.
+    fprintf(out,
+            "{\"api\": \"%s\", \"frames\": %i, \"files\": [\n",
+            apiName,
+            frameCount);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+        fprintf(out,
+                "  {\"file\": \"%s\"",
+                json_escape(result.file).c_str());
+        for (const Metric& metric : kMetrics)
+        {
+            const Percentiles& p = result.*metric.percentiles;
+            fprintf(out,
+                    ", \"%s_ms\": {\"p50\": %.4f, \"p90\": %.4f, "
+                    "\"p99\": %.4f}",
+                    metric.name,
+                    p.p50,
+                    p.p90,
+                    p.p99);
+        }
+        fprintf(out, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "]}\n");
+}
+
+// Finds '"key": <number>' after 'start' in a line written by write_results().
+static bool find_number(const std::string& line,
+                        size_t start,
+                        const std::string& key,
+                        double* value)
+{
+    size_t pos = line.find('"' + key + "\":", start);
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+    *value = strtod(line.c_str() + pos + key.size() + 3, nullptr);
+    return true;
+}
+
+static std::vector<Result> read_baseline(const char* path)
+{
+    std::vector<Result> baseline;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        constexpr static char kFileKey[] = "{\"file\": \"";
+        size_t fileStart = line.find(kFileKey);
+        if (fileStart == std::string::npos)
+        {
+            continue;
+        }
+        fileStart += strlen(kFileKey);
+        Result result;
+        bool valid = read_json_string(line, fileStart, &result.file);
+        for (const Metric& metric : kMetrics)
+        {
+            size_t metricStart =
+                line.find('"' + std::string(metric.name) + "_ms\"");
+            Percentiles& p = result.*metric.percentiles;
+            valid = valid && metricStart != std::string::npos &&
+                    find_number(line, metricStart, "p50", &p.p50) &&
+                    find_number(line, metricStart, "p90", &p.p90) &&
+                    find_number(line, metricStart, "p99", &p.p99);
+        }
+        if (valid)
+        {
+            baseline.push_back(std::move(result));
+        }
+    }
+    return baseline;
+}
+
+// Prints each file's change in median from the baseline. Returns the number of
+// medians that regressed by more than thresholdPercent.
+static int compare_to_baseline(const std::vector<Result>& results,
+                               const std::vector<Result>& baseline,
+                               double thresholdPercent)
+{
+    int regressionCount = 0;
+    printf("\n%-32s %8s %10s %10s %8s\n",
+           "vs. baseline (p50)",
+           "",
+           "base ms",
+           "ms",
+           "change");
+    for (const Result& result : results)
+    {
+        auto base = std::find_if(baseline.begin(),
+                                 baseline.end(),
+                                 [&result](const Result& b) {
+                                     return b.file == result.file;
+                                 });
+        if (base == baseline.end())
+        {
+            printf("%-32s (not in baseline)\n", result.file.c_str());
+            continue;
+        }
+        for (const Metric& metric : kMetrics)
+        {
+            double before = ((*base).*metric.percentiles).p50;
+            double after = (result.*metric.percentiles).p50;
+            double change =
+                before > 0 ? (after - before) / before * 100 : 0;
+            bool regressed = change > thresholdPercent &&
+                             after - before > kNoiseFloorMs;
+            regressionCount += regressed;
+            printf("%-32s %8s %10.3f %10.3f %+7.1f%%%s\n",
+                   result.file.c_str(),
+                   metric.name,
+                   before,
+                   after,
+                   change,
+                   regressed ? "  REGRESSED" : "");
+        }
+    }
+    return regressionCount;
+}
+
+static void collect_riv_files(const char* arg, std::vector<RivFile>* out)
+{
+    std::filesystem::path path(arg);
+    if (!std::filesystem::is_directory(path))
+    {
+        out->push_back({path.string(), path.generic_string()});
+        return;
+    }
+    std::vector<RivFile> files;
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(path))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".riv")
+        {
+            files.push_back(
+                {entry.path().string(),
+                 entry.path().lexically_relative(path).generic_string()});
+        }
+    }
+    // Directory iteration order is unspecified.
+    std::sort(files.begin(),
+              files.end(),
+              [](const RivFile& a, const RivFile& b) { return a.key < b.key; });
+    out->insert(out->end(), files.begin(), files.end());
+}
+
+int main(int argc, const char** argv)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    setvbuf(stderr, NULL, _IONBF, 0);
+
+    API api = API::gl;
+    const char* apiName = "gl";
+    bool atomic = false;
+    int frameCount = 300;
+    int width = 1024, height = 1024;
+    const char* outPath = nullptr;
+    const char* baselinePath = nullptr;
+    double thresholdPercent = 10;
+    std::vector<RivFile> rivFiles;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--gl"))
+        {
+            api = API::gl;
+            apiName = "gl";
+        }
+        else if (!strcmp(argv[i], "--vulkan") || !strcmp(argv[i], "--vk"))
+        {
+            api = API::vulkan;
+            apiName = "vulkan";
+        }
+        else if (!strcmp(argv[i], "--sw") || !strcmp(argv[i], "--swiftshader"))
+        {
+            // Use the swiftshader built by
+            // packages/runtime/renderer/make_swiftshader.sh
+            set_environment_variable("VK_ICD_FILENAMES", kSwiftShaderICD);
+            api = API::vulkan;
+            apiName = "swiftshader";
+        }
+        else if (!strcmp(argv[i], "--atomic"))
+        {
+            atomic = true;
+        }
+        else if (!strcmp(argv[i], "--text-atlas"))
+        {
+            Artboard::gDefaultTextRenderMode = TextRenderMode::glyphAtlas;
+        }
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%ix%i", &width, &height) != 2 ||
+                width <= 0 || height <= 0)
+            {
+                fprintf(stderr, "invalid --size: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+        {
+            outPath = argv[++i];
+        }
+        else if (!strcmp(argv[i], "--baseline") && i + 1 < argc)
+        {
+            baselinePath = argv[++i];
+        }
+        else if (!strcmp(argv[i], "--threshold") && i + 1 < argc)
+        {
+            thresholdPercent = atof(argv[++i]);
+        }
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+        else
+        {
+            collect_riv_files(argv[i], &rivFiles);
+        }
+    }
+    if (rivFiles.empty())
+    {
+        fprintf(stderr,
+                "usage: rive_bench [--gl | --vk | --sw] [--atomic] "
+                "[--text-atlas] [-n frames] [--size WxH] [--out results.json] "
+                "[--baseline baseline.json] [--threshold percent] "
+                "<.riv files or directories>...\n");
+        return 1;
+    }
+
+    // GL needs a context, which GLFW only provides through a window. Keep it
+    // hidden. Vulkan renders to an offscreen texture and needs no window.
+    GLFWwindow* window = nullptr;
+    if (api == API::gl)
+    {
+        if (!glfwInit())
+        {
+            fprintf(stderr, "Failed to initialize glfw.\n");
+            return 1;
+        }
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+        window =
+            glfwCreateWindow(width, height, "rive_bench", nullptr, nullptr);
+        if (!window)
+        {
+            glfwTerminate();
+            fprintf(stderr, "Failed to create a GL context.\n");
+            return 1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSwapInterval(0);
+    }
+
+    std::vector<Result> results;
+    {
+        Bench bench(api, window, width, height, atomic);
+        if (!bench.valid())
+        {
+            fprintf(stderr, "Failed to create a fiddle context.\n");
+            return 1;
+        }
+        printf("%-32s %8s %10s %10s %10s\n",
+               apiName,
+               "",
+               "p50 ms",
+               "p90 ms",
+               "p99 ms");
+        for (const RivFile& rivFile : rivFiles)
+        {
+            Result result;
+            if (!bench.run(rivFile, frameCount, &result))
+            {
+                continue;
+            }
+            for (const Metric& metric : kMetrics)
+            {
+                const Percentiles& p = result.*metric.percentiles;
+                printf("%-32s %8s %10.3f %10.3f %10.3f\n",
+                       result.file.c_str(),
+                       metric.name,
+                       p.p50,
+                       p.p90,
+                       p.p99);
+            }
+            results.push_back(std::move(result));
+        }
+    }
+
+    if (window != nullptr)
+    {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+    }
+
+    if (outPath != nullptr)
+    {
+        FILE* out = fopen(outPath, "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open %s\n", outPath);
+            return 1;
+        }
+        write_results(out, apiName, frameCount, results);
+        fclose(out);
+    }
+
+    if (baselinePath != nullptr)
+    {
+        std::vector<Result> baseline = read_baseline(baselinePath);
+        if (baseline.empty())
+        {
+            fprintf(stderr, "No results found in %s\n", baselinePath);
+            return 1;
+        }
+        int regressionCount =
+            compare_to_baseline(results, baseline, thresholdPercent);
+        if (regressionCount != 0)
+        {
+            printf("\n%i median(s) regressed by more than %g%%.\n",
+                   regressionCount,
+                   thresholdPercent);
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "atlas_cache.hpp"
+
+#include <functional>
+
+namespace rive::gpu
+{
+bool AtlasCacheKey::operator==(const AtlasCacheKey& other) const
+{
+    return rawPathMutationID == other.rawPathMutationID &&
+           matrix == other.matrix && visibleBounds == other.visibleBounds &&
+           strokeRadius == other.strokeRadius &&
+           featherRadius == other.featherRadius &&
+           fillRule == other.fillRule && strokeJoin == other.strokeJoin &&
+           strokeCap == other.strokeCap &&
+           contourDirections == other.contourDirections &&
+           contourFlags == other.contourFlags;
+}
+
+size_t AtlasCache::KeyHash::operator()(const AtlasCacheKey& key) const
+{
+    // Mutation IDs are unique across all paths, the rest of the key rarely
+    // differs between entries with the same ID.
+    size_t hash = std::hash<uint64_t>()(key.rawPathMutationID);
+    for (int i = 0; i < 6; ++i)
+    {
+        hash = hash * 31 + std::hash<float>()(key.matrix[i]);
+    }
+    return hash * 31 + std::hash<float>()(key.featherRadius);
+}
+
+void AtlasCache::beginFrame(uint16_t width, uint16_t height)
+{
+    if (width == 0 || height == 0)
+    {
+        clear();
+        m_band = nullptr;
+    }
+    else if (m_band == nullptr || m_band->width() != width ||
+             m_band->height() != height)
+    {
+        m_band = std::make_unique<skgpu::RectanizerSkyline>(width, height);
+        clear();
+    }
+    std::swap(m_candidates, m_lastFrameCandidates);
+    m_candidates.clear();
+}
+
+const AtlasCache::Entry* AtlasCache::findOrInsert(const AtlasCacheKey& key,
+                                                  uint16_t drawWidth,
+                                                  uint16_t drawHeight,
+                                                  uint16_t padding,
+                                                  bool* needsRender)
+{
+    assert(enabled());
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        m_lastReferencedFlush = m_currentFlush;
+        *needsRender = false;
+        ++m_hitCount;
+        return &it->second;
+    }
+
+    ++m_missCount;
+    // Remember every miss, so a mask that gets admitted but then loses its
+    // region (e.g., to an atlas resize) can be admitted again next frame.
+    m_candidates.insert(key);
+    if (m_lastFrameCandidates.count(key) == 0)
+    {
+        // Wait and see if the mask is still the same next frame.
+        return nullptr;
+    }
+
+    int paddedWidth = drawWidth + padding * 2;
+    int paddedHeight = drawHeight + padding * 2;
+    int16_t ix, iy;
+    if (!m_band->addRect(paddedWidth, paddedHeight, &ix, &iy))
+    {
+        if (m_lastReferencedFlush == m_currentFlush ||
+            paddedWidth > m_band->width() || paddedHeight > m_band->height())
+        {
+            return nullptr;
+        }
+        // The band is full. Start it over, since nothing in the current
+        // logical flush reads from it yet.
+        clear();
+        if (!m_band->addRect(paddedWidth, paddedHeight, &ix, &iy))
+        {
+            return nullptr;
+        }
+    }
+
+    Entry& entry = m_entries[key];
+    entry.x = ix + padding;
+    entry.y = iy + padding;
+    entry.paddedRegion = {ix, iy, ix + paddedWidth, iy + paddedHeight};
+    m_lastReferencedFlush = m_currentFlush;
+    *needsRender = true;
+    return &entry;
+}
+
+void AtlasCache::erase(const AtlasCacheKey& key) { m_entries.erase(key); }
+
+void AtlasCache::clear()
+{
+    m_entries.clear();
+    if (m_band != nullptr)
+    {
+        m_band->reset();
+    }
+    ++m_generation;
+}
+} // namespace rive::gpu
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include "rive/math/aabb.hpp"
+#include "rive/math/mat2d.hpp"
+#include "rive/math/path_types.hpp"
+#include "rive/renderer/gpu.hpp"
+#include "rive/renderer/sk_rectanizer_skyline.hpp"
+#include "rive/shapes/paint/stroke_cap.hpp"
+#include "rive/shapes/paint/stroke_join.hpp"
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rive::gpu
+{
+// Everything that determines the contents of a path's coverage mask in the
+// feather atlas.
+struct AtlasCacheKey
+{
+    uint64_t rawPathMutationID;
+    Mat2D matrix;
+    IAABB visibleBounds;
+    float strokeRadius;
+    float featherRadius;
+    FillRule fillRule;
+    StrokeJoin strokeJoin;
+    StrokeCap strokeCap;
+    gpu::ContourDirections contourDirections;
+    uint32_t contourFlags;
+
+    bool operator==(const AtlasCacheKey&) const;
+};
+
+// Keeps the coverage masks of feathered paths alive in the atlas across
+// flushes, so static soft shadows and glows only get tessellated and rendered
+// to the atlas once.
+//
+// Cached masks are packed into a band of rows at the top of the atlas that
+// atlas passes don't clear. A mask is only admitted once its key has been drawn
+// in two consecutive frames, so animated content doesn't churn the band. The
+// band can't free individual regions, so once it fills up, it gets reset all
+// at once -- but never while the current logical flush still references it.
+//
+// The caller is responsible for dropping the cache whenever the atlas texture
+// gets reallocated, since that discards its contents.
+class AtlasCache
+{
+public:
+    struct Entry
+    {
+        uint16_t x;
+        uint16_t y;
+        TAABB<uint16_t> paddedRegion;
+    };
+
+    explicit AtlasCache(uint32_t capacity) : m_capacity(capacity) {}
+
+    // Number of atlas rows reserved for cached masks. 0 disables the cache.
+    void setCapacity(uint32_t capacity) { m_capacity = capacity; }
+    uint32_t capacity() const { return m_capacity; }
+
+    // Sizes the band for the upcoming frame, dropping every entry if its size
+    // changed. A zero width or height disables the cache for the frame.
+    void beginFrame(uint16_t width, uint16_t height);
+
+    // Regions used on or after this logical flush can't be reset.
+    void beginLogicalFlush() { ++m_currentFlush; }
+
+    bool enabled() const { return m_band != nullptr; }
+    uint16_t width() const { return static_cast<uint16_t>(m_band->width()); }
+    uint16_t height() const
+    {
+        return static_cast<uint16_t>(m_band->height());
+    }
+
+    // Incremented every time the band is reset. The first flush that renders
+    // into a new generation also has to clear the band.
+    uint64_t generation() const { return m_generation; }
+    uint64_t clearedGeneration() const { return m_clearedGeneration; }
+    void markCleared(uint64_t generation)
+    {
+        assert(generation >= m_clearedGeneration);
+        m_clearedGeneration = generation;
+    }
+
+    // Returns the cached mask for key, or reserves a region for it. Sets
+    // *needsRender if the region doesn't hold the mask yet.
+    //
+    // Returns null if the mask isn't cached and shouldn't be (yet), or if the
+    // band is full and the current logical flush already references it.
+    const Entry* findOrInsert(const AtlasCacheKey&,
+                              uint16_t drawWidth,
+                              uint16_t drawHeight,
+                              uint16_t padding,
+                              bool* needsRender);
+
+    // Forgets a mask that was reserved by findOrInsert() but will never get
+    // rendered. Its region stays unavailable until the band is reset.
+    void erase(const AtlasCacheKey&);
+
+    // Drops every entry and resets the band.
+    void clear();
+
+    size_t hitCount() const { return m_hitCount; }
+    size_t missCount() const { return m_missCount; }
+    size_t entryCount() const { return m_entries.size(); }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const AtlasCacheKey&) const;
+    };
+
+    uint32_t m_capacity;
+    uint64_t m_currentFlush = 0;
+    uint64_t m_lastReferencedFlush = 0;
+    uint64_t m_generation = 1;
+    uint64_t m_clearedGeneration = 0;
+    size_t m_hitCount = 0;
+    size_t m_missCount = 0;
+
+    std::unique_ptr<skgpu::RectanizerSkyline> m_band;
+    std::unordered_map<AtlasCacheKey, Entry, KeyHash> m_entries;
+
+    // Keys that missed during the current and previous frames.
+    std::unordered_set<AtlasCacheKey, KeyHash> m_candidates;
+    std::unordered_set<AtlasCacheKey, KeyHash> m_lastFrameCandidates;
+};
+} // namespace rive::gpu
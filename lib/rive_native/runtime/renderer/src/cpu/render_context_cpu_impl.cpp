@@ -0,0 +1,2700 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/renderer/cpu/render_context_cpu_impl.hpp"
+
+#include "rive/renderer/flush_task_scheduler.hpp"
+#include "rive/renderer/texture.hpp"
+#include "shaders/constants.glsl"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+// The functions in this file are line-by-line ports of the shaders in
+// src/shaders/. When a shader changes, its port here needs to change too.
+namespace rive::gpu
+{
+namespace
+{
+// Mirrors of the (non-exported) defines in common.glsl and
+// draw_path_common.glsl.
+constexpr static float kAARadius = .5f;
+constexpr static float kFeatherCoverageBias = -2.f;
+constexpr static float kFeatherCoverageThreshold = -1.5f;
+constexpr static float kFeatherXCoordBias = .25f;
+constexpr static float kHorizontalCotangentThreshold = 1e3f;
+constexpr static float kHorizontalCotangentValue =
+    kHorizontalCotangentThreshold * kHorizontalCotangentThreshold;
+
+// Work is handed to the task scheduler in chunks of this many items, so the
+// scheduling overhead stays small relative to the work.
+constexpr static size_t kTessSpansPerTask = 256;
+constexpr static size_t kInstancesPerTask = 64;
+constexpr static size_t kTrianglesPerTask = 1024;
+
+void parallel_for(FlushTaskScheduler* scheduler,
+                  size_t count,
+                  const std::function<void(size_t)>& fn)
+{
+    if (scheduler != nullptr && count > 1)
+    {
+        scheduler->parallelFor(count, fn);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            fn(i);
+        }
+    }
+}
+
+// Calls fn(begin, end) on chunks of [0, count), in parallel when a scheduler
+// is available.
+void parallel_for_chunks(FlushTaskScheduler* scheduler,
+                         size_t count,
+                         size_t chunkSize,
+                         const std::function<void(size_t, size_t)>& fn)
+{
+    size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    parallel_for(scheduler, chunkCount, [&](size_t chunkIdx) {
+        size_t begin = chunkIdx * chunkSize;
+        fn(begin, std::min(begin + chunkSize, count));
+    });
+}
+
+template <typename T> const T* ring_contents(BufferRing* ring)
+{
+    return ring != nullptr ? reinterpret_cast<const T*>(
+                                 static_cast<HeapBufferRing*>(ring)->contents())
+                           : nullptr;
+}
+
+RIVE_ALWAYS_INLINE float sign_of(float x)
+{
+    return x > 0 ? 1.f : x < 0 ? -1.f : 0.f;
+}
+
+RIVE_ALWAYS_INLINE float2 bits_to_float2(uint32_t x, uint32_t y)
+{
+    return float2{math::bit_cast<float>(x), math::bit_cast<float>(y)};
+}
+
+RIVE_ALWAYS_INLINE float4 bits_to_float4(uint4 bits)
+{
+    return math::bit_cast<float4>(bits);
+}
+
+// MUL(float2x2(m.xy, m.zw), v).
+RIVE_ALWAYS_INLINE float2 mul(float4 m, float2 v)
+{
+    return float2{m.x, m.y} * v.x + float2{m.z, m.w} * v.y;
+}
+
+RIVE_ALWAYS_INLINE float length(float2 v)
+{
+    return std::sqrt(simd::dot(v, v));
+}
+
+// Solves "dot(a, r) == k.x && dot(b, r) == k.y" for r.
+RIVE_ALWAYS_INLINE float2 solve_dot_system(float2 a, float2 b, float2 k)
+{
+    float det = a.x * b.y - a.y * b.x;
+    return float2{k.x * b.y - a.y * k.y, a.x * k.y - k.x * b.x} / det;
+}
+
+// Returns the angle of v, in the range [-pi, pi].
+RIVE_ALWAYS_INLINE float vector_angle(float2 v)
+{
+    v /= length(v);
+    float theta = std::acos(std::clamp(v.x, -1.f, 1.f));
+    return v.y >= 0 ? theta : -theta;
+}
+
+RIVE_ALWAYS_INLINE float4 unpack_unorm4x8(uint32_t rgba)
+{
+    uint4 c = (uint4(rgba) >> uint4{0, 8, 16, 24}) & 0xffu;
+    return simd::cast<float>(c) * (1.f / 255);
+}
+
+RIVE_ALWAYS_INLINE uint32_t pack_unorm4x8(float4 color)
+{
+    uint4 c = simd::cast<uint32_t>(simd::clamp(color, float4(0), float4(1)) *
+                                       255.f +
+                                   .5f);
+    return c.x | (c.y << 8) | (c.z << 16) | (c.w << 24);
+}
+
+RIVE_ALWAYS_INLINE float4 unmultiply(float4 premul)
+{
+    float4 color = premul * (premul.w != 0 ? 1.f / premul.w : 0.f);
+    color.w = premul.w;
+    return color;
+}
+
+RIVE_ALWAYS_INLINE float4 premultiply(float4 color)
+{
+    float4 premul = color * color.w;
+    premul.w = color.w;
+    return premul;
+}
+
+// Linearly filtered lookups into the gaussian integral tables, sampled the
+// same way the shaders sample @featherTexture.
+class FeatherTable
+{
+public:
+    FeatherTable(const uint16_t (&tableF16)[GAUSSIAN_TABLE_SIZE])
+    {
+        for (uint32_t i = 0; i < GAUSSIAN_TABLE_SIZE; i += 4)
+        {
+            simd::store(m_table + i,
+                        cast_f16_to_f32(simd::load<uint16_t, 4>(tableF16 + i)));
+        }
+    }
+
+    float operator()(float x) const
+    {
+        float texelCoord = x * GAUSSIAN_TABLE_SIZE - .5f;
+        // (Also catches NaN.)
+        texelCoord = texelCoord > 0 ? texelCoord : 0;
+        texelCoord = std::min(texelCoord, float(GAUSSIAN_TABLE_SIZE - 1));
+        float texelFloor = std::floor(texelCoord);
+        uint32_t i = static_cast<uint32_t>(texelFloor);
+        uint32_t j = std::min(i + 1, GAUSSIAN_TABLE_SIZE - 1);
+        return lerp(m_table[i], m_table[j], texelCoord - texelFloor);
+    }
+
+private:
+    float m_table[GAUSSIAN_TABLE_SIZE];
+};
+
+float feather(float x)
+{
+    static const FeatherTable table(g_gaussianIntegralTableF16);
+    return table(x);
+}
+
+float inverse_feather(float x)
+{
+    static const FeatherTable table(g_inverseGaussianIntegralTableF16);
+    return table(x);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// bezier_utils.glsl
+
+float cosine_between_vectors(float2 a, float2 b)
+{
+    float ab_cosTheta = simd::dot(a, b);
+    float ab_pow2 = simd::dot(a, a) * simd::dot(b, b);
+    return ab_pow2 == 0 ? 1.f
+                        : std::clamp(ab_cosTheta / std::sqrt(ab_pow2),
+                                     -1.f,
+                                     1.f);
+}
+
+void find_cubic_tangents(const float2 p[4], float2 tangents[2])
+{
+    tangents[0] = (simd::any(p[0] != p[1])   ? p[1]
+                   : simd::any(p[1] != p[2]) ? p[2]
+                                             : p[3]) -
+                  p[0];
+    tangents[1] = p[3] - (simd::any(p[3] != p[2])   ? p[2]
+                          : simd::any(p[2] != p[1]) ? p[1]
+                                                    : p[0]);
+}
+
+float measure_cubic_local_curvature(const float2 p[4],
+                                    float T,
+                                    float desiredSpread)
+{
+    float2 C = p[1] - p[0];
+    float2 D = p[2] - p[1];
+    float2 E = p[3] - p[0];
+    float2 B = D - C;
+    float2 A = -3.f * D + E;
+
+    float2 tangent = 3.f * ((A * T + 2.f * B) * T + C);
+    float lengthTangent = length(tangent);
+    if (lengthTangent == 0)
+    {
+        return 0;
+    }
+    tangent *= 1.f / lengthTangent;
+
+    // Find the spread of the curve around T, projected onto the tangent.
+    float A_ = 2.f * simd::dot(A, tangent);
+    float C_ = 3.f * (A_ * T + 4.f * simd::dot(B, tangent)) * T +
+               6.f * simd::dot(C, tangent);
+    float maxDT = std::min(T, 1.f - T);
+    float maxSpread = (A_ * maxDT * maxDT + C_) * maxDT;
+    float targetSpread = std::min(desiredSpread, maxSpread * .9999f);
+
+    // Solve A_*dt^3 + C_*dt - targetSpread == 0.
+    float dt;
+    if (A_ == 0)
+    {
+        dt = targetSpread / C_;
+    }
+    else
+    {
+        float r = 1.f / A_;
+        float b = C_ * r;
+        float c = -targetSpread * r;
+        float Q = b * (-1.f / 3);
+        float R = .5f * c;
+        float discr = R * R - Q * Q * Q;
+        if (discr < 0)
+        {
+            float sqrtQ = std::sqrt(Q);
+            float theta = std::acos(R / (sqrtQ * sqrtQ * sqrtQ));
+            dt = -2.f * sqrtQ *
+                 std::cos(theta * (1.f / 3) + (-2.f / 3 * math::PI));
+        }
+        else
+        {
+            float cubeRoot = std::cbrt(std::abs(R) + std::sqrt(discr));
+            if (R < 0)
+            {
+                cubeRoot = -cubeRoot;
+            }
+            dt = cubeRoot != 0 ? cubeRoot + Q / cubeRoot : 0;
+        }
+    }
+    dt = std::abs(dt);
+
+    float4 t0011 = T + float4{-dt, -dt, dt, dt};
+    float4 A4 = {A.x, A.y, A.x, A.y};
+    float4 B4 = {B.x, B.y, B.x, B.y};
+    float4 C4 = {C.x, C.y, C.x, C.y};
+    float4 tanDirs = (A4 * t0011 + 2.f * B4) * t0011 + C4;
+
+    float2 endTangents[2];
+    find_cubic_tangents(p, endTangents);
+    float2 tan0 =
+        t0011.x < 1e-3f ? endTangents[0] : float2{tanDirs.x, tanDirs.y};
+    float2 tan1 =
+        t0011.z > 1.f - 1e-3f ? endTangents[1] : float2{tanDirs.z, tanDirs.w};
+    return std::acos(cosine_between_vectors(tan0, tan1));
+}
+
+float clamped_divide(float a, float b)
+{
+    a = b < 0 ? -a : a;
+    b = std::abs(b);
+    return a > 0 ? (a < b ? a / b : 1.f) : 0.f;
+}
+
+float find_cubic_max_height(const float2 p[4], float& outT)
+{
+    float2 base = p[3] - p[0];
+    float baseLength = length(base);
+    if (baseLength == 0)
+    {
+        outT = .5f;
+        return 0;
+    }
+    float2 norm = float2{-base.y, base.x} / baseLength;
+    float h2 = simd::dot(norm, p[2] - p[0]);
+    float h1 = simd::dot(norm, p[1] - p[0]);
+    float dh = h1 - h2;
+    float _3A = 3.f * dh;
+    float B = -h1 - dh;
+    float C = h1;
+    float t = .5f;
+    for (int i = 0; i < 3; ++i)
+    {
+        t = clamped_divide(_3A * t * t - C, 2.f * (_3A * t + B));
+    }
+    outT = t;
+    return std::abs(t * (t * (t * _3A + 3.f * B) + 3.f * C));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// draw_path_common.glsl (fragment helpers)
+
+float eval_feathered_fill(float4 coverages)
+{
+    float cotTheta = coverages.z;
+    float y0 = std::max(coverages.w, 0.f);
+    float featherCoverage = cotTheta >= 0 ? feather(y0) : 0.f;
+    if (std::abs(cotTheta) < kHorizontalCotangentThreshold)
+    {
+        float x = std::abs(coverages.x) - kFeatherXCoordBias;
+        float y = -coverages.y + kFeatherCoverageBias;
+        // Integrate the feather from y0 to y along the sloped edge, using 4
+        // gaussian quadrature samples.
+        float dt = (y - y0) * 0.5984134206f;
+        float4 t = y0 + dt * float4{0.20888568955f,
+                                    0.62665706865f,
+                                    1.04442844776f,
+                                    1.46219982687f};
+        float4 u = t * -cotTheta + (y * cotTheta + x);
+        float4 feathers = {feather(u.x),
+                           feather(u.y),
+                           feather(u.z),
+                           feather(u.w)};
+        float4 t_ = t * 5.09593080173f - 2.54796540086f;
+        float4 weights = -t_ * t_;
+        weights = {std::exp2(weights.x),
+                   std::exp2(weights.y),
+                   std::exp2(weights.z),
+                   std::exp2(weights.w)};
+        featherCoverage += simd::dot(feathers, weights) * dt;
+    }
+    return featherCoverage * sign_of(coverages.x);
+}
+
+float eval_feathered_stroke(float4 coverages)
+{
+    return 1.f - feather((1.f - kFeatherCoverageBias) + coverages.x) -
+           feather(1.f - coverages.y);
+}
+
+float4 pack_feathered_fill_coverages(float cornerTheta,
+                                     float2 spokeNorm,
+                                     float outset)
+{
+    float2 cornerLocalCoord = (1.f - spokeNorm * std::abs(outset)) * .5f;
+    float cotTheta, y0;
+    if (std::abs(cornerTheta - math::PI / 2) <
+        1.f / kHorizontalCotangentThreshold)
+    {
+        cotTheta = 0;
+        y0 = 0;
+    }
+    else
+    {
+        float tanTheta = std::tan(cornerTheta);
+        cotTheta = sign_of(math::PI / 2 - cornerTheta) /
+                   std::max(std::abs(tanTheta),
+                            1.f / kHorizontalCotangentValue);
+        y0 = cotTheta >= 0
+                 ? cornerLocalCoord.y - (1.f - cornerLocalCoord.x) * tanTheta
+                 : cornerLocalCoord.y + cornerLocalCoord.x * tanTheta;
+    }
+    return float4{std::max(cornerLocalCoord.x, 0.f) + kFeatherXCoordBias,
+                  -cornerLocalCoord.y + kFeatherCoverageBias,
+                  cotTheta,
+                  y0};
+}
+
+float manhattan_pixel_width(float4 M, float2 normalizedDirection)
+{
+    float2 v = mul(M, normalizedDirection);
+    return (std::abs(v.x) + std::abs(v.y)) / simd::dot(v, v);
+}
+
+float4 find_clip_rect_coverage_distances(float4 clipRectInverseMatrix,
+                                         float2 clipRectInverseTranslate,
+                                         float2 pixelPosition)
+{
+    float2 clipRectAAWidth =
+        simd::abs(float2{clipRectInverseMatrix.x, clipRectInverseMatrix.y}) +
+        simd::abs(float2{clipRectInverseMatrix.z, clipRectInverseMatrix.w});
+    if (clipRectAAWidth.x != 0 && clipRectAAWidth.y != 0)
+    {
+        float2 r = 1.f / clipRectAAWidth;
+        float2 clipRectCoord = mul(clipRectInverseMatrix, pixelPosition) +
+                               clipRectInverseTranslate;
+        return float4{clipRectCoord.x,
+                      clipRectCoord.y,
+                      -clipRectCoord.x,
+                      -clipRectCoord.y} *
+                   r.xyxy +
+               r.xyxy + .5f;
+    }
+    // The caller gave us a singular clipRectInverseMatrix. Use tx and ty as
+    // uniform coverage.
+    return clipRectInverseTranslate.xyxy;
+}
+
+RIVE_ALWAYS_INLINE float min_value(float4 v)
+{
+    return std::min(std::min(v.x, v.y), std::min(v.z, v.w));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// advanced_blend.glsl. The rgb channels are carried in xyz; w is ignored.
+
+float minv3(float4 c) { return std::min(std::min(c.x, c.y), c.z); }
+float maxv3(float4 c) { return std::max(std::max(c.x, c.y), c.z); }
+float lumv3(float4 c) { return c.x * .30f + c.y * .59f + c.z * .11f; }
+float satv3(float4 c) { return maxv3(c) - minv3(c); }
+
+float4 clip_color(float4 color)
+{
+    float lum = lumv3(color);
+    float mincol = minv3(color);
+    float maxcol = maxv3(color);
+    if (mincol < 0)
+    {
+        color = lum + ((color - lum) * lum) / (lum - mincol);
+    }
+    if (maxcol > 1)
+    {
+        color = lum + ((color - lum) * (1.f - lum)) / (maxcol - lum);
+    }
+    return color;
+}
+
+float4 set_lum(float4 cbase, float4 clum)
+{
+    return clip_color(cbase + (lumv3(clum) - lumv3(cbase)));
+}
+
+float4 set_lum_sat(float4 cbase, float4 csat, float4 clum)
+{
+    float minbase = minv3(cbase);
+    float sbase = satv3(cbase);
+    float4 color =
+        sbase > 0 ? (cbase - minbase) * satv3(csat) / sbase : float4(0);
+    return set_lum(color, clum);
+}
+
+float4 advanced_blend_coeffs(float4 src, float4 dstPremul, uint32_t mode)
+{
+    float4 dst = unmultiply(dstPremul);
+    float4 coeffs = 0;
+    switch (mode)
+    {
+        case BLEND_MODE_MULTIPLY:
+            coeffs = src * dst;
+            break;
+        case BLEND_MODE_SCREEN:
+            coeffs = src + dst - src * dst;
+            break;
+        case BLEND_MODE_OVERLAY:
+            for (int i = 0; i < 3; ++i)
+            {
+                coeffs[i] = dst[i] <= .5f
+                                ? 2.f * src[i] * dst[i]
+                                : 1.f - 2.f * (1.f - src[i]) * (1.f - dst[i]);
+            }
+            break;
+        case BLEND_MODE_DARKEN:
+            coeffs = simd::min(src, dst);
+            break;
+        case BLEND_MODE_LIGHTEN:
+            coeffs = simd::max(src, dst);
+            break;
+        case BLEND_MODE_COLORDODGE:
+        {
+            float4 d = simd::clamp(dstPremul, float4(0), float4(dstPremul.w));
+            float4 denom =
+                simd::clamp(1.f - src, float4(0), float4(1)) * dstPremul.w;
+            for (int i = 0; i < 3; ++i)
+            {
+                coeffs[i] = denom[i] == 0 ? sign_of(d[i])
+                                          : std::min(1.f, d[i] / denom[i]);
+            }
+            break;
+        }
+        case BLEND_MODE_COLORBURN:
+        {
+            float4 s = simd::clamp(src, float4(0), float4(1));
+            float4 d = simd::clamp(dstPremul, float4(0), float4(dstPremul.w));
+            float a = dstPremul.w != 0 ? dstPremul.w : 1.f;
+            float4 numer = a - d;
+            for (int i = 0; i < 3; ++i)
+            {
+                coeffs[i] = 1.f - (s[i] == 0 ? sign_of(numer[i])
+                                             : std::min(1.f,
+                                                        numer[i] / (s[i] * a)));
+            }
+            break;
+        }
+        case BLEND_MODE_HARDLIGHT:
+            for (int i = 0; i < 3; ++i)
+            {
+                coeffs[i] = src[i] <= .5f
+                                ? 2.f * src[i] * dst[i]
+                                : 1.f - 2.f * (1.f - src[i]) * (1.f - dst[i]);
+            }
+            break;
+        case BLEND_MODE_SOFTLIGHT:
+            for (int i = 0; i < 3; ++i)
+            {
+                if (src[i] <= .5f)
+                {
+                    coeffs[i] =
+                        dst[i] - (1.f - 2.f * src[i]) * dst[i] * (1.f - dst[i]);
+                }
+                else if (dst[i] <= .25f)
+                {
+                    coeffs[i] = dst[i] + (2.f * src[i] - 1.f) * dst[i] *
+                                             ((16.f * dst[i] - 12.f) * dst[i] +
+                                              3.f);
+                }
+                else
+                {
+                    coeffs[i] = dst[i] + (2.f * src[i] - 1.f) *
+                                             (std::sqrt(dst[i]) - dst[i]);
+                }
+            }
+            break;
+        case BLEND_MODE_DIFFERENCE:
+            coeffs = simd::abs(dst - src);
+            break;
+        case BLEND_MODE_EXCLUSION:
+            coeffs = src + dst - 2.f * src * dst;
+            break;
+        case BLEND_MODE_HUE:
+            src = simd::clamp(src, float4(0), float4(1));
+            coeffs = set_lum_sat(src, dst, dst);
+            break;
+        case BLEND_MODE_SATURATION:
+            src = simd::clamp(src, float4(0), float4(1));
+            coeffs = set_lum_sat(dst, src, dst);
+            break;
+        case BLEND_MODE_COLOR:
+            src = simd::clamp(src, float4(0), float4(1));
+            coeffs = set_lum(src, dst);
+            break;
+        case BLEND_MODE_LUMINOSITY:
+            src = simd::clamp(src, float4(0), float4(1));
+            coeffs = set_lum(dst, src);
+            break;
+    }
+    return coeffs;
+}
+
+// Returns the blended rgb in xyz. (The source alpha is implicitly 1.)
+float4 advanced_color_blend(float4 src, float4 dstPremul, uint32_t mode)
+{
+    float4 coeffs = advanced_blend_coeffs(src, dstPremul, mode);
+    return coeffs * dstPremul.w + src * (1.f - dstPremul.w);
+}
+
+// CPU backend implementation of RenderBuffer. The flush executes synchronously,
+// so a single host allocation behaves the same as a GPU buffer.
+class RenderBufferCPUImpl
+    : public LITE_RTTI_OVERRIDE(RenderBuffer, RenderBufferCPUImpl)
+{
+public:
+    RenderBufferCPUImpl(RenderBufferType renderBufferType,
+                        RenderBufferFlags renderBufferFlags,
+                        size_t sizeInBytes) :
+        lite_rtti_override(renderBufferType, renderBufferFlags, sizeInBytes),
+        m_contents(new uint8_t[sizeInBytes])
+    {}
+
+    const uint8_t* contents() const { return m_contents.get(); }
+
+protected:
+    void* onMap() override { return m_contents.get(); }
+    void onUnmap() override {}
+
+private:
+    std::unique_ptr<uint8_t[]> m_contents;
+};
+
+// CPU backend implementation of Texture. Holds a premultiplied RGBA8 mip chain
+// that gets sampled trilinearly, clamped to edge.
+class TextureCPUImpl : public Texture
+{
+public:
+    TextureCPUImpl(uint32_t width,
+                   uint32_t height,
+                   uint32_t mipLevelCount,
+                   const uint8_t imageDataRGBAPremul[]) :
+        Texture(width, height)
+    {
+        MipLevel& base = m_mipLevels.emplace_back();
+        base.width = width;
+        base.height = height;
+        base.texels.resize(size_t(width) * height);
+        memcpy(base.texels.data(),
+               imageDataRGBAPremul,
+               base.texels.size() * sizeof(uint32_t));
+
+        // Box-filter the remaining levels.
+        while (m_mipLevels.size() < mipLevelCount &&
+               (m_mipLevels.back().width > 1 || m_mipLevels.back().height > 1))
+        {
+            MipLevel level;
+            const MipLevel& src = m_mipLevels.back();
+            level.width = std::max(src.width >> 1, 1u);
+            level.height = std::max(src.height >> 1, 1u);
+            level.texels.resize(size_t(level.width) * level.height);
+            for (uint32_t y = 0; y < level.height; ++y)
+            {
+                uint32_t y0 = std::min(y * 2, src.height - 1);
+                uint32_t y1 = std::min(y * 2 + 1, src.height - 1);
+                for (uint32_t x = 0; x < level.width; ++x)
+                {
+                    uint32_t x0 = std::min(x * 2, src.width - 1);
+                    uint32_t x1 = std::min(x * 2 + 1, src.width - 1);
+                    float4 sum = unpack_unorm4x8(src.texel(x0, y0)) +
+                                 unpack_unorm4x8(src.texel(x1, y0)) +
+                                 unpack_unorm4x8(src.texel(x0, y1)) +
+                                 unpack_unorm4x8(src.texel(x1, y1));
+                    level.texels[size_t(y) * level.width + x] =
+                        pack_unorm4x8(sum * .25f);
+                }
+            }
+            m_mipLevels.push_back(std::move(level));
+        }
+    }
+
+    // Returns a premultiplied color.
+    float4 sample(float2 uv, float lod) const
+    {
+        float maxLevel = static_cast<float>(m_mipLevels.size() - 1);
+        // (Also catches NaN.)
+        lod = lod > 0 ? std::min(lod, maxLevel) : 0;
+        float levelFloor = std::floor(lod);
+        auto level = static_cast<uint32_t>(levelFloor);
+        float4 color = m_mipLevels[level].sample(uv);
+        if (lod > levelFloor)
+        {
+            color = lerp(color,
+                         m_mipLevels[level + 1].sample(uv),
+                         lod - levelFloor);
+        }
+        return color;
+    }
+
+private:
+    struct MipLevel
+    {
+        uint32_t texel(uint32_t x, uint32_t y) const
+        {
+            return texels[size_t(y) * width + x];
+        }
+
+        float4 sample(float2 uv) const
+        {
+            float2 size = {static_cast<float>(width),
+                           static_cast<float>(height)};
+            float2 texelCoord =
+                simd::clamp(uv * size - .5f, float2(-1), size);
+            float2 texelFloor = simd::floor(texelCoord);
+            float2 t = texelCoord - texelFloor;
+            int2 maxCoord = {static_cast<int32_t>(width - 1),
+                             static_cast<int32_t>(height - 1)};
+            int2 c0 = simd::cast<int32_t>(texelFloor);
+            int2 c1 = simd::clamp(c0 + 1, int2(0), maxCoord);
+            c0 = simd::clamp(c0, int2(0), maxCoord);
+            float4 top = lerp(unpack_unorm4x8(texel(c0.x, c0.y)),
+                              unpack_unorm4x8(texel(c1.x, c0.y)),
+                              t.x);
+            float4 bottom = lerp(unpack_unorm4x8(texel(c0.x, c1.y)),
+                                 unpack_unorm4x8(texel(c1.x, c1.y)),
+                                 t.x);
+            return lerp(top, bottom, t.y);
+        }
+
+        uint32_t width;
+        uint32_t height;
+        std::vector<uint32_t> texels;
+    };
+
+    std::vector<MipLevel> m_mipLevels;
+};
+} // namespace
+
+// Flush-wide pointers into the mapped storage buffers and textures, indexed
+// the same way the shaders index their bindings.
+struct CPUFlushData
+{
+    const uint32_t* paths;    // 4 uint4's per path.
+    const uint32_t* paints;   // 1 uint2 per path.
+    const float* paintAuxes;  // 4 float4's per path.
+    const uint32_t* contours; // 1 uint4 per contour.
+    uint32_t contourCount;
+    const uint32_t* tessTexels; // 1 uint4 per texel.
+    size_t tessTexelCount;
+    const uint32_t* gradTexels;
+    uint32_t gradTextureHeight;
+    const float* atlasTexels;
+    uint32_t atlasTextureWidth;
+    uint32_t atlasTextureHeight;
+
+    uint4 path(uint32_t pathID, uint32_t idx) const
+    {
+        return simd::load4ui(paths + (size_t(pathID) * 4 + idx) * 4);
+    }
+
+    float4 pathf(uint32_t pathID, uint32_t idx) const
+    {
+        return bits_to_float4(path(pathID, idx));
+    }
+
+    uint2 paint(uint32_t pathID) const
+    {
+        return simd::load2ui(paints + size_t(pathID) * 2);
+    }
+
+    float4 paintAux(uint32_t pathID, uint32_t idx) const
+    {
+        return simd::load4f(paintAuxes + (size_t(pathID) * 4 + idx) * 4);
+    }
+
+    uint4 contour(uint32_t contourIDWithFlags) const
+    {
+        // (Wraps around to an out-of-bounds index for contourID 0.)
+        uint32_t idx = (contourIDWithFlags & CONTOUR_ID_MASK) - 1;
+        return idx < contourCount ? simd::load4ui(contours + size_t(idx) * 4)
+                                  : uint4(0);
+    }
+
+    uint4 tessTexel(int32_t idx) const
+    {
+        return idx >= 0 && static_cast<size_t>(idx) < tessTexelCount
+                   ? simd::load4ui(tessTexels + size_t(idx) * 4)
+                   : uint4(0);
+    }
+};
+
+// Bins screen-space triangles into tiles and rasterizes the tiles in parallel.
+// Within each tile, triangles are shaded in the order they were submitted,
+// which provides the same guarantees as InterlockMode::rasterOrdering.
+class CPURasterizer
+{
+public:
+    constexpr static int32_t kTileSize = 64;
+    constexpr static uint32_t kCulledDrawIdx = ~0u;
+
+    // Triangle emitted by one of the vertex stages, along with the varyings its
+    // fragments interpolate.
+    struct Triangle
+    {
+        float2 points[3];
+        float4 varyings[3];
+        uint32_t pathID;
+        uint32_t drawIdx; // kCulledDrawIdx if the triangle doesn't rasterize.
+
+        // Edge functions "A*x + B*y + C" that are positive on the inside. These
+        // are computed in double precision so the pixel-center tests are exact
+        // for the float vertices.
+        double edgeA[3];
+        double edgeB[3];
+        double edgeC[3];
+        bool edgeInclusive[3]; // Top-left fill convention.
+        double inverseArea2;
+        int32_t left, top, right, bottom;
+
+        // Culls the triangle or prepares it for rasterization.
+        void setup(CullFace cullFace, const IAABB& scissor)
+        {
+            for (const float2& p : points)
+            {
+                if (!std::isfinite(p.x) || !std::isfinite(p.y))
+                {
+                    drawIdx = kCulledDrawIdx;
+                    return;
+                }
+            }
+            double area2 =
+                (double(points[1].x) - points[0].x) *
+                    (double(points[2].y) - points[0].y) -
+                (double(points[1].y) - points[0].y) *
+                    (double(points[2].x) - points[0].x);
+            // Pixel coordinates are y-down, so positive area is clockwise.
+            if (area2 == 0 ||
+                (cullFace == CullFace::counterclockwise && area2 < 0) ||
+                (cullFace == CullFace::clockwise && area2 > 0))
+            {
+                drawIdx = kCulledDrawIdx;
+                return;
+            }
+            if (area2 < 0)
+            {
+                std::swap(points[1], points[2]);
+                std::swap(varyings[1], varyings[2]);
+                area2 = -area2;
+            }
+            for (int i = 0; i < 3; ++i)
+            {
+                const float2& p = points[i];
+                const float2& q = points[(i + 1) % 3];
+                edgeA[i] = double(p.y) - q.y;
+                edgeB[i] = double(q.x) - p.x;
+                edgeC[i] = double(p.x) * q.y - double(q.x) * p.y;
+                edgeInclusive[i] =
+                    edgeA[i] > 0 || (edgeA[i] == 0 && edgeB[i] > 0);
+            }
+            inverseArea2 = 1 / area2;
+
+            float2 minPt =
+                simd::min(simd::min(points[0], points[1]), points[2]);
+            float2 maxPt =
+                simd::max(simd::max(points[0], points[1]), points[2]);
+            left = static_cast<int32_t>(
+                std::max(std::floor(minPt.x), float(scissor.left)));
+            top = static_cast<int32_t>(
+                std::max(std::floor(minPt.y), float(scissor.top)));
+            right = static_cast<int32_t>(
+                std::min(std::ceil(maxPt.x), float(scissor.right)));
+            bottom = static_cast<int32_t>(
+                std::min(std::ceil(maxPt.y), float(scissor.bottom)));
+            if (left >= right || top >= bottom)
+            {
+                drawIdx = kCulledDrawIdx;
+            }
+        }
+    };
+
+    // Pixel local storage, minus the color plane (which is the render target).
+    struct PLSTexel
+    {
+        float coverageCount;
+        uint32_t coveragePathID;
+        float clipCoverage;
+        uint32_t clipID;
+        uint32_t scratchColor; // Premultiplied RGBA8.
+    };
+
+    std::vector<Triangle>& triangles() { return m_triangles; }
+
+    PLSTexel* resetPLSTexels(uint32_t width, uint32_t height)
+    {
+        m_plsTexels.assign(size_t(width) * height, PLSTexel{0, 0, 0, 0, 0});
+        return m_plsTexels.data();
+    }
+
+    // Calls "fragmentShader(triangle, x, y, varyings)" for every pixel center
+    // covered by triangles(). Tiles run in parallel, so the fragment shader may
+    // only access state belonging to the pixel it was handed.
+    template <typename FragmentShader>
+    void rasterize(FlushTaskScheduler* scheduler,
+                   uint32_t width,
+                   uint32_t height,
+                   const FragmentShader& fragmentShader)
+    {
+        int32_t tilesX = (static_cast<int32_t>(width) + kTileSize - 1) /
+                         kTileSize;
+        int32_t tilesY = (static_cast<int32_t>(height) + kTileSize - 1) /
+                         kTileSize;
+        m_tileBins.resize(size_t(tilesX) * tilesY);
+        for (std::vector<uint32_t>& bin : m_tileBins)
+        {
+            bin.clear();
+        }
+        for (size_t i = 0; i < m_triangles.size(); ++i)
+        {
+            const Triangle& triangle = m_triangles[i];
+            if (triangle.drawIdx == kCulledDrawIdx)
+            {
+                continue;
+            }
+            for (int32_t ty = triangle.top / kTileSize;
+                 ty <= (triangle.bottom - 1) / kTileSize;
+                 ++ty)
+            {
+                for (int32_t tx = triangle.left / kTileSize;
+                     tx <= (triangle.right - 1) / kTileSize;
+                     ++tx)
+                {
+                    m_tileBins[size_t(ty) * tilesX + tx].push_back(
+                        static_cast<uint32_t>(i));
+                }
+            }
+        }
+
+        m_occupiedTiles.clear();
+        for (size_t i = 0; i < m_tileBins.size(); ++i)
+        {
+            if (!m_tileBins[i].empty())
+            {
+                m_occupiedTiles.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        parallel_for(scheduler, m_occupiedTiles.size(), [&](size_t i) {
+            uint32_t tileIdx = m_occupiedTiles[i];
+            int32_t tileX = static_cast<int32_t>(tileIdx) % tilesX * kTileSize;
+            int32_t tileY = static_cast<int32_t>(tileIdx) / tilesX * kTileSize;
+            IAABB tile = {tileX,
+                          tileY,
+                          std::min(tileX + kTileSize,
+                                   static_cast<int32_t>(width)),
+                          std::min(tileY + kTileSize,
+                                   static_cast<int32_t>(height))};
+            for (uint32_t triangleIdx : m_tileBins[tileIdx])
+            {
+                RasterizeTriangle(m_triangles[triangleIdx],
+                                  tile,
+                                  fragmentShader);
+            }
+        });
+    }
+
+private:
+    using double4 = simd::gvec<double, 4>;
+
+    // Evaluates 4 horizontally adjacent pixels at a time against the edge
+    // functions, and shades the ones that are inside.
+    template <typename FragmentShader>
+    static void RasterizeTriangle(const Triangle& triangle,
+                                  const IAABB& tile,
+                                  const FragmentShader& fragmentShader)
+    {
+        int32_t l = std::max(triangle.left, tile.left);
+        int32_t t = std::max(triangle.top, tile.top);
+        int32_t r = std::min(triangle.right, tile.right);
+        int32_t b = std::min(triangle.bottom, tile.bottom);
+        if (l >= r || t >= b)
+        {
+            return;
+        }
+        const double4 laneOffsets = {0, 1, 2, 3};
+        for (int32_t y = t; y < b; ++y)
+        {
+            double rowE[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                rowE[i] = triangle.edgeA[i] * (l + .5) +
+                          triangle.edgeB[i] * (y + .5) + triangle.edgeC[i];
+            }
+            for (int32_t x = l; x < r; x += 4)
+            {
+                double4 dx = static_cast<double>(x - l) + laneOffsets;
+                double4 e[3];
+                for (int i = 0; i < 3; ++i)
+                {
+                    e[i] = rowE[i] + triangle.edgeA[i] * dx;
+                }
+                auto inside = (triangle.edgeInclusive[0] ? e[0] >= 0.
+                                                         : e[0] > 0.) &
+                              (triangle.edgeInclusive[1] ? e[1] >= 0.
+                                                         : e[1] > 0.) &
+                              (triangle.edgeInclusive[2] ? e[2] >= 0.
+                                                         : e[2] > 0.);
+                if (!simd::any(inside))
+                {
+                    continue;
+                }
+                for (int lane = 0; lane < 4 && x + lane < r; ++lane)
+                {
+                    if (!inside[lane])
+                    {
+                        continue;
+                    }
+                    // Edge i is opposite vertex (i + 2) % 3.
+                    auto w2 = static_cast<float>(e[0][lane] *
+                                                 triangle.inverseArea2);
+                    auto w0 = static_cast<float>(e[1][lane] *
+                                                 triangle.inverseArea2);
+                    auto w1 = static_cast<float>(e[2][lane] *
+                                                 triangle.inverseArea2);
+                    fragmentShader(triangle,
+                                   static_cast<uint32_t>(x + lane),
+                                   static_cast<uint32_t>(y),
+                                   triangle.varyings[0] * w0 +
+                                       triangle.varyings[1] * w1 +
+                                       triangle.varyings[2] * w2);
+                }
+            }
+        }
+    }
+
+    std::vector<Triangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_tileBins;
+    std::vector<uint32_t> m_occupiedTiles;
+    std::vector<PLSTexel> m_plsTexels;
+};
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////
+// tessellate.glsl
+
+// Varyings that tessellate.glsl's vertex shader passes to its fragment shader.
+struct TessSpanVaryings
+{
+    float2 p[4];
+    float2 tangents[2];
+    float totalVertexCount;
+    float parametricSegmentCount;
+    float joinSegmentCount;
+    float radsPerPolarSegment;
+    float2 joinTangent;
+    float radsPerJoinSegment;
+};
+
+// Port of @tessellateFragmentMain.
+uint4 tessellate_vertex(const TessSpanVaryings& v,
+                        float vertexIdx,
+                        uint32_t contourIDWithFlags)
+{
+    float2 p0 = v.p[0], p1 = v.p[1], p2 = v.p[2], p3 = v.p[3];
+    float2 tangents[2] = {v.tangents[0], v.tangents[1]};
+    float parametricSegmentCount = v.parametricSegmentCount;
+    float radsPerPolarSegment = v.radsPerPolarSegment;
+
+    float mergedSegmentCount = v.totalVertexCount - v.joinSegmentCount;
+    float mergedVertexID = vertexIdx;
+    if (mergedVertexID <= mergedSegmentCount)
+    {
+        // We're tessellating the curve, not the join.
+        contourIDWithFlags &= ~JOIN_TYPE_MASK;
+    }
+    else
+    {
+        // We're tessellating the join that follows the curve.
+        p0 = p1 = p2 = p3;
+        tangents[0] = tangents[1];
+        tangents[1] = v.joinTangent;
+        parametricSegmentCount = 1;
+        mergedVertexID -= mergedSegmentCount;
+        mergedSegmentCount = v.joinSegmentCount;
+        radsPerPolarSegment = v.radsPerJoinSegment;
+        if ((contourIDWithFlags & JOIN_TYPE_MASK) > ROUND_JOIN_CONTOUR_FLAG)
+        {
+            // Miter and bevel joins emit 5 vertices.
+            if (mergedVertexID < 2.5f)
+                contourIDWithFlags |= JOIN_TANGENT_0_CONTOUR_FLAG;
+            if (mergedVertexID > 1.5f && mergedVertexID < 3.5f)
+                contourIDWithFlags |= JOIN_TANGENT_INNER_CONTOUR_FLAG;
+        }
+        else if ((contourIDWithFlags & EMULATED_STROKE_CAP_CONTOUR_FLAG) ||
+                 (contourIDWithFlags & JOIN_TYPE_MASK) ==
+                     FEATHER_JOIN_CONTOUR_FLAG)
+        {
+            // Emulated caps and feather joins emit vertices at T=0 and T=1.
+            mergedSegmentCount -= 2;
+            --mergedVertexID;
+        }
+        contourIDWithFlags |= radsPerPolarSegment < 0 ? LEFT_JOIN_CONTOUR_FLAG
+                                                      : RIGHT_JOIN_CONTOUR_FLAG;
+    }
+
+    float2 tessCoord;
+    float theta = 0;
+    if (mergedVertexID == 0 || mergedVertexID == mergedSegmentCount ||
+        (contourIDWithFlags & JOIN_TYPE_MASK) > ROUND_JOIN_CONTOUR_FLAG)
+    {
+        // Tangents at the endpoints are exact.
+        bool isTan0 = mergedVertexID < mergedSegmentCount * .5f;
+        tessCoord = isTan0 ? p0 : p3;
+        theta = vector_angle(isTan0 ? tangents[0] : tangents[1]);
+    }
+    else if (contourIDWithFlags & RETROFITTED_TRIANGLE_CONTOUR_FLAG)
+    {
+        tessCoord = p1;
+    }
+    else
+    {
+        float T, polarT;
+        if (parametricSegmentCount == mergedSegmentCount)
+        {
+            // There are no polar segments.
+            T = mergedVertexID / parametricSegmentCount;
+            polarT = 0;
+        }
+        else
+        {
+            float2 C = p1 - p0;
+            float2 D = p3 - p0;
+            float2 E = p2 - p1;
+            float2 B = E - C;
+            float2 A = -3.f * E + D;
+            float2 B_ = B * (parametricSegmentCount * 2.f);
+            float2 C_ = C * (parametricSegmentCount * parametricSegmentCount);
+
+            // Find the last parametric vertex whose tangent has rotated less
+            // than the polar vertex we're looking for.
+            float lastParametricVertexID = 0;
+            float maxParametricVertexID =
+                std::min(parametricSegmentCount - 1.f, mergedVertexID);
+            float2 tan0norm = tangents[0] / length(tangents[0]);
+            float negAbsRadsPerSegment = -std::abs(radsPerPolarSegment);
+            float maxRotation0 =
+                (1.f + mergedVertexID) * std::abs(radsPerPolarSegment);
+            for (int p = 9; p >= 0; --p)
+            {
+                float testParametricID =
+                    lastParametricVertexID + static_cast<float>(1 << p);
+                if (testParametricID <= maxParametricVertexID)
+                {
+                    float2 testTan = testParametricID * A + B_;
+                    testTan = testParametricID * testTan + C_;
+                    float cosRotation =
+                        simd::dot(testTan / length(testTan), tan0norm);
+                    float maxRotation = std::min(
+                        testParametricID * negAbsRadsPerSegment + maxRotation0,
+                        math::PI);
+                    if (cosRotation >= std::cos(maxRotation))
+                        lastParametricVertexID = testParametricID;
+                }
+            }
+            float parametricT = lastParametricVertexID / parametricSegmentCount;
+
+            // Find the T value of the polar vertex.
+            float lastPolarVertexID = mergedVertexID - lastParametricVertexID;
+            float theta0 = std::acos(std::clamp(tan0norm.x, -1.f, 1.f));
+            theta0 = tan0norm.y >= 0 ? theta0 : -theta0;
+            theta = lastPolarVertexID * radsPerPolarSegment + theta0;
+            float2 norm = {std::sin(theta), -std::cos(theta)};
+            float a = simd::dot(norm, A);
+            float b_over_2 = simd::dot(norm, B);
+            float c = simd::dot(norm, C);
+            float discr_over_4 = std::max(b_over_2 * b_over_2 - a * c, 0.f);
+            float q = std::sqrt(discr_over_4);
+            if (b_over_2 > 0)
+                q = -q;
+            q -= b_over_2;
+            float _5qa = -.5f * q * a;
+            float2 root = (std::abs(q * q + _5qa) < std::abs(a * c + _5qa))
+                              ? float2{q, a}
+                              : float2{c, q};
+            polarT = root.y != 0 ? root.x / root.y : 0.f;
+            polarT = std::clamp(polarT, 0.f, 1.f);
+            if (lastPolarVertexID == 0)
+                polarT = 0;
+
+            // The vertex is whichever of the two comes first.
+            T = std::max(parametricT, polarT);
+        }
+        float2 ab = simd::unchecked_mix(p0, p1, float2(T));
+        float2 bc = simd::unchecked_mix(p1, p2, float2(T));
+        float2 cd = simd::unchecked_mix(p2, p3, float2(T));
+        float2 abc = simd::unchecked_mix(ab, bc, float2(T));
+        float2 bcd = simd::unchecked_mix(bc, cd, float2(T));
+        tessCoord = simd::unchecked_mix(abc, bcd, float2(T));
+        if (T != polarT)
+            theta = vector_angle(bcd - abc);
+    }
+
+    uint4 tessData;
+    tessData.x = math::bit_cast<uint32_t>(tessCoord.x);
+    tessData.y = math::bit_cast<uint32_t>(tessCoord.y);
+    if ((contourIDWithFlags & JOIN_TYPE_MASK) == FEATHER_JOIN_CONTOUR_FLAG)
+    {
+        // Feather joins need the vertex's position within the join.
+        tessData.z = (static_cast<uint32_t>(mergedSegmentCount) << 16) |
+                     static_cast<uint32_t>(mergedVertexID);
+    }
+    else
+    {
+        float _2PI = 2 * math::PI;
+        tessData.z = math::bit_cast<uint32_t>(
+            theta - _2PI * std::floor(theta / _2PI));
+    }
+    tessData.w = contourIDWithFlags;
+    return tessData;
+}
+
+// Port of @tessellateVertexMain, followed by a scan conversion of the span
+// (and its reflection) into the tessellation texture.
+void tessellate_span(const CPUFlushData& data,
+                     const TessVertexSpan& span,
+                     uint32_t* tessTexels,
+                     uint32_t tessTextureHeight)
+{
+    TessSpanVaryings v;
+    for (int i = 0; i < 4; ++i)
+    {
+        v.p[i] = float2{span.pts[i].x, span.pts[i].y};
+    }
+    uint32_t parametricSegmentCount = span.segmentCounts & 0x3ff;
+    uint32_t polarSegmentCount = (span.segmentCounts >> 10) & 0x3ff;
+    uint32_t joinSegmentCount = span.segmentCounts >> 20;
+    uint32_t contourIDWithFlags = span.contourIDWithFlags;
+    uint32_t pathID = contourIDWithFlags != INVALID_CONTOUR_ID_WITH_FLAGS
+                          ? data.contour(contourIDWithFlags).z
+                          : 0u;
+    uint4 pathData = pathID != 0 ? data.path(pathID, 1) : uint4(0);
+    float strokeRadius = math::bit_cast<float>(pathData.z);
+    float featherRadius = math::bit_cast<float>(pathData.w);
+
+    if (featherRadius != 0 && strokeRadius == 0)
+    {
+        // We're a cubic from a feathered fill. Simulate the softening that
+        // happens with curvature by reducing the height of the curve.
+        float maxHeightT;
+        float height = find_cubic_max_height(v.p, maxHeightT);
+        float oneStddev = featherRadius * (1.f / FEATHER_TEXTURE_STDDEVS);
+        float curvature =
+            measure_cubic_local_curvature(v.p, maxHeightT, oneStddev);
+        float dimming = 1.f - curvature * (1.f / math::PI);
+        float stddevsPow2 =
+            simd::dot(v.p[3] - v.p[0], v.p[3] - v.p[0]) /
+            (oneStddev * oneStddev);
+        dimming = std::min(dimming, (stddevsPow2 - 1.f) * .5f);
+        dimming = std::min(dimming, .99f);
+        float desiredOpacityOnCenter = .5f * dimming;
+        float x = inverse_feather(desiredOpacityOnCenter) * -2.f + 1.f;
+        float softness = clamped_divide(x * featherRadius, height);
+        v.p[1] = simd::unchecked_mix(v.p[1],
+                                     lerp(v.p[0], v.p[3], 1.f / 3),
+                                     float2(softness));
+        v.p[2] = simd::unchecked_mix(v.p[2],
+                                     lerp(v.p[0], v.p[3], 2.f / 3),
+                                     float2(softness));
+    }
+
+    if (contourIDWithFlags & CULL_EXCESS_TESSELLATION_SEGMENTS_CONTOUR_FLAG)
+    {
+        // Re-run Wang's formula and make any excess segments degenerate.
+        float4 mat = data.pathf(pathID, 0);
+        float2 d0 = mul(mat, -2.f * v.p[1] + v.p[2] + v.p[0]);
+        float2 d1 = mul(mat, -2.f * v.p[2] + v.p[3] + v.p[1]);
+        float m = std::max(simd::dot(d0, d0), simd::dot(d1, d1));
+        float n = std::max(std::ceil(std::sqrt(.75f * 4.f * std::sqrt(m))),
+                           1.f);
+        parametricSegmentCount =
+            std::min(static_cast<uint32_t>(n), parametricSegmentCount);
+    }
+
+    uint32_t totalVertexCount =
+        parametricSegmentCount + polarSegmentCount + joinSegmentCount - 1;
+    find_cubic_tangents(v.p, v.tangents);
+    float theta =
+        std::acos(cosine_between_vectors(v.tangents[0], v.tangents[1]));
+    v.radsPerPolarSegment = theta / static_cast<float>(polarSegmentCount);
+    float turn = simd::cross(v.p[2] - v.p[0], v.p[3] - v.p[1]);
+    if (turn == 0)
+        turn = simd::cross(v.tangents[0], v.tangents[1]);
+    if (turn < 0)
+        v.radsPerPolarSegment = -v.radsPerPolarSegment;
+    v.totalVertexCount = static_cast<float>(totalVertexCount);
+    v.parametricSegmentCount = static_cast<float>(parametricSegmentCount);
+    v.joinSegmentCount = static_cast<float>(joinSegmentCount);
+    v.joinTangent = float2{span.joinTangent.x, span.joinTangent.y};
+    v.radsPerJoinSegment = 0;
+    if (joinSegmentCount > 1)
+    {
+        float joinTheta = std::acos(
+            cosine_between_vectors(v.tangents[1], v.joinTangent));
+        float joinSpan = static_cast<float>(joinSegmentCount);
+        if ((contourIDWithFlags &
+             (JOIN_TYPE_MASK | EMULATED_STROKE_CAP_CONTOUR_FLAG)) ==
+            (ROUND_JOIN_CONTOUR_FLAG | EMULATED_STROKE_CAP_CONTOUR_FLAG))
+        {
+            // Round caps rotate around two more segments than round joins.
+            joinSpan -= 2;
+        }
+        v.radsPerJoinSegment = joinTheta / joinSpan;
+        if (simd::cross(v.tangents[1], v.joinTangent) < 0)
+            v.radsPerJoinSegment = -v.radsPerJoinSegment;
+    }
+
+    // Each span is drawn once at (y, x0x1), and once more at its reflection.
+    // (Unused reflections are placed offscreen.)
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        float y = pass == 0 ? span.y : span.reflectionY;
+        int32_t x0x1 = pass == 0 ? span.x0x1 : span.reflectionX0X1;
+        if (!(y >= 0 && y < static_cast<float>(tessTextureHeight)))
+        {
+            continue;
+        }
+        int32_t x0 = static_cast<int16_t>(x0x1 & 0xffff);
+        int32_t x1 = x0x1 >> 16;
+        uint32_t flags = contourIDWithFlags;
+        if (x1 < x0) // Reflections are drawn right to left.
+        {
+            flags |= MIRRORED_CONTOUR_CONTOUR_FLAG;
+        }
+        int32_t begin = std::max(std::min(x0, x1), 0);
+        int32_t end = std::min(std::max(x0, x1),
+                               static_cast<int32_t>(kTessTextureWidth));
+        uint32_t* row = tessTexels + static_cast<size_t>(y) *
+                                         kTessTextureWidth * 4;
+        for (int32_t x = begin; x < end; ++x)
+        {
+            float vertexIdx = std::max(
+                std::floor(v.totalVertexCount -
+                           std::abs(static_cast<float>(x1) - (x + .5f))),
+                0.f);
+            simd::store(row + x * 4, tessellate_vertex(v, vertexIdx, flags));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// draw_path_common.glsl (vertex stage)
+
+// Output of a CPU vertex stage.
+struct ShadedVertex
+{
+    float2 position;
+    float4 varyings;
+    uint32_t pathID;
+    bool valid;
+};
+
+// Port of unpack_tessellated_path_vertex(). Returns false if the vertex
+// should be discarded.
+bool unpack_tessellated_path_vertex(const CPUFlushData& data,
+                                    const PatchVertex& patchVertex,
+                                    uint32_t instanceID,
+                                    uint32_t* outPathID,
+                                    float2* outVertexPosition,
+                                    float4* outCoverages)
+{
+    int32_t localVertexID = static_cast<int32_t>(patchVertex.localVertexID);
+    float outset = patchVertex.outset;
+    float fillCoverage = patchVertex.fillCoverage;
+    int32_t patchSegmentSpan = patchVertex.params >> 2;
+    int32_t vertexType = patchVertex.params & 3;
+
+    // Fetch a vertex that definitely belongs to the contour we're drawing.
+    int32_t vertexIDOnContour = std::min(localVertexID, patchSegmentSpan - 1);
+    int32_t tessVertexIdx =
+        static_cast<int32_t>(instanceID) * patchSegmentSpan + vertexIDOnContour;
+    uint4 tessVertexData = data.tessTexel(tessVertexIdx);
+    uint32_t contourIDWithFlags = tessVertexData.w;
+
+    uint4 contourData = data.contour(contourIDWithFlags);
+    float2 midpoint = bits_to_float2(contourData.x, contourData.y);
+    uint32_t pathID = contourData.z & 0xffffu;
+    uint32_t vertexIndex0 = contourData.w;
+    *outPathID = pathID;
+
+    float4 M = data.pathf(pathID, 0);
+    uint4 pathData = data.path(pathID, 1);
+    float2 translate = bits_to_float2(pathData.x, pathData.y);
+    float strokeRadius = math::bit_cast<float>(pathData.z);
+    float featherRadius = math::bit_cast<float>(pathData.w);
+
+    // Reflections use the mirrored patch data.
+    uint32_t mirroredContourFlag =
+        contourIDWithFlags & MIRRORED_CONTOUR_CONTOUR_FLAG;
+    if (mirroredContourFlag != 0)
+    {
+        localVertexID = static_cast<int32_t>(patchVertex.mirroredVertexID);
+        outset = patchVertex.mirroredOutset;
+        fillCoverage = patchVertex.mirroredFillCoverage;
+    }
+
+    if (localVertexID != vertexIDOnContour)
+    {
+        // This vertex may belong to a neighboring contour. If so, either wrap
+        // around to the beginning of our contour (closed), or stay put (open).
+        int32_t replacementTessVertexIdx =
+            tessVertexIdx + localVertexID - vertexIDOnContour;
+        uint4 replacementTessVertexData =
+            data.tessTexel(replacementTessVertexIdx);
+        constexpr static uint32_t kContourMatchMask =
+            MIRRORED_CONTOUR_CONTOUR_FLAG | CONTOUR_ID_MASK;
+        if ((replacementTessVertexData.w & kContourMatchMask) !=
+            (contourIDWithFlags & kContourMatchMask))
+        {
+            bool isClosed = strokeRadius == 0 || midpoint.x != 0;
+            if (isClosed)
+            {
+                tessVertexIdx = static_cast<int32_t>(vertexIndex0);
+                tessVertexData = data.tessTexel(tessVertexIdx);
+            }
+        }
+        else
+        {
+            tessVertexIdx = replacementTessVertexIdx;
+            tessVertexData = replacementTessVertexData;
+        }
+        contourIDWithFlags =
+            (tessVertexData.w & ~MIRRORED_CONTOUR_CONTOUR_FLAG) |
+            mirroredContourFlag;
+    }
+
+    float theta;
+    float featherJoinEdge0Theta = 0;
+    float featherJoinCornerTheta = 0;
+    if ((contourIDWithFlags & JOIN_TYPE_MASK) == FEATHER_JOIN_CONTOUR_FLAG &&
+        vertexType == STROKE_VERTEX)
+    {
+        // Feather joins are drawn as a fan of spokes around the corner.
+        auto joinVertexID = static_cast<float>(tessVertexData.z & 0xffff);
+        auto joinSegmentCount = static_cast<float>(tessVertexData.z >> 16);
+        int32_t edgeVertexOffsets[2] = {
+            static_cast<int32_t>(-joinVertexID - 1),
+            static_cast<int32_t>(joinSegmentCount - joinVertexID + 1)};
+        if (mirroredContourFlag != 0)
+        {
+            edgeVertexOffsets[0] = -edgeVertexOffsets[0];
+            edgeVertexOffsets[1] = -edgeVertexOffsets[1];
+        }
+        uint4 edge0Data = data.tessTexel(tessVertexIdx + edgeVertexOffsets[0]);
+        uint4 edge1Data = data.tessTexel(tessVertexIdx + edgeVertexOffsets[1]);
+        constexpr static uint32_t kContourMatchMask =
+            MIRRORED_CONTOUR_CONTOUR_FLAG | CONTOUR_ID_MASK;
+        if ((edge1Data.w & kContourMatchMask) !=
+            (edge0Data.w & kContourMatchMask))
+        {
+            edge1Data = data.tessTexel(static_cast<int32_t>(vertexIndex0));
+        }
+        featherJoinEdge0Theta = math::bit_cast<float>(edge0Data.z);
+        float edge1Theta = math::bit_cast<float>(edge1Data.z);
+        featherJoinCornerTheta = edge1Theta - featherJoinEdge0Theta;
+        if (std::abs(featherJoinCornerTheta) > math::PI)
+        {
+            featherJoinCornerTheta -=
+                2 * math::PI * sign_of(featherJoinCornerTheta);
+        }
+
+        float nonHelperSegmentCount =
+            joinSegmentCount + 1 -
+            static_cast<float>(FEATHER_JOIN_HELPER_VERTEX_COUNT);
+        float forwardSegmentCount = std::clamp(
+            std::round(std::abs(featherJoinCornerTheta) / math::PI *
+                       nonHelperSegmentCount),
+            1.f,
+            nonHelperSegmentCount - 1);
+        float backwardSegmentCount =
+            nonHelperSegmentCount - forwardSegmentCount;
+        if (joinVertexID <= backwardSegmentCount)
+        {
+            // Backward spokes.
+            featherJoinCornerTheta =
+                -(math::PI * sign_of(featherJoinCornerTheta) -
+                  featherJoinCornerTheta);
+            joinSegmentCount = backwardSegmentCount;
+            if (joinVertexID == backwardSegmentCount)
+                outset = -outset;
+        }
+        else if (joinVertexID == backwardSegmentCount + 1)
+        {
+            // Throwaway vertex between the backward and forward spokes.
+            joinVertexID = 0;
+            joinSegmentCount = 0;
+            outset = 0;
+        }
+        else
+        {
+            // Forward spokes.
+            joinVertexID -= backwardSegmentCount + 2;
+            joinSegmentCount = forwardSegmentCount;
+        }
+        theta = joinVertexID == joinSegmentCount
+                    ? edge1Theta
+                    : featherJoinEdge0Theta +
+                          featherJoinCornerTheta *
+                              (joinVertexID / joinSegmentCount);
+    }
+    else
+    {
+        theta = math::bit_cast<float>(tessVertexData.z);
+    }
+
+    float2 norm = {std::sin(theta), -std::cos(theta)};
+    float2 origin = bits_to_float2(tessVertexData.x, tessVertexData.y);
+    float2 postTransformVertexOffset = 0;
+    float4 coverages;
+
+    if (featherRadius != 0)
+    {
+        // Never let the feather get thinner than one pixel.
+        featherRadius =
+            std::max(featherRadius,
+                     (FEATHER_TEXTURE_STDDEVS / 3) / length(mul(M, norm)));
+    }
+
+    if (strokeRadius != 0)
+    {
+        // Ensure strokes always emit clockwise triangles.
+        outset *= sign_of(M.x * M.w - M.y * M.z);
+
+        // Joins only emit their outer side.
+        if (contourIDWithFlags & LEFT_JOIN_CONTOUR_FLAG)
+            outset = std::min(outset, 0.f);
+        else if (contourIDWithFlags & RIGHT_JOIN_CONTOUR_FLAG)
+            outset = std::max(outset, 0.f);
+
+        float aaRadius = featherRadius != 0
+                             ? featherRadius
+                             : manhattan_pixel_width(M, norm) * kAARadius;
+        float globalCoverage = 1;
+        if (aaRadius > strokeRadius && featherRadius == 0)
+        {
+            // Thin strokes fade out instead of getting thinner than a pixel.
+            globalCoverage = strokeRadius / aaRadius;
+            strokeRadius = aaRadius;
+        }
+
+        float2 vertexOffset = norm * (strokeRadius + aaRadius);
+        float x = outset * (strokeRadius + aaRadius);
+        float2 cov = (1.f / (aaRadius * 2)) * (float2{x, -x} + strokeRadius) +
+                     .5f;
+        coverages = {cov.x, cov.y, 0, 0};
+
+        uint32_t joinType = contourIDWithFlags & JOIN_TYPE_MASK;
+        if (joinType > ROUND_JOIN_CONTOUR_FLAG)
+        {
+            // Miter and bevel joins: clip the stroke along the bisector.
+            bool isTan0 = contourIDWithFlags & JOIN_TANGENT_0_CONTOUR_FLAG;
+            bool isLeftJoin = contourIDWithFlags & LEFT_JOIN_CONTOUR_FLAG;
+            int32_t peekDir = isTan0 ? 2 : -2;
+            if (mirroredContourFlag != 0)
+                peekDir = -peekDir;
+            float otherJoinTheta = math::bit_cast<float>(
+                data.tessTexel(tessVertexIdx + peekDir).z);
+            float joinAngle = std::abs(otherJoinTheta - theta);
+            if (joinAngle > math::PI)
+                joinAngle = 2 * math::PI - joinAngle;
+            float bisectTheta =
+                joinAngle * (isTan0 == isLeftJoin ? -.5f : .5f) + theta;
+            float2 bisector = {std::sin(bisectTheta), -std::cos(bisectTheta)};
+            float bisectPixelWidth = manhattan_pixel_width(M, bisector);
+
+            float miterRatio = std::cos(joinAngle * .5f);
+            float clipRadius;
+            if (joinType == MITER_CLIP_JOIN_CONTOUR_FLAG ||
+                (joinType == MITER_REVERT_JOIN_CONTOUR_FLAG &&
+                 miterRatio >= .25f))
+            {
+                // Miter the corner. (Emulated square caps use a limit of 1.)
+                float miterInverseLimit =
+                    (contourIDWithFlags & EMULATED_STROKE_CAP_CONTOUR_FLAG)
+                        ? 1.f
+                        : .25f;
+                clipRadius =
+                    strokeRadius * (1.f / std::max(miterRatio,
+                                                   miterInverseLimit));
+            }
+            else
+            {
+                // Bevel the corner.
+                clipRadius =
+                    strokeRadius * miterRatio + bisectPixelWidth * kAARadius;
+            }
+            float clipAARadius = clipRadius + bisectPixelWidth * kAARadius;
+
+            if (contourIDWithFlags & JOIN_TANGENT_INNER_CONTOUR_FLAG)
+            {
+                // Move the inner vertices to the clip line.
+                float strokeAARadius = strokeRadius + aaRadius;
+                float slop = aaRadius * .125f;
+                if (strokeAARadius <= clipAARadius * miterRatio + slop)
+                {
+                    vertexOffset = bisector * (strokeAARadius / miterRatio);
+                }
+                else
+                {
+                    float2 bisectAAOffset = bisector * clipAARadius;
+                    float2 k = {simd::dot(vertexOffset, vertexOffset),
+                                simd::dot(bisectAAOffset, bisectAAOffset)};
+                    vertexOffset =
+                        solve_dot_system(vertexOffset, bisectAAOffset, k);
+                }
+            }
+
+            float2 pt = std::abs(outset) * vertexOffset;
+            float clipDistance =
+                (clipAARadius - simd::dot(pt, bisector)) /
+                (bisectPixelWidth * (kAARadius * 2));
+            if (contourIDWithFlags & LEFT_JOIN_CONTOUR_FLAG)
+                coverages.y = clipDistance;
+            else
+                coverages.x = clipDistance;
+        }
+
+        coverages.x *= globalCoverage;
+        coverages.y *= globalCoverage;
+        // y must be >= 0 to signal a stroke.
+        coverages.y = std::max(coverages.y, 1e-4f);
+        if (featherRadius != 0)
+        {
+            // Signal a feathered stroke.
+            coverages.x = kFeatherCoverageBias - coverages.x;
+        }
+
+        postTransformVertexOffset = mul(M, outset * vertexOffset);
+
+        // Throw away fan triangles from strokes.
+        if (vertexType != STROKE_VERTEX)
+            return false;
+    }
+    else
+    {
+        // Fill. The negative y signals a fill.
+        coverages = {fillCoverage, -1, 0, 0};
+        if (featherRadius != 0)
+        {
+            coverages.y = kFeatherCoverageBias;
+            coverages.z = kHorizontalCotangentValue;
+            coverages.w = fillCoverage;
+            if ((contourIDWithFlags & JOIN_TYPE_MASK) ==
+                    FEATHER_JOIN_CONTOUR_FLAG &&
+                vertexType == STROKE_VERTEX)
+            {
+                // Feather join vertices need to know where they sit in the
+                // corner.
+                if (featherJoinCornerTheta < 0)
+                {
+                    featherJoinEdge0Theta += featherJoinCornerTheta;
+                    featherJoinCornerTheta = -featherJoinCornerTheta;
+                }
+                float spokeTheta = theta - featherJoinEdge0Theta;
+                float _2PI = 2 * math::PI;
+                spokeTheta += math::PI / 2;
+                spokeTheta -= _2PI * std::floor(spokeTheta / _2PI);
+                spokeTheta -= math::PI / 2;
+                spokeTheta =
+                    std::clamp(spokeTheta, 0.f, featherJoinCornerTheta);
+                if (spokeTheta > featherJoinCornerTheta * .5f)
+                    spokeTheta = featherJoinCornerTheta - spokeTheta;
+                float2 spokeNorm = {std::sin(spokeTheta),
+                                    std::cos(spokeTheta)};
+                coverages =
+                    pack_feathered_fill_coverages(featherJoinCornerTheta,
+                                                  spokeNorm,
+                                                  outset);
+            }
+            postTransformVertexOffset = mul(M, (outset * featherRadius) * norm);
+        }
+        else
+        {
+            // Offset by half a pixel in the direction of the normal, in screen
+            // space, for antialiasing.
+            float2 offset = solve_dot_system(float2{M.x, M.y},
+                                             float2{M.z, M.w},
+                                             outset * norm);
+            postTransformVertexOffset =
+                float2{sign_of(offset.x), sign_of(offset.y)} * kAARadius;
+        }
+
+        // Negate coverage for back-facing geometry.
+        if (static_cast<bool>(contourIDWithFlags &
+                              MIRRORED_CONTOUR_CONTOUR_FLAG) !=
+            static_cast<bool>(contourIDWithFlags &
+                              NEGATE_PATH_FILL_COVERAGE_FLAG))
+        {
+            coverages.x = -coverages.x;
+        }
+
+        if (vertexType == FAN_MIDPOINT_VERTEX)
+            origin = midpoint;
+
+        // Retrofitted triangles only emit fan vertices.
+        if ((contourIDWithFlags & RETROFITTED_TRIANGLE_CONTOUR_FLAG) &&
+            vertexType != FAN_VERTEX)
+            return false;
+    }
+
+    *outVertexPosition = mul(M, origin) + postTransformVertexOffset + translate;
+    *outCoverages = coverages;
+    return true;
+}
+
+// Runs a patch vertex stage over "instanceCount" instances and appends the
+// resulting triangles. Each instance's patch vertices are shaded once and
+// shared by its triangles.
+template <typename VertexShader>
+void emit_patch_triangles(FlushTaskScheduler* scheduler,
+                          const PatchVertex* patchVertices,
+                          const uint16_t* patchIndices,
+                          uint32_t patchIndexCount,
+                          uint32_t baseInstance,
+                          uint32_t instanceCount,
+                          uint32_t drawIdx,
+                          CullFace cullFace,
+                          const IAABB& scissor,
+                          const VertexShader& vertexShader,
+                          std::vector<CPURasterizer::Triangle>* triangles)
+{
+    uint32_t minIdx = ~0u, maxIdx = 0;
+    for (uint32_t i = 0; i < patchIndexCount; ++i)
+    {
+        minIdx = std::min<uint32_t>(minIdx, patchIndices[i]);
+        maxIdx = std::max<uint32_t>(maxIdx, patchIndices[i]);
+    }
+    size_t trianglesPerInstance = patchIndexCount / 3;
+    size_t firstTriangle = triangles->size();
+    triangles->resize(firstTriangle + trianglesPerInstance * instanceCount);
+    CPURasterizer::Triangle* out = triangles->data() + firstTriangle;
+
+    parallel_for_chunks(
+        scheduler,
+        instanceCount,
+        kInstancesPerTask,
+        [&](size_t begin, size_t end) {
+            std::vector<ShadedVertex> vertices(maxIdx - minIdx + 1);
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto instanceID = static_cast<uint32_t>(baseInstance + i);
+                for (uint32_t j = minIdx; j <= maxIdx; ++j)
+                {
+                    vertexShader(patchVertices[j],
+                                 instanceID,
+                                 &vertices[j - minIdx]);
+                }
+                for (size_t t = 0; t < trianglesPerInstance; ++t)
+                {
+                    CPURasterizer::Triangle& triangle =
+                        out[i * trianglesPerInstance + t];
+                    triangle.drawIdx = CPURasterizer::kCulledDrawIdx;
+                    const ShadedVertex* v[3];
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        v[k] = &vertices[patchIndices[t * 3 + k] - minIdx];
+                    }
+                    if (!v[0]->valid || !v[1]->valid || !v[2]->valid)
+                    {
+                        continue;
+                    }
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        triangle.points[k] = v[k]->position;
+                        triangle.varyings[k] = v[k]->varyings;
+                    }
+                    triangle.pathID = v[0]->pathID;
+                    triangle.drawIdx = drawIdx;
+                    triangle.setup(cullFace, scissor);
+                }
+            }
+        });
+}
+
+// Appends "triangleCount" triangles whose vertices are produced by
+// "vertexShader(vertexIdx, &shadedVertex)".
+template <typename VertexShader>
+void emit_triangles(FlushTaskScheduler* scheduler,
+                    uint32_t triangleCount,
+                    uint32_t drawIdx,
+                    CullFace cullFace,
+                    const IAABB& scissor,
+                    const VertexShader& vertexShader,
+                    std::vector<CPURasterizer::Triangle>* triangles)
+{
+    size_t firstTriangle = triangles->size();
+    triangles->resize(firstTriangle + triangleCount);
+    CPURasterizer::Triangle* out = triangles->data() + firstTriangle;
+    parallel_for_chunks(
+        scheduler,
+        triangleCount,
+        kTrianglesPerTask,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                CPURasterizer::Triangle& triangle = out[i];
+                ShadedVertex v[3];
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    vertexShader(static_cast<uint32_t>(i * 3 + k), &v[k]);
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    triangle.points[k] = v[k].position;
+                    triangle.varyings[k] = v[k].varyings;
+                }
+                triangle.pathID = v[0].pathID;
+                triangle.drawIdx = drawIdx;
+                triangle.setup(cullFace, scissor);
+            }
+        });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// draw_path.glsl and draw_image_mesh.glsl (fragment stage)
+
+struct DrawInfo
+{
+    DrawType drawType;
+    bool clockwiseFill; // DrawContents::clockwiseFill.
+    const TextureCPUImpl* imageTexture;
+    const float* imageDrawUniforms; // DrawType::imageMesh only.
+};
+
+class DrawFragmentShader
+{
+public:
+    DrawFragmentShader(const CPUFlushData& data,
+                       const std::vector<DrawInfo>& draws,
+                       CPURasterizer::PLSTexel* plsTexels,
+                       uint32_t* colorPlane,
+                       uint32_t width) :
+        m_data(data),
+        m_draws(draws),
+        m_plsTexels(plsTexels),
+        m_colorPlane(colorPlane),
+        m_width(width)
+    {}
+
+    void operator()(const CPURasterizer::Triangle& triangle,
+                    uint32_t x,
+                    uint32_t y,
+                    float4 varyings) const
+    {
+        const DrawInfo& draw = m_draws[triangle.drawIdx];
+        size_t pixelIdx = size_t(y) * m_width + x;
+        float2 fragCoord = {x + .5f, y + .5f};
+        if (draw.drawType == DrawType::imageMesh)
+        {
+            shadeImageMesh(draw, pixelIdx, fragCoord, varyings);
+        }
+        else
+        {
+            shadePath(triangle, draw, pixelIdx, fragCoord, varyings);
+        }
+    }
+
+private:
+    // Port of @drawFragmentMain from draw_path.glsl.
+    void shadePath(const CPURasterizer::Triangle& triangle,
+                   const DrawInfo& draw,
+                   size_t pixelIdx,
+                   float2 fragCoord,
+                   float4 varyings) const
+    {
+        CPURasterizer::PLSTexel& pls = m_plsTexels[pixelIdx];
+        uint32_t pathID = triangle.pathID;
+        uint2 paintData = m_data.paint(pathID);
+        uint32_t paintType = paintData.x & 0xfu;
+        bool isInterior = draw.drawType == DrawType::interiorTriangulation;
+        bool isAtlasBlit = draw.drawType == DrawType::atlasBlit;
+
+        float coverage;
+        bool isFirstHit = false;
+        if (isAtlasBlit)
+        {
+            coverage = filterFeatherAtlas(float2{varyings.x, varyings.y});
+        }
+        else
+        {
+            isFirstHit = pls.coveragePathID != pathID;
+            float coverageCount = isFirstHit ? 0.f : pls.coverageCount;
+            if (isInterior)
+            {
+                coverageCount += varyings.x;
+            }
+            else
+            {
+                if (varyings.y >= 0) // Stroke.
+                {
+                    float fragCoverage =
+                        varyings.x < kFeatherCoverageThreshold
+                            ? eval_feathered_stroke(varyings)
+                            : std::min(varyings.x, varyings.y);
+                    coverageCount = std::max(fragCoverage, coverageCount);
+                }
+                else // Fill. (Culling handles the sign of varyings.x.)
+                {
+                    coverageCount += varyings.y < kFeatherCoverageThreshold
+                                         ? eval_feathered_fill(varyings)
+                                         : varyings.x;
+                }
+                pls.coverageCount = coverageCount;
+                pls.coveragePathID = pathID;
+            }
+            if (draw.clockwiseFill)
+            {
+                coverage = std::clamp(coverageCount, 0.f, 1.f);
+            }
+            else
+            {
+                coverage = std::abs(coverageCount);
+                if (paintData.x & PAINT_FLAG_EVEN_ODD_FILL)
+                {
+                    float halfCoverage = coverage * .5f;
+                    coverage = 1.f - std::abs((halfCoverage -
+                                               std::floor(halfCoverage)) *
+                                                  2.f -
+                                              1.f);
+                }
+                // This also caps stroke coverage, which can be >1.
+                coverage = std::min(coverage, 1.f);
+            }
+        }
+
+        if (paintType == CLIP_UPDATE_PAINT_TYPE)
+        {
+            uint32_t clipID = paintData.y >> 16;
+            uint32_t outerClipID = paintData.x >> 16;
+            if (outerClipID != 0)
+            {
+                // Nested clip. Intersect with the enclosing clip.
+                float outerClipCoverage;
+                if (pls.clipID != clipID)
+                {
+                    outerClipCoverage =
+                        pls.clipID == outerClipID ? pls.clipCoverage : 0.f;
+                    if (!isInterior && !isAtlasBlit)
+                    {
+                        // Stash it in case we hit this pixel again.
+                        pls.scratchColor =
+                            pack_unorm4x8(float4{outerClipCoverage, 0, 0, 0});
+                    }
+                }
+                else
+                {
+                    outerClipCoverage = unpack_unorm4x8(pls.scratchColor).x;
+                }
+                coverage = std::min(coverage, outerClipCoverage);
+            }
+            pls.clipCoverage = coverage;
+            pls.clipID = clipID;
+            return;
+        }
+
+        uint32_t clipID = paintData.x >> 16;
+        if (clipID != 0)
+        {
+            coverage = pls.clipID == clipID
+                           ? std::min(pls.clipCoverage, coverage)
+                           : 0.f;
+        }
+        if (paintData.x & PAINT_FLAG_HAS_CLIP_RECT)
+        {
+            float4 clipRect = find_clip_rect_coverage_distances(
+                m_data.paintAux(pathID, 2),
+                m_data.paintAux(pathID, 3).xy,
+                fragCoord);
+            coverage = std::min(std::max(min_value(clipRect), 0.f), coverage);
+        }
+
+        float4 color = findPaintColor(pathID,
+                                      paintType,
+                                      paintData,
+                                      draw.imageTexture,
+                                      fragCoord,
+                                      coverage);
+
+        float4 dstColorPremul;
+        if (isAtlasBlit)
+        {
+            dstColorPremul = unpack_unorm4x8(m_colorPlane[pixelIdx]);
+        }
+        else if (isFirstHit)
+        {
+            // First fragment from this path to touch the pixel.
+            dstColorPremul = unpack_unorm4x8(m_colorPlane[pixelIdx]);
+            if (!isInterior)
+            {
+                pls.scratchColor = m_colorPlane[pixelIdx];
+            }
+        }
+        else
+        {
+            dstColorPremul = unpack_unorm4x8(pls.scratchColor);
+        }
+
+        uint32_t blendMode = (paintData.x >> 4) & 0xfu;
+        if (blendMode != BLEND_SRC_OVER)
+        {
+            float alpha = color.w;
+            color = advanced_color_blend(color, dstColorPremul, blendMode);
+            color.w = alpha;
+        }
+        color = premultiply(color);
+        color += dstColorPremul * (1.f - color.w);
+        m_colorPlane[pixelIdx] = pack_unorm4x8(color);
+    }
+
+    // Port of @drawFragmentMain from draw_image_mesh.glsl.
+    void shadeImageMesh(const DrawInfo& draw,
+                        size_t pixelIdx,
+                        float2 fragCoord,
+                        float4 varyings) const
+    {
+        CPURasterizer::PLSTexel& pls = m_plsTexels[pixelIdx];
+        const float* uniforms = draw.imageDrawUniforms;
+        float4 color = draw.imageTexture != nullptr
+                           ? draw.imageTexture->sample(
+                                 float2{varyings.x, varyings.y},
+                                 varyings.z)
+                           : float4(0);
+
+        float4 clipRect = find_clip_rect_coverage_distances(
+            simd::load4f(uniforms + 8),
+            float2{uniforms[12], uniforms[13]},
+            fragCoord);
+        float coverage = std::min(std::max(min_value(clipRect), 0.f), 1.f);
+
+        uint32_t clipID = math::bit_cast<uint32_t>(uniforms[14]);
+        if (clipID != 0)
+        {
+            coverage = std::min(coverage,
+                                pls.clipID == clipID ? pls.clipCoverage : 0.f);
+        }
+
+        float4 dstColorPremul = unpack_unorm4x8(m_colorPlane[pixelIdx]);
+        uint32_t blendMode = math::bit_cast<uint32_t>(uniforms[15]);
+        if (blendMode != BLEND_SRC_OVER)
+        {
+            float alpha = color.w;
+            color = advanced_color_blend(unmultiply(color),
+                                         dstColorPremul,
+                                         blendMode) *
+                    alpha;
+            color.w = alpha;
+        }
+        float opacity = uniforms[6];
+        color *= opacity * coverage;
+        color += dstColorPremul * (1.f - color.w);
+        m_colorPlane[pixelIdx] = pack_unorm4x8(color);
+    }
+
+    // Port of find_paint_color(), for the case where
+    // GENERATE_PREMULTIPLIED_PAINT_COLORS is false. Returns an unmultiplied
+    // color whose alpha has been multiplied by coverage.
+    float4 findPaintColor(uint32_t pathID,
+                          uint32_t paintType,
+                          uint2 paintData,
+                          const TextureCPUImpl* imageTexture,
+                          float2 fragCoord,
+                          float coverage) const
+    {
+        if (paintType == SOLID_COLOR_PAINT_TYPE)
+        {
+            float4 color = unpack_unorm4x8(paintData.y);
+            color.w *= coverage;
+            return color;
+        }
+
+        float4 paintMatrix = m_data.paintAux(pathID, 0);
+        float4 paintTranslate = m_data.paintAux(pathID, 1);
+        float2 paintCoord = mul(paintMatrix, fragCoord) + paintTranslate.xy;
+        if (paintType == LINEAR_GRADIENT_PAINT_TYPE ||
+            paintType == RADIAL_GRADIENT_PAINT_TYPE)
+        {
+            float t = paintType == LINEAR_GRADIENT_PAINT_TYPE
+                          ? paintCoord.x
+                          : length(paintCoord);
+            t = std::clamp(t, 0.f, 1.f);
+            // Complex ramps span an entire row. Simple ramps span two texels.
+            float x = paintTranslate.z > .9f
+                          ? (1.f - 1.f / kGradTextureWidth) * t +
+                                .5f / kGradTextureWidth
+                          : (1.f / kGradTextureWidth) * t + paintTranslate.w;
+            float row = math::bit_cast<float>(paintData.y);
+            float4 color = sampleGradient(x, row);
+            color.w *= coverage;
+            return color;
+        }
+
+        // Image paint.
+        if (imageTexture == nullptr)
+        {
+            return float4(0);
+        }
+        float4 color = imageTexture->sample(paintCoord, paintTranslate.z);
+        float opacity = math::bit_cast<float>(paintData.y) * coverage;
+        color = unmultiply(color);
+        color.w *= opacity;
+        return color;
+    }
+
+    // Linear filter, clamped to edge. The row is always sampled at its center.
+    float4 sampleGradient(float x, float row) const
+    {
+        float u = x * kGradTextureWidth - .5f;
+        u = u > 0 ? std::min(u, float(kGradTextureWidth - 1)) : 0.f;
+        float uFloor = std::floor(u);
+        auto i = static_cast<uint32_t>(uFloor);
+        uint32_t j = std::min(i + 1, kGradTextureWidth - 1);
+        float y = row * m_data.gradTextureHeight;
+        y = y > 0 ? std::min(y, float(m_data.gradTextureHeight - 1)) : 0.f;
+        const uint32_t* texels =
+            m_data.gradTexels +
+            static_cast<size_t>(y) * kGradTextureWidth;
+        return lerp(unpack_unorm4x8(texels[i]),
+                    unpack_unorm4x8(texels[j]),
+                    u - uFloor);
+    }
+
+    // Port of filter_feather_atlas().
+    float filterFeatherAtlas(float2 atlasCoord) const
+    {
+        float2 atlasQuadCenter = simd::floor(atlasCoord + .5f);
+        int32_t maxX = static_cast<int32_t>(m_data.atlasTextureWidth) - 1;
+        int32_t maxY = static_cast<int32_t>(m_data.atlasTextureHeight) - 1;
+        auto fetch = [&](float fx, float fy) {
+            int32_t ix = std::clamp(static_cast<int32_t>(fx), 0, maxX);
+            int32_t iy = std::clamp(static_cast<int32_t>(fy), 0, maxY);
+            // Convert from gaussian space back to linear.
+            return inverse_feather(
+                m_data.atlasTexels[size_t(iy) * m_data.atlasTextureWidth + ix]);
+        };
+        float2 c = simd::clamp(atlasQuadCenter,
+                               float2(0),
+                               float2{float(maxX + 1), float(maxY + 1)});
+        float c00 = fetch(c.x - 1, c.y - 1);
+        float c10 = fetch(c.x, c.y - 1);
+        float c01 = fetch(c.x - 1, c.y);
+        float c11 = fetch(c.x, c.y);
+        // Bilerp in linear space.
+        float2 t = atlasCoord + .5f - atlasQuadCenter;
+        float top = lerp(c00, c10, t.x);
+        float bottom = lerp(c01, c11, t.x);
+        // Go back to gaussian now that the bilerp is finished.
+        return feather(lerp(top, bottom, t.y));
+    }
+
+    const CPUFlushData& m_data;
+    const std::vector<DrawInfo>& m_draws;
+    CPURasterizer::PLSTexel* const m_plsTexels;
+    uint32_t* const m_colorPlane;
+    const uint32_t m_width;
+};
+} // namespace
+
+RenderContextCPUImpl::RenderContextCPUImpl(
+    const ContextOptions& contextOptions) :
+    m_taskScheduler(contextOptions.taskScheduler),
+    m_onFlushBuffers(contextOptions.onFlushBuffers),
+    m_rasterizer(std::make_unique<CPURasterizer>())
+{
+    m_platformFeatures.supportsRasterOrdering = true;
+    m_platformFeatures.supportsFragmentShaderAtomics = false;
+    m_platformFeatures.clipSpaceBottomUp = false;
+    m_platformFeatures.framebufferBottomUp = false;
+    m_platformFeatures.maxTextureSize = 16384;
+    m_platformFeatures.supportsPersistentAtlas = true;
+    GeneratePatchBufferData(m_patchVertices, m_patchIndices);
+}
+
+RenderContextCPUImpl::~RenderContextCPUImpl() {}
+
+std::unique_ptr<RenderContext> RenderContextCPUImpl::MakeContext(
+    const ContextOptions& contextOptions)
+{
+    auto renderContext =
+        std::make_unique<RenderContext>(std::unique_ptr<RenderContextImpl>(
+            new RenderContextCPUImpl(contextOptions)));
+    renderContext->setFlushTaskScheduler(contextOptions.taskScheduler);
+    return renderContext;
+}
+
+rcp<RenderBuffer> RenderContextCPUImpl::makeRenderBuffer(
+    RenderBufferType type,
+    RenderBufferFlags flags,
+    size_t sizeInBytes)
+{
+    return make_rcp<RenderBufferCPUImpl>(type, flags, sizeInBytes);
+}
+
+rcp<Texture> RenderContextCPUImpl::makeImageTexture(
+    uint32_t width,
+    uint32_t height,
+    uint32_t mipLevelCount,
+    const uint8_t imageDataRGBAPremul[])
+{
+    return make_rcp<TextureCPUImpl>(width,
+                                    height,
+                                    mipLevelCount,
+                                    imageDataRGBAPremul);
+}
+
+std::unique_ptr<BufferRing> RenderContextCPUImpl::makeUniformBufferRing(
+    size_t capacityInBytes)
+{
+    return std::make_unique<HeapBufferRing>(capacityInBytes);
+}
+
+std::unique_ptr<BufferRing> RenderContextCPUImpl::makeStorageBufferRing(
+    size_t capacityInBytes,
+    gpu::StorageBufferStructure)
+{
+    return std::make_unique<HeapBufferRing>(capacityInBytes);
+}
+
+std::unique_ptr<BufferRing> RenderContextCPUImpl::makeVertexBufferRing(
+    size_t capacityInBytes)
+{
+    return std::make_unique<HeapBufferRing>(capacityInBytes);
+}
+
+void RenderContextCPUImpl::resizeGradientTexture(uint32_t width,
+                                                 uint32_t height)
+{
+    assert(width == 0 || width == kGradTextureWidth);
+    m_gradTexture.resize(size_t(width) * height);
+    m_gradTextureHeight = height;
+}
+
+void RenderContextCPUImpl::resizeTessellationTexture(uint32_t width,
+                                                     uint32_t height)
+{
+    assert(width == 0 || width == kTessTextureWidth);
+    m_tessTexture.resize(size_t(width) * height * 4);
+}
+
+void RenderContextCPUImpl::resizeAtlasTexture(uint32_t width, uint32_t height)
+{
+    m_atlasTexture.resize(size_t(width) * height);
+    m_atlasTextureWidth = width;
+    m_atlasTextureHeight = height;
+}
+
+void RenderContextCPUImpl::renderColorRamps(const FlushDescriptor& desc)
+{
+    const auto* spans =
+        ring_contents<GradientSpan>(gradSpanBufferRing()) + desc.firstGradSpan;
+    for (uint32_t i = 0; i < desc.gradSpanCount; ++i)
+    {
+        // Each span is 3 horizontal rectangles: a solid color0 border, a
+        // color0 -> color1 ramp, and a solid color1 border.
+        const GradientSpan& span = spans[i];
+        float x0 = static_cast<float>(span.horizontalSpan & 0xffff) / 65536.f;
+        float x1 = static_cast<float>(span.horizontalSpan >> 16) / 65536.f;
+        float left = x0, right = x1;
+        if (span.yWithFlags & GRAD_SPAN_FLAG_LEFT_BORDER)
+        {
+            left = (span.yWithFlags & GRAD_SPAN_FLAG_COMPLEX_BORDER)
+                       ? 0.f
+                       : x0 - GRAD_TEXTURE_INVERSE_WIDTH;
+        }
+        if (span.yWithFlags & GRAD_SPAN_FLAG_RIGHT_BORDER)
+        {
+            right = (span.yWithFlags & GRAD_SPAN_FLAG_COMPLEX_BORDER)
+                        ? 1.f
+                        : x1 + GRAD_TEXTURE_INVERSE_WIDTH;
+        }
+        uint32_t y = span.yWithFlags & ~GRAD_SPAN_FLAGS_MASK;
+        if (y >= m_gradTextureHeight)
+        {
+            continue;
+        }
+        // ColorInt is ARGB.
+        auto unpackColorInt = [](uint32_t color) {
+            uint4 c = (uint4(color) >> uint4{16, 8, 0, 24}) & 0xffu;
+            return simd::cast<float>(c) * (1.f / 255);
+        };
+        float4 color0 = unpackColorInt(span.color0);
+        float4 color1 = unpackColorInt(span.color1);
+        uint32_t* row = m_gradTexture.data() + size_t(y) * kGradTextureWidth;
+        for (uint32_t x = 0; x < kGradTextureWidth; ++x)
+        {
+            float center = (x + .5f) * GRAD_TEXTURE_INVERSE_WIDTH;
+            if (center < left || center >= right)
+            {
+                continue;
+            }
+            float4 color = center < x0    ? color0
+                           : center >= x1 ? color1
+                                          : lerp(color0,
+                                                 color1,
+                                                 (center - x0) / (x1 - x0));
+            row[x] = pack_unorm4x8(color);
+        }
+    }
+}
+
+void RenderContextCPUImpl::renderTessellationTexture(
+    const FlushDescriptor& desc,
+    const CPUFlushData& data)
+{
+    const auto* spans = ring_contents<TessVertexSpan>(tessSpanBufferRing()) +
+                        desc.firstTessVertexSpan;
+    uint32_t* tessTexels = m_tessTexture.data();
+    uint32_t tessTextureHeight = desc.tessDataHeight;
+    parallel_for_chunks(m_taskScheduler,
+                        desc.tessVertexSpanCount,
+                        kTessSpansPerTask,
+                        [&](size_t begin, size_t end) {
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                tessellate_span(data,
+                                                spans[i],
+                                                tessTexels,
+                                                tessTextureHeight);
+                            }
+                        });
+}
+
+void RenderContextCPUImpl::renderAtlas(const FlushDescriptor& desc,
+                                       const CPUFlushData& data)
+{
+    // Clear the content area, except for the rows that hold cached masks.
+    for (uint32_t y = desc.atlasCacheHeight; y < desc.atlasContentHeight; ++y)
+    {
+        std::fill_n(m_atlasTexture.data() + size_t(y) * m_atlasTextureWidth,
+                    desc.atlasContentWidth,
+                    0.f);
+    }
+
+    // Port of @atlasVertexMain. Vertices get offset from on-screen coordinates
+    // to atlas coordinates.
+    auto vertexShader = [&data](const PatchVertex& patchVertex,
+                                uint32_t instanceID,
+                                ShadedVertex* out) {
+        out->valid = unpack_tessellated_path_vertex(data,
+                                                    patchVertex,
+                                                    instanceID,
+                                                    &out->pathID,
+                                                    &out->position,
+                                                    &out->varyings);
+        if (out->valid)
+        {
+            float4 atlasTransform = data.pathf(out->pathID, 2);
+            out->position = out->position * atlasTransform.y +
+                            float2{atlasTransform.z, atlasTransform.w};
+        }
+    };
+
+    // Fills accumulate (drawIdx 0), strokes take the max (drawIdx 1).
+    std::vector<CPURasterizer::Triangle>& triangles =
+        m_rasterizer->triangles();
+    triangles.clear();
+    for (size_t i = 0; i < desc.atlasFillBatchCount; ++i)
+    {
+        const AtlasDrawBatch& batch = desc.atlasFillBatches[i];
+        emit_patch_triangles(m_taskScheduler,
+                             m_patchVertices,
+                             m_patchIndices +
+                                 kMidpointFanCenterAAPatchBaseIndex,
+                             kMidpointFanCenterAAPatchIndexCount,
+                             batch.basePatch,
+                             batch.patchCount,
+                             0,
+                             CullFace::counterclockwise,
+                             IAABB{batch.scissor.left,
+                                   batch.scissor.top,
+                                   batch.scissor.right,
+                                   batch.scissor.bottom},
+                             vertexShader,
+                             &triangles);
+    }
+    for (size_t i = 0; i < desc.atlasStrokeBatchCount; ++i)
+    {
+        const AtlasDrawBatch& batch = desc.atlasStrokeBatches[i];
+        emit_patch_triangles(m_taskScheduler,
+                             m_patchVertices,
+                             m_patchIndices + kMidpointFanPatchBaseIndex,
+                             kMidpointFanPatchBorderIndexCount,
+                             batch.basePatch,
+                             batch.patchCount,
+                             1,
+                             CullFace::counterclockwise,
+                             IAABB{batch.scissor.left,
+                                   batch.scissor.top,
+                                   batch.scissor.right,
+                                   batch.scissor.bottom},
+                             vertexShader,
+                             &triangles);
+    }
+
+    float* atlasTexels = m_atlasTexture.data();
+    size_t atlasStride = m_atlasTextureWidth;
+    m_rasterizer->rasterize(
+        m_taskScheduler,
+        desc.atlasContentWidth,
+        desc.atlasContentHeight,
+        [=](const CPURasterizer::Triangle& triangle,
+            uint32_t x,
+            uint32_t y,
+            float4 coverages) {
+            float& texel = atlasTexels[size_t(y) * atlasStride + x];
+            if (triangle.drawIdx == 0)
+            {
+                texel += eval_feathered_fill(coverages);
+            }
+            else
+            {
+                texel = std::max(texel, eval_feathered_stroke(coverages));
+            }
+        });
+}
+
+void RenderContextCPUImpl::renderDrawList(const FlushDescriptor& desc,
+                                          const CPUFlushData& data)
+{
+    auto renderTarget = static_cast<RenderTargetCPU*>(desc.renderTarget);
+    uint32_t width = renderTarget->width();
+    uint32_t height = renderTarget->height();
+    uint32_t* colorPlane = renderTarget->pixels();
+    if (desc.colorLoadAction == LoadAction::clear)
+    {
+        std::fill_n(colorPlane,
+                    size_t(width) * height,
+                    SwizzleRiveColorToRGBAPremul(desc.colorClearValue));
+    }
+    CPURasterizer::PLSTexel* plsTexels =
+        m_rasterizer->resetPLSTexels(width, height);
+
+    const IAABB viewport = {0,
+                            0,
+                            static_cast<int32_t>(width),
+                            static_cast<int32_t>(height)};
+    const auto* triangleVertices =
+        desc.hasTriangleVertices
+            ? ring_contents<float>(triangleBufferRing())
+            : nullptr;
+    const auto* imageDrawUniformData =
+        ring_contents<uint8_t>(imageDrawUniformBufferRing());
+
+    // Run the vertex stages.
+    std::vector<CPURasterizer::Triangle>& triangles =
+        m_rasterizer->triangles();
+    triangles.clear();
+    std::vector<DrawInfo> draws;
+    for (const DrawBatch& batch : *desc.drawList)
+    {
+        if (batch.elementCount == 0)
+        {
+            continue;
+        }
+
+        auto drawIdx = static_cast<uint32_t>(draws.size());
+        DrawInfo& draw = draws.emplace_back();
+        draw.drawType = batch.drawType;
+        draw.clockwiseFill = static_cast<bool>(batch.drawContents &
+                                               DrawContents::clockwiseFill);
+        draw.imageTexture =
+            static_cast<const TextureCPUImpl*>(batch.imageTexture);
+        draw.imageDrawUniforms = nullptr;
+
+        PipelineState pipelineState;
+        get_pipeline_state(batch.drawType,
+                           desc.interlockMode,
+                           batch.drawContents,
+                           &pipelineState);
+
+        switch (batch.drawType)
+        {
+            case DrawType::midpointFanPatches:
+            case DrawType::midpointFanCenterAAPatches:
+            case DrawType::outerCurvePatches:
+            {
+                emit_patch_triangles(
+                    m_taskScheduler,
+                    m_patchVertices,
+                    m_patchIndices + PatchBaseIndex(batch.drawType),
+                    PatchIndexCount(batch.drawType),
+                    batch.baseElement,
+                    batch.elementCount,
+                    drawIdx,
+                    pipelineState.cullFace,
+                    viewport,
+                    [&data](const PatchVertex& patchVertex,
+                            uint32_t instanceID,
+                            ShadedVertex* out) {
+                        out->valid =
+                            unpack_tessellated_path_vertex(data,
+                                                           patchVertex,
+                                                           instanceID,
+                                                           &out->pathID,
+                                                           &out->position,
+                                                           &out->varyings);
+                    },
+                    &triangles);
+                break;
+            }
+            case DrawType::interiorTriangulation:
+            case DrawType::atlasBlit:
+            {
+                if (triangleVertices == nullptr)
+                {
+                    break;
+                }
+                bool isAtlasBlit = batch.drawType == DrawType::atlasBlit;
+                emit_triangles(
+                    m_taskScheduler,
+                    batch.elementCount / 3,
+                    drawIdx,
+                    pipelineState.cullFace,
+                    viewport,
+                    [&data, triangleVertices, isAtlasBlit, &batch](
+                        uint32_t vertexIdx,
+                        ShadedVertex* out) {
+                        const float* v =
+                            triangleVertices +
+                            (size_t(batch.baseElement) + vertexIdx) * 3;
+                        auto weight_pathID = math::bit_cast<int32_t>(v[2]);
+                        uint32_t pathID = weight_pathID & 0xffff;
+                        float2 pos = {v[0], v[1]};
+                        out->pathID = pathID;
+                        out->valid = true;
+                        if (isAtlasBlit)
+                        {
+                            // Port of unpack_atlas_coverage_vertex(). Vertices
+                            // are already in screen space.
+                            float4 atlasTransform = data.pathf(pathID, 2);
+                            float2 atlasCoord =
+                                pos * atlasTransform.y +
+                                float2{atlasTransform.z, atlasTransform.w};
+                            out->position = pos;
+                            out->varyings = {atlasCoord.x, atlasCoord.y, 0, 0};
+                        }
+                        else
+                        {
+                            // Port of unpack_interior_triangle_vertex().
+                            float4 M = data.pathf(pathID, 0);
+                            uint4 pathData = data.path(pathID, 1);
+                            out->position =
+                                mul(M, pos) +
+                                bits_to_float2(pathData.x, pathData.y);
+                            out->varyings = {
+                                static_cast<float>(weight_pathID >> 16),
+                                0,
+                                0,
+                                0};
+                        }
+                    },
+                    &triangles);
+                break;
+            }
+            case DrawType::imageMesh:
+            {
+                LITE_RTTI_CAST_OR_BREAK(vertexBuffer,
+                                        RenderBufferCPUImpl*,
+                                        batch.vertexBuffer);
+                LITE_RTTI_CAST_OR_BREAK(uvBuffer,
+                                        RenderBufferCPUImpl*,
+                                        batch.uvBuffer);
+                LITE_RTTI_CAST_OR_BREAK(indexBuffer,
+                                        RenderBufferCPUImpl*,
+                                        batch.indexBuffer);
+                const float* uniforms = reinterpret_cast<const float*>(
+                    imageDrawUniformData + batch.imageDrawDataOffset);
+                draw.imageDrawUniforms = uniforms;
+                const auto* positions =
+                    reinterpret_cast<const float*>(vertexBuffer->contents());
+                const auto* uvs =
+                    reinterpret_cast<const float*>(uvBuffer->contents());
+                const auto* indices =
+                    reinterpret_cast<const uint16_t*>(indexBuffer->contents()) +
+                    batch.baseElement;
+                float4 M = simd::load4f(uniforms);
+                float2 translate = {uniforms[4], uniforms[5]};
+                size_t firstTriangle = triangles.size();
+                emit_triangles(
+                    m_taskScheduler,
+                    batch.elementCount / 3,
+                    drawIdx,
+                    pipelineState.cullFace,
+                    viewport,
+                    [=](uint32_t vertexIdx, ShadedVertex* out) {
+                        uint16_t idx = indices[vertexIdx];
+                        out->position =
+                            mul(M, float2{positions[idx * 2],
+                                          positions[idx * 2 + 1]}) +
+                            translate;
+                        out->varyings = {uvs[idx * 2], uvs[idx * 2 + 1], 0, 0};
+                        out->pathID = 0;
+                        out->valid = true;
+                    },
+                    &triangles);
+                if (draw.imageTexture != nullptr)
+                {
+                    // The GPU finds the mip level from screen-space
+                    // derivatives. The UVs are affine across each triangle, so
+                    // one level per triangle is equivalent.
+                    float2 textureSize = {
+                        static_cast<float>(draw.imageTexture->width()),
+                        static_cast<float>(draw.imageTexture->height())};
+                    for (size_t i = firstTriangle; i < triangles.size(); ++i)
+                    {
+                        CPURasterizer::Triangle& triangle = triangles[i];
+                        if (triangle.drawIdx == CPURasterizer::kCulledDrawIdx)
+                        {
+                            continue;
+                        }
+                        float2 dp1 = triangle.points[1] - triangle.points[0];
+                        float2 dp2 = triangle.points[2] - triangle.points[0];
+                        float2 duv1 = (triangle.varyings[1].xy -
+                                       triangle.varyings[0].xy) *
+                                      textureSize;
+                        float2 duv2 = (triangle.varyings[2].xy -
+                                       triangle.varyings[0].xy) *
+                                      textureSize;
+                        float det = dp1.x * dp2.y - dp1.y * dp2.x;
+                        float2 dUVdx = (duv1 * dp2.y - duv2 * dp1.y) / det;
+                        float2 dUVdy = (duv2 * dp1.x - duv1 * dp2.x) / det;
+                        float lod =
+                            .5f * std::log2(std::max(simd::dot(dUVdx, dUVdx),
+                                                     simd::dot(dUVdy, dUVdy)));
+                        for (float4& varyings : triangle.varyings)
+                        {
+                            varyings.z = lod;
+                        }
+                    }
+                }
+                break;
+            }
+            case DrawType::imageRect:
+            case DrawType::atomicInitialize:
+            case DrawType::atomicResolve:
+            case DrawType::msaaStrokes:
+            case DrawType::msaaMidpointFanBorrowedCoverage:
+            case DrawType::msaaMidpointFans:
+            case DrawType::msaaMidpointFanStencilReset:
+            case DrawType::msaaMidpointFanPathsStencil:
+            case DrawType::msaaMidpointFanPathsCover:
+            case DrawType::msaaOuterCubics:
+            case DrawType::msaaStencilClipReset:
+                RIVE_UNREACHABLE();
+        }
+    }
+
+    // Run the fragment stages.
+    m_rasterizer->rasterize(
+        m_taskScheduler,
+        width,
+        height,
+        DrawFragmentShader(data, draws, plsTexels, colorPlane, width));
+}
+
+void RenderContextCPUImpl::flush(const FlushDescriptor& desc)
+{
+    if (desc.interlockMode != InterlockMode::rasterOrdering)
+    {
+        // Frames that ask for msaa (or any other mode) would need draw types
+        // that have no CPU port. Drop the flush and leave the target as is.
+        fprintf(stderr,
+                "RenderContextCPUImpl: unsupported interlock mode %i; "
+                "skipping flush\n",
+                static_cast<int>(desc.interlockMode));
+        return;
+    }
+
+    if (m_onFlushBuffers)
+    {
+        const auto* spans =
+            ring_contents<TessVertexSpan>(tessSpanBufferRing());
+        const auto* contours = ring_contents<ContourData>(contourBufferRing());
+        m_onFlushBuffers(
+            {spans == nullptr ? nullptr : spans + desc.firstTessVertexSpan,
+             desc.tessVertexSpanCount},
+            {contours == nullptr ? nullptr : contours + desc.firstContour,
+             desc.contourCount});
+    }
+
+    CPUFlushData data;
+    data.paths = ring_contents<uint32_t>(pathBufferRing());
+    if (data.paths != nullptr)
+    {
+        data.paths += desc.firstPath * 16;
+    }
+    data.paints = ring_contents<uint32_t>(paintBufferRing());
+    if (data.paints != nullptr)
+    {
+        data.paints += desc.firstPaint * 2;
+    }
+    data.paintAuxes = ring_contents<float>(paintAuxBufferRing());
+    if (data.paintAuxes != nullptr)
+    {
+        data.paintAuxes += desc.firstPaintAux * 16;
+    }
+    data.contours = ring_contents<uint32_t>(contourBufferRing());
+    if (data.contours != nullptr)
+    {
+        data.contours += desc.firstContour * 4;
+    }
+    data.contourCount = desc.contourCount;
+    data.tessTexels = m_tessTexture.data();
+    data.tessTexelCount =
+        std::min<size_t>(m_tessTexture.size() / 4,
+                         size_t(desc.tessDataHeight) * kTessTextureWidth);
+    data.gradTexels = m_gradTexture.data();
+    data.gradTextureHeight = m_gradTextureHeight;
+    data.atlasTexels = m_atlasTexture.data();
+    data.atlasTextureWidth = m_atlasTextureWidth;
+    data.atlasTextureHeight = m_atlasTextureHeight;
+
+    if (desc.gradSpanCount > 0)
+    {
+        renderColorRamps(desc);
+    }
+
+    if (desc.tessVertexSpanCount > 0)
+    {
+        renderTessellationTexture(desc, data);
+    }
+
+    if ((desc.atlasFillBatchCount | desc.atlasStrokeBatchCount) != 0)
+    {
+        renderAtlas(desc, data);
+    }
+
+    renderDrawList(desc, data);
+}
+} // namespace rive::gpu
@@ -4,6 +4,7 @@
 
 #include "rive/renderer/draw.hpp"
 
+#include "atlas_cache.hpp"
 #include "gr_inner_fan_triangulator.hpp"
 #include "rive_render_path.hpp"
 #include "rive_render_paint.hpp"
@@ -11,6 +12,7 @@
 #include "rive/math/wangs_formula.hpp"
 #include "rive/renderer/texture.hpp"
 #include "gradient.hpp"
+#include "triangulation_cache.hpp"
 #include "shaders/constants.glsl"
 
 namespace rive::gpu
@@ -1335,6 +1337,7 @@ void PathDraw::initForInteriorTriangulation(RenderContext* context,
     iterateInteriorTriangulation(
         InteriorTriangulationOp::countDataAndTriangulate,
         &context->perFrameAllocator(),
+        context->m_triangulationCache.get(),
         scratchPath,
         triangulatorAxis,
         nullptr);
@@ -1379,8 +1382,20 @@ bool PathDraw::allocateResources(RenderContext::LogicalFlush* flush)
                 ceilf(visibleBounds.width() * scaleFactor));
             auto h = static_cast<uint16_t>(
                 ceilf(visibleBounds.height() * scaleFactor));
+            AtlasCacheKey cacheKey;
+            cacheKey.rawPathMutationID = m_pathRef->getRawPathMutationID();
+            cacheKey.matrix = m_matrix;
+            cacheKey.visibleBounds = visibleBounds;
+            cacheKey.strokeRadius = m_strokeRadius;
+            cacheKey.featherRadius = m_featherRadius;
+            cacheKey.fillRule = m_pathFillRule;
+            cacheKey.strokeJoin = m_strokeJoin;
+            cacheKey.strokeCap = m_strokeCap;
+            cacheKey.contourDirections = m_contourDirections;
+            cacheKey.contourFlags = m_contourFlags;
             uint16_t x, y;
             if (!flush->allocateAtlasDraw(this,
+                                          &cacheKey,
                                           w,
                                           h,
                                           PADDING,
@@ -1697,20 +1712,30 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                                     uint32_t tessVertexCount,
                                     uint32_t tessLocation)
 {
-    // Determine where to fill in forward and mirrored tessellations.
-    uint32_t forwardTessVertexCount, forwardTessLocation,
-        mirroredTessVertexCount, mirroredTessLocation;
+    if (!flush->deferTessellationData(this, tessVertexCount, tessLocation))
+    {
+        writeTessellationData(flush, tessVertexCount, tessLocation, nullptr);
+    }
+}
+
+void PathDraw::resolveTessellationRanges(uint32_t tessVertexCount,
+                                         uint32_t tessLocation,
+                                         uint32_t* forwardTessVertexCount,
+                                         uint32_t* forwardTessLocation,
+                                         uint32_t* mirroredTessVertexCount,
+                                         uint32_t* mirroredTessLocation) const
+{
     switch (m_contourDirections)
     {
         case gpu::ContourDirections::forward:
-            forwardTessVertexCount = tessVertexCount;
-            forwardTessLocation = tessLocation;
-            mirroredTessLocation = mirroredTessVertexCount = 0;
+            *forwardTessVertexCount = tessVertexCount;
+            *forwardTessLocation = tessLocation;
+            *mirroredTessLocation = *mirroredTessVertexCount = 0;
             break;
         case gpu::ContourDirections::reverse:
-            forwardTessVertexCount = forwardTessLocation = 0;
-            mirroredTessVertexCount = tessVertexCount;
-            mirroredTessLocation = tessLocation + tessVertexCount;
+            *forwardTessVertexCount = *forwardTessLocation = 0;
+            *mirroredTessVertexCount = tessVertexCount;
+            *mirroredTessLocation = tessLocation + tessVertexCount;
             break;
         case gpu::ContourDirections::reverseThenForward:
             if (m_coverageType == CoverageType::clockwiseAtomic && !isStroke())
@@ -1721,10 +1746,10 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                 assert(m_prepassTessLocation != 0); // With padding, this will
                                                     // only be zero if it wasn't
                                                     // initialized.
-                forwardTessVertexCount = mirroredTessVertexCount =
+                *forwardTessVertexCount = *mirroredTessVertexCount =
                     tessVertexCount;
-                forwardTessLocation = tessLocation;
-                mirroredTessLocation = m_prepassTessLocation + tessVertexCount;
+                *forwardTessLocation = tessLocation;
+                *mirroredTessLocation = m_prepassTessLocation + tessVertexCount;
             }
             else
             {
@@ -1732,9 +1757,9 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                 // contiguously, with a combined vertex count of
                 // "tessVertexCount". (tessVertexCount/2 vertices each.)
                 assert(tessVertexCount % 2 == 0);
-                forwardTessVertexCount = mirroredTessVertexCount =
+                *forwardTessVertexCount = *mirroredTessVertexCount =
                     tessVertexCount / 2;
-                forwardTessLocation = mirroredTessLocation =
+                *forwardTessLocation = *mirroredTessLocation =
                     tessLocation + tessVertexCount / 2;
             }
             break;
@@ -1747,10 +1772,10 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                 assert(m_prepassTessLocation != 0); // With padding, this will
                                                     // only be zero if it wasn't
                                                     // initialized.
-                forwardTessVertexCount = mirroredTessVertexCount =
+                *forwardTessVertexCount = *mirroredTessVertexCount =
                     tessVertexCount;
-                forwardTessLocation = m_prepassTessLocation;
-                mirroredTessLocation = tessLocation + tessVertexCount;
+                *forwardTessLocation = m_prepassTessLocation;
+                *mirroredTessLocation = tessLocation + tessVertexCount;
             }
             else
             {
@@ -1758,13 +1783,63 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                 // contiguously, with a combined vertex count of
                 // "tessVertexCount". (tessVertexCount/2 vertices each.)
                 assert(tessVertexCount % 2 == 0);
-                forwardTessVertexCount = mirroredTessVertexCount =
+                *forwardTessVertexCount = *mirroredTessVertexCount =
                     tessVertexCount / 2;
-                forwardTessLocation = tessLocation;
-                mirroredTessLocation = tessLocation + tessVertexCount;
+                *forwardTessLocation = tessLocation;
+                *mirroredTessLocation = tessLocation + tessVertexCount;
             }
             break;
     }
+}
+
+// Number of times a span over [begin, end) in the tessellation texture wraps
+// to a new row.
+static uint32_t tess_row_breaks(uint32_t begin, uint32_t end)
+{
+    if (end <= begin)
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>((end - 1) / kTessTextureWidth -
+                                 begin / kTessTextureWidth);
+}
+
+uint32_t PathDraw::maxTessSpanCount(uint32_t tessVertexCount,
+                                    uint32_t tessLocation) const
+{
+    uint32_t forwardTessVertexCount, forwardTessLocation,
+        mirroredTessVertexCount, mirroredTessLocation;
+    resolveTessellationRanges(tessVertexCount,
+                              tessLocation,
+                              &forwardTessVertexCount,
+                              &forwardTessLocation,
+                              &mirroredTessVertexCount,
+                              &mirroredTessLocation);
+    // Every segment gets one span, plus one more each time the forward or the
+    // mirrored range wraps (double sided spans wrap both at once).
+    return math::lossless_numeric_cast<uint32_t>(
+               m_resourceCounts.maxTessellatedSegmentCount) +
+           tess_row_breaks(forwardTessLocation,
+                           forwardTessLocation + forwardTessVertexCount) +
+           tess_row_breaks(mirroredTessLocation - mirroredTessVertexCount,
+                           mirroredTessLocation);
+}
+
+void PathDraw::writeTessellationData(
+    RenderContext::LogicalFlush* flush,
+    uint32_t tessVertexCount,
+    uint32_t tessLocation,
+    RenderContext::DeferredTessellation* deferred)
+{
+    // Determine where to fill in forward and mirrored tessellations.
+    uint32_t forwardTessVertexCount, forwardTessLocation,
+        mirroredTessVertexCount, mirroredTessLocation;
+    resolveTessellationRanges(tessVertexCount,
+                              tessLocation,
+                              &forwardTessVertexCount,
+                              &forwardTessLocation,
+                              &mirroredTessVertexCount,
+                              &mirroredTessLocation);
 
     // Write out the TessVertexSpans and path contours.
     RenderContext::TessellationWriter tessWriter(flush,
@@ -1773,7 +1848,8 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
                                                  forwardTessVertexCount,
                                                  forwardTessLocation,
                                                  mirroredTessVertexCount,
-                                                 mirroredTessLocation);
+                                                 mirroredTessLocation,
+                                                 deferred);
 
     if (m_triangulator != nullptr)
     {
@@ -1781,6 +1857,7 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
             InteriorTriangulationOp::pushOuterCubicTessellationData,
             nullptr,
             nullptr,
+            nullptr,
             TriangulatorAxis::dontCare,
             &tessWriter);
     }
@@ -2200,6 +2277,7 @@ void PathDraw::pushEmulatedStrokeCapAsJoinBeforeCubic(
 void PathDraw::iterateInteriorTriangulation(
     InteriorTriangulationOp op,
     TrivialBlockAllocator* allocator,
+    TriangulationCache* triangulationCache,
     RawPath* scratchPath,
     TriangulatorAxis triangulatorAxis,
     RenderContext::TessellationWriter* tessWriter)
@@ -2368,25 +2446,43 @@ void PathDraw::iterateInteriorTriangulation(
     {
         assert(m_triangulator == nullptr);
         assert(triangulatorAxis != TriangulatorAxis::dontCare);
-        m_triangulator = allocator->make<GrInnerFanTriangulator>(
-            *scratchPath,
+        float matrixDeterminant =
+            m_matrix[0] * m_matrix[3] - m_matrix[2] * m_matrix[1];
+        TriangulationCache::Key key = {
+            m_pathRef->getRawPathMutationID(),
             m_matrix,
-            triangulatorAxis == TriangulatorAxis::horizontal
-                ? GrTriangulator::Comparator::Direction::kHorizontal
-                : GrTriangulator::Comparator::Direction::kVertical,
             // clockwise and nonZero paths both get triangulated as nonZero,
             // because clockwise fill still needs the backwards triangles for
             // borrowed coverage.
             m_pathFillRule == FillRule::evenOdd ? FillRule::evenOdd
                                                 : FillRule::nonZero,
-            allocator);
-        float matrixDeterminant =
-            m_matrix[0] * m_matrix[3] - m_matrix[2] * m_matrix[1];
-        if ((matrixDeterminant < 0) !=
-            static_cast<bool>(m_contourFlags & NEGATE_PATH_FILL_COVERAGE_FLAG))
-        {
-            m_triangulator->negateWinding();
-        }
+            triangulatorAxis == TriangulatorAxis::horizontal
+                ? GrTriangulator::Comparator::Direction::kHorizontal
+                : GrTriangulator::Comparator::Direction::kVertical,
+            (matrixDeterminant < 0) != static_cast<bool>(
+                                           m_contourFlags &
+                                           NEGATE_PATH_FILL_COVERAGE_FLAG),
+        };
+        auto makeTriangulator = [&](TrivialBlockAllocator* triangulatorAlloc) {
+            auto* triangulator =
+                triangulatorAlloc->make<GrInnerFanTriangulator>(
+                    *scratchPath,
+                    m_matrix,
+                    key.direction,
+                    key.fillRule,
+                    triangulatorAlloc);
+            if (key.negateWinding)
+            {
+                triangulator->negateWinding();
+            }
+            return triangulator;
+        };
+        m_triangulator =
+            triangulationCache != nullptr
+                ? triangulationCache->findOrMake(key,
+                                                 allocator,
+                                                 makeTriangulator)
+                : makeTriangulator(allocator);
         // We also draw each "grout" triangle using an outerCubic patch.
         patchCount += m_triangulator->groutList().count();
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/renderer/file_draw_requirements.hpp"
+
+#include "rive/artboard.hpp"
+#include "rive/drawable.hpp"
+#include "rive/file.hpp"
+#include "rive/layout_component.hpp"
+#include "rive/shapes/clipping_shape.hpp"
+#include "rive/shapes/image.hpp"
+#include "rive/shapes/mesh.hpp"
+#include "rive/shapes/paint/feather.hpp"
+#include "rive/shapes/paint/fill.hpp"
+#include "rive/shapes/paint/shape_paint.hpp"
+#include "rive/text/text.hpp"
+
+namespace rive::gpu
+{
+static ShaderFeatures blend_mode_shader_features(BlendMode blendMode)
+{
+    switch (blendMode)
+    {
+        case BlendMode::hue:
+        case BlendMode::saturation:
+        case BlendMode::color:
+        case BlendMode::luminosity:
+            return ShaderFeatures::ENABLE_ADVANCED_BLEND |
+                   ShaderFeatures::ENABLE_HSL_BLEND_MODES;
+        case BlendMode::screen:
+        case BlendMode::overlay:
+        case BlendMode::darken:
+        case BlendMode::lighten:
+        case BlendMode::colorDodge:
+        case BlendMode::colorBurn:
+        case BlendMode::hardLight:
+        case BlendMode::softLight:
+        case BlendMode::difference:
+        case BlendMode::exclusion:
+        case BlendMode::multiply:
+            return ShaderFeatures::ENABLE_ADVANCED_BLEND;
+        case BlendMode::srcOver:
+            break;
+    }
+    return ShaderFeatures::NONE;
+}
+
+FileDrawRequirements FindFileDrawRequirements(const File& file)
+{
+    FileDrawRequirements requirements;
+    for (size_t i = 0; i < file.artboardCount(); ++i)
+    {
+        // Clips can nest once there is more than one of them, e.g., a clipping
+        // shape inside a clipped artboard.
+        size_t clipCount = 0;
+        for (const Core* object : file.artboard(i)->objects())
+        {
+            if (object == nullptr)
+            {
+                continue;
+            }
+            if (object->is<ClippingShape>())
+            {
+                ++clipCount;
+            }
+            else if (object->is<LayoutComponent>())
+            {
+                // Includes the artboard itself.
+                clipCount += object->as<LayoutComponent>()->clip();
+            }
+            else if (object->is<Text>())
+            {
+                clipCount += object->as<Text>()->overflow() ==
+                             TextOverflow::clipped;
+            }
+            else if (object->is<Feather>())
+            {
+                requirements.shaderFeatures |= ShaderFeatures::ENABLE_FEATHER;
+            }
+            else if (object->is<Image>() || object->is<Mesh>())
+            {
+                requirements.drawsImages = true;
+            }
+
+            if (object->is<Drawable>())
+            {
+                requirements.shaderFeatures |= blend_mode_shader_features(
+                    object->as<Drawable>()->blendMode());
+            }
+            else if (object->is<ShapePaint>())
+            {
+                auto shapePaint = object->as<ShapePaint>();
+                requirements.shaderFeatures |= blend_mode_shader_features(
+                    static_cast<BlendMode>(shapePaint->blendModeValue()));
+                if (shapePaint->is<Fill>() &&
+                    static_cast<FillRule>(shapePaint->as<Fill>()->fillRule()) ==
+                        FillRule::evenOdd)
+                {
+                    requirements.shaderFeatures |=
+                        ShaderFeatures::ENABLE_EVEN_ODD;
+                }
+            }
+        }
+        if (clipCount != 0)
+        {
+            // RiveRenderer turns axis-aligned rectangular clips into clip
+            // rects.
+            requirements.shaderFeatures |= ShaderFeatures::ENABLE_CLIPPING |
+                                           ShaderFeatures::ENABLE_CLIP_RECT;
+        }
+        if (clipCount > 1)
+        {
+            requirements.shaderFeatures |=
+                ShaderFeatures::ENABLE_NESTED_CLIPPING;
+        }
+    }
+    return requirements;
+}
+} // namespace rive::gpu
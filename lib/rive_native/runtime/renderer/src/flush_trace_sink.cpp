@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/renderer/flush_trace_sink.hpp"
+
+#include <cstdio>
+
+namespace rive::gpu
+{
+void ChromeTraceWriter::traceEvent(const char* name,
+                                   double startSeconds,
+                                   double endSeconds)
+{
+    m_events.push_back({name, false, startSeconds, endSeconds});
+}
+
+void ChromeTraceWriter::traceCounter(const char* name,
+                                     double timeSeconds,
+                                     double value)
+{
+    m_events.push_back({name, true, timeSeconds, value});
+}
+
+std::string ChromeTraceWriter::json() const
+{
+    std::string json = "{\"traceEvents\":[";
+    char buff[256];
+    for (size_t i = 0; i < m_events.size(); ++i)
+    {
+        const Event& event = m_events[i];
+        // Timestamps are in microseconds. Names are string literals from the
+        // renderer, so they don't need escaping.
+        if (event.isCounter)
+        {
+            snprintf(buff,
+                     sizeof(buff),
+                     "%s\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,"
+                     "\"pid\":1,\"tid\":1,\"args\":{\"value\":%.17g}}",
+                     i == 0 ? "" : ",",
+                     event.name,
+                     event.timeSeconds * 1e6,
+                     event.value);
+        }
+        else
+        {
+            snprintf(buff,
+                     sizeof(buff),
+                     "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                     "\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+                     i == 0 ? "" : ",",
+                     event.name,
+                     event.timeSeconds * 1e6,
+                     (event.value - event.timeSeconds) * 1e6);
+        }
+        json += buff;
+    }
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return json;
+}
+} // namespace rive::gpu
@@ -106,9 +106,13 @@ RenderContextGLImpl::RenderContextGLImpl(
         // storage when rendering a complex feather. For now, feather directly
         // to the screen on PowerVR; always go offscreen.
         m_platformFeatures.alwaysFeatherToAtlas = true;
+        // The synchronization workaround in flush() stomps on the first texel
+        // of the gradient texture, which would corrupt a cached color ramp.
+        m_platformFeatures.alwaysRerenderColorRamps = true;
     }
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = true;
+    m_platformFeatures.supportsPersistentAtlas = true;
 
     GLint maxTextureSize;
     glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
@@ -1228,10 +1232,10 @@ void RenderContextGLImpl::flush(const FlushDescriptor& desc)
             reinterpret_cast<const void*>(desc.firstGradSpan *
                                           sizeof(gpu::GradientSpan)));
         glViewport(0, 0, kGradTextureWidth, desc.gradDataHeight);
+        // Don't invalidate the framebuffer. Rows that aren't rendered this
+        // flush hold cached color ramps.
         glBindFramebuffer(GL_FRAMEBUFFER, m_colorRampFBO);
         m_state->bindProgram(m_colorRampProgram);
-        GLenum colorAttachment0 = GL_COLOR_ATTACHMENT0;
-        glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &colorAttachment0);
         glDrawArraysInstanced(GL_TRIANGLE_STRIP,
                               0,
                               gpu::GRAD_SPAN_TRI_STRIP_VERTEX_COUNT,
@@ -1282,7 +1286,12 @@ void RenderContextGLImpl::flush(const FlushDescriptor& desc)
         glBindFramebuffer(GL_FRAMEBUFFER, m_atlasFBO);
         glViewport(0, 0, desc.atlasContentWidth, desc.atlasContentHeight);
         glEnable(GL_SCISSOR_TEST);
-        glScissor(0, 0, desc.atlasContentWidth, desc.atlasContentHeight);
+        // Leave the rows that hold cached masks intact.
+        assert(desc.atlasCacheHeight <= desc.atlasContentHeight);
+        glScissor(0,
+                  desc.atlasCacheHeight,
+                  desc.atlasContentWidth,
+                  desc.atlasContentHeight - desc.atlasCacheHeight);
         glClearColor(0, 0, 0, 0);
         glClear(GL_COLOR_BUFFER_BIT);
         m_state->setCullFace(GL_FRONT); // Inverted because GL is bottom up.
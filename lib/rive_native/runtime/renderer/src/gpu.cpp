@@ -544,10 +544,10 @@ void PaintData::set(DrawContents singleDrawContents,
         case PaintType::radialGradient:
         {
             uint32_t row = simplePaintValue.colorRampLocation.row;
-            if (simplePaintValue.colorRampLocation.isComplex())
+            if (!simplePaintValue.colorRampLocation.isComplex())
             {
-                // Complex gradients rows are offset after the simple gradients.
-                row += gradTextureLayout.complexOffsetY;
+                // Simple gradient rows are offset after the complex gradients.
+                row += gradTextureLayout.simpleOffsetY;
             }
             m_gradTextureY = (static_cast<float>(row) + .5f) *
                              gradTextureLayout.inverseHeight;
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "gradient_ramp_cache.hpp"
+
+#include "gradient.hpp"
+
+namespace rive::gpu
+{
+void GradientRampCache::beginFrame()
+{
+    ++m_currentFrame;
+    while (m_entries.size() > m_capacity)
+    {
+        releaseLeastRecentlyUsed();
+    }
+    shrinkRowCount();
+}
+
+void GradientRampCache::retainOnlyCurrentFrame()
+{
+    // Entries are in MRU order, so everything used this frame is at the front.
+    while (!m_entries.empty() &&
+           m_entries.back().lastUsedFrame != m_currentFrame)
+    {
+        releaseLeastRecentlyUsed();
+    }
+    shrinkRowCount();
+}
+
+bool GradientRampCache::releaseRowsAbove(uint32_t maxRowCount)
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (it->row < maxRowCount)
+        {
+            ++it;
+            continue;
+        }
+        if (it->lastUsedFlush == m_currentFlush)
+        {
+            return false;
+        }
+        m_freeRows.insert(it->row);
+        m_lookup.erase(it->key);
+        it = m_entries.erase(it);
+    }
+    shrinkRowCount();
+    assert(m_rowCount <= maxRowCount);
+    return true;
+}
+
+void GradientRampCache::clear()
+{
+    m_lookup.clear();
+    m_entries.clear();
+    m_freeRows.clear();
+    m_rowCount = 0;
+}
+
+bool GradientRampCache::findOrAllocateRow(const Gradient* gradient,
+                                          uint32_t maxRowCount,
+                                          uint16_t* row,
+                                          bool* needsRender)
+{
+    GradientContentKey key(ref_rcp(gradient));
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        Entry& entry = m_entries.front();
+        entry.lastUsedFrame = m_currentFrame;
+        entry.lastUsedFlush = m_currentFlush;
+        *row = entry.row;
+        *needsRender = false;
+        ++m_hitCount;
+        return true;
+    }
+
+    // Prefer free rows, then growing up to capacity, then recycling the least
+    // recently used row. Only grow past capacity as a last resort.
+    uint16_t newRow;
+    if (!m_freeRows.empty())
+    {
+        newRow = *m_freeRows.begin();
+        m_freeRows.erase(m_freeRows.begin());
+    }
+    else if (m_rowCount < m_capacity && m_rowCount < maxRowCount)
+    {
+        newRow = math::lossless_numeric_cast<uint16_t>(m_rowCount++);
+    }
+    else if (!m_entries.empty() &&
+             m_entries.back().lastUsedFlush != m_currentFlush)
+    {
+        newRow = m_entries.back().row;
+        m_lookup.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+    else if (m_rowCount < maxRowCount)
+    {
+        newRow = math::lossless_numeric_cast<uint16_t>(m_rowCount++);
+    }
+    else
+    {
+        return false;
+    }
+    assert(newRow < m_rowCount);
+
+    m_entries.emplace_front(gradient, newRow);
+    Entry& entry = m_entries.front();
+    entry.lastUsedFrame = m_currentFrame;
+    entry.lastUsedFlush = m_currentFlush;
+    m_lookup.emplace(std::move(key), m_entries.begin());
+    *row = newRow;
+    *needsRender = true;
+    ++m_missCount;
+    return true;
+}
+
+void GradientRampCache::releaseLeastRecentlyUsed()
+{
+    assert(!m_entries.empty());
+    m_freeRows.insert(m_entries.back().row);
+    m_lookup.erase(m_entries.back().key);
+    m_entries.pop_back();
+}
+
+void GradientRampCache::shrinkRowCount()
+{
+    while (!m_freeRows.empty() && *m_freeRows.rbegin() + 1u == m_rowCount)
+    {
+        m_freeRows.erase(std::prev(m_freeRows.end()));
+        --m_rowCount;
+    }
+}
+} // namespace rive::gpu
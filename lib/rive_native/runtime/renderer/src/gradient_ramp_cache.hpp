@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include "rive/renderer/render_context.hpp"
+#include <list>
+#include <set>
+#include <unordered_map>
+
+namespace rive::gpu
+{
+// Keeps complex color ramps alive in the gradient texture across flushes, so a
+// gradient that doesn't change only gets rendered through the color ramp
+// pipeline once.
+//
+// Cached ramps occupy full rows at the top of the gradient texture. Each entry
+// holds a reference on its Gradient, and rows are recycled in LRU order, but
+// never while the current logical flush still references them. The caller is
+// responsible for dropping entries whenever the gradient texture gets
+// reallocated, since that discards its contents.
+class GradientRampCache
+{
+public:
+    explicit GradientRampCache(size_t capacity) : m_capacity(capacity) {}
+
+    // Number of rows kept across frames. A frame may temporarily use more rows
+    // than this (up to the texture limit), but the least recently used ones are
+    // released again by the next beginFrame(). 0 disables caching across
+    // frames.
+    void setCapacity(size_t capacity) { m_capacity = capacity; }
+    size_t capacity() const { return m_capacity; }
+
+    // Releases rows above capacity() and advances the frame counter.
+    void beginFrame();
+
+    // Rows used on or after this logical flush can't be recycled.
+    void beginLogicalFlush() { ++m_currentFlush; }
+
+    // Drops every row that wasn't used during the current frame.
+    void retainOnlyCurrentFrame();
+
+    // Drops rows until rowCount() is no larger than maxRowCount, so other data
+    // can go below them. Returns false if the current logical flush references
+    // one of the rows that would need to go.
+    [[nodiscard]] bool releaseRowsAbove(uint32_t maxRowCount);
+
+    // Drops every row. Ramps that are already scheduled for rendering are
+    // unaffected.
+    void clear();
+
+    // Number of rows at the top of the gradient texture that are reserved for
+    // cached ramps.
+    uint32_t rowCount() const { return m_rowCount; }
+
+    // Finds or assigns the row for a complex gradient. Sets *needsRender if the
+    // row doesn't hold the gradient's ramp yet.
+    //
+    // Returns false if every row is in use by the current logical flush and
+    // the cache can't grow past maxRowCount.
+    [[nodiscard]] bool findOrAllocateRow(const Gradient*,
+                                         uint32_t maxRowCount,
+                                         uint16_t* row,
+                                         bool* needsRender);
+
+    size_t hitCount() const { return m_hitCount; }
+    size_t missCount() const { return m_missCount; }
+    size_t entryCount() const { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        Entry(const Gradient* gradient, uint16_t row_) :
+            key(ref_rcp(gradient)), row(row_)
+        {}
+
+        GradientContentKey key;
+        uint16_t row;
+        uint64_t lastUsedFrame = 0;
+        uint64_t lastUsedFlush = 0;
+    };
+
+    void releaseLeastRecentlyUsed();
+
+    // Lowers m_rowCount past any free rows at the end of the cached region.
+    void shrinkRowCount();
+
+    size_t m_capacity;
+    uint64_t m_currentFrame = 0;
+    uint64_t m_currentFlush = 0;
+    size_t m_hitCount = 0;
+    size_t m_missCount = 0;
+
+    uint32_t m_rowCount = 0;
+    std::set<uint16_t> m_freeRows; // Lowest rows get reused first.
+
+    // Most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<GradientContentKey,
+                       std::list<Entry>::iterator,
+                       DeepHashGradient>
+        m_lookup;
+};
+} // namespace rive::gpu
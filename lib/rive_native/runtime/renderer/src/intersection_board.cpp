@@ -11,11 +11,68 @@
 // MSVC doesn't get codegen for the inner loop. Provide direct SSE intrinsics.
 #include <emmintrin.h>
 #define FALLBACK_ON_SSE2_INTRINSICS
-#else
+#if defined(__AVX2__)
+// Test two chunks at a time when building for AVX2 (/arch:AVX2).
+#include <immintrin.h>
+#define FALLBACK_ON_AVX2_INTRINSICS
+#endif
+#elif SIMD_NATIVE_GVEC
+// Test two chunks at a time with native vectors, which the compiler splits
+// into as many registers as the target needs.
+#define TWO_CHUNK_GVEC
 #endif
 
 namespace rive::gpu
 {
+#if !defined(FALLBACK_ON_SSE2_INTRINSICS)
+// Returns 0xff in each byte whose rectangle in "edges" intersects the
+// rectangle encoded in "complement", otherwise 0.
+static uint64_t intersection_masks(int8x32 edges, int8x32 complement)
+{
+    // Test 32 edges!
+    auto edgeMasks = edges < complement;
+    // Since the transposed L,T,R,B rows are a each 64-bit vectors,
+    // "and-reducing" them returns the intersection test (l0 < r1 && t0 < b1 &&
+    // r0 > l1 && b0 > t1) in each byte.
+    return simd::reduce_and(math::bit_cast<uint64x4>(edgeMasks));
+}
+
+#ifdef TWO_CHUNK_GVEC
+// Tests two adjacent chunks at once. Returns the masks of the first chunk in
+// element 0 and the masks of the second in element 1.
+static uint64x2 intersection_masks(int8x64 edges, int8x64 complement)
+{
+    // Test 64 edges!
+    auto edgeMasks = edges < complement;
+    // The L,T,R,B rows of the first chunk, then of the second.
+    auto rows = math::bit_cast<simd::gvec<uint64_t, 8>>(edgeMasks);
+    return uint64x2{rows[0] & rows[1] & rows[2] & rows[3],
+                    rows[4] & rows[5] & rows[6] & rows[7]};
+}
+#endif
+#else
+static uint64_t intersection_masks(const int8x32& edges,
+                                   __m128i complementLO,
+                                   __m128i complementHI)
+{
+    const __m128i* edgeData = reinterpret_cast<const __m128i*>(&edges);
+    // Test 32 edges!
+    __m128i edgeMasksLO =
+        _mm_cmpgt_epi8(complementLO, _mm_loadu_si128(edgeData));
+    __m128i edgeMasksHI =
+        _mm_cmpgt_epi8(complementHI, _mm_loadu_si128(edgeData + 1));
+    // AND L & R masks (bits 0:63) and T & B masks (bits 63:127).
+    __m128i partialIsectMasks = _mm_and_si128(edgeMasksLO, edgeMasksHI);
+    // AND LR masks with TB masks for a full LTRB intersection mask.
+    __m128i isectMasks =
+        _mm_and_si128(partialIsectMasks,
+                      _mm_unpackhi_epi64(partialIsectMasks, partialIsectMasks));
+    uint64_t isectMasks8;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&isectMasks8), isectMasks);
+    return isectMasks8;
+}
+#endif
+
 void IntersectionTile::reset(int left, int top, int16_t baselineGroupIndex)
 {
     // Since we mask non-intersecting groupIndices to zero, the "mask and max"
@@ -27,6 +84,7 @@ void IntersectionTile::reset(int left, int top, int16_t baselineGroupIndex)
     m_maxGroupIndex = baselineGroupIndex;
     m_edges.clear();
     m_groupIndices.clear();
+    m_chunkBounds.clear();
     m_rectangleCount = 0;
 }
 
@@ -67,6 +125,15 @@ void IntersectionTile::addRectangle(int4 ltrb, int16_t groupIndex)
         // intersection test.
         assert(m_groupIndices.size() * kChunkSize == m_rectangleCount);
         m_groupIndices.emplace_back();
+
+        // Every 8 chunks share an entry in m_chunkBounds. Initialize them to
+        // maximally negative rectangles as well, and grow them as rectangles
+        // are added.
+        if (m_groupIndices.size() % kChunkSize == 1)
+        {
+            m_chunkBounds.push_back(
+                int8x32(std::numeric_limits<int8_t>::max()));
+        }
     }
 
     // m_edges is a list of 8 rectangles encoded as [L, T, 255 - R, 255 - B],
@@ -83,6 +150,16 @@ void IntersectionTile::addRectangle(int4 ltrb, int16_t groupIndex)
 
     m_groupIndices.back()[subIdx] = groupIndex;
 
+    // Grow the bounding box of this rectangle's chunk.
+    uint32_t chunkSubIdx =
+        static_cast<uint32_t>((m_groupIndices.size() - 1) % kChunkSize);
+    int8x32& bounds = m_chunkBounds.back();
+    for (int i = 0; i < 4; ++i)
+    {
+        bounds[chunkSubIdx + i * 8] =
+            std::min<int8_t>(bounds[chunkSubIdx + i * 8], biased[i]);
+    }
+
     m_maxGroupIndex = std::max(groupIndex, m_maxGroupIndex);
     ++m_rectangleCount;
 }
@@ -136,34 +213,70 @@ int16x8 IntersectionTile::findMaxIntersectingGroupIndex(
     int8x8 _l = biased.x; // Already converted to "255 - left" above.
     int8x8 _t = biased.y; // Already converted to "255 - top" above.
 
-#if !defined(FALLBACK_ON_SSE2_INTRINSICS)
-    auto edges = m_edges.begin();
-    auto groupIndices = m_groupIndices.begin();
+    // m_chunkBounds holds the bounding boxes of 8 chunks at a time. Test those
+    // first, and when the rectangle doesn't intersect any of them, skip all 64
+    // rectangles with a single test. (Skipping individual chunks instead costs
+    // more in branch mispredictions than it saves.)
     assert(m_edges.size() == m_groupIndices.size());
+    assert(m_chunkBounds.size() == (m_groupIndices.size() + 7) / kChunkSize);
+    size_t chunkCount = m_groupIndices.size();
+#if !defined(FALLBACK_ON_SSE2_INTRINSICS)
     int8x32 complement = simd::join(r, b, _l, _t);
-    for (; edges != m_edges.end(); ++edges, ++groupIndices)
+#ifdef TWO_CHUNK_GVEC
+    int8x64 complement64 = simd::join(complement, complement);
+    int16x16 runningMaxGroupIndices16 = 0;
+#endif
+    for (size_t i = 0; i < chunkCount; i += kChunkSize)
     {
-        // Test 32 edges!
-        auto edgeMasks = *edges < complement;
-        // Since the transposed L,T,R,B rows are a each 64-bit vectors,
-        // "and-reducing" them returns the intersection test (l0 < r1 && t0 < b1
-        // && r0 > l1 && b0 > t1) in each byte.
-        int64_t isectMask =
-            simd::reduce_and(math::bit_cast<int64x4>(edgeMasks));
-        // Each element of isectMasks8 is 0xff if we intersect with the
-        // corresponding rectangle, otherwise 0.
-        int8x8 isectMasks8 = math::bit_cast<int8x8>(isectMask);
-        // Widen isectMasks8 to 16 bits per mask, where each element of
-        // isectMasks16 is 0xffff if we intersect with the rectangle, otherwise
-        // 0.
-        int16x8 isectMasks16 =
-            math::bit_cast<int16x8>(simd::zip(isectMasks8, isectMasks8));
-        // Mask out any groupIndices we don't intersect with so they don't
-        // participate in the test for maximum groupIndex.
-        int16x8 maskedGroupIndices = isectMasks16 & *groupIndices;
-        runningMaxGroupIndices =
-            simd::max(maskedGroupIndices, runningMaxGroupIndices);
+        if (intersection_masks(m_chunkBounds[i / kChunkSize], complement) ==
+            0)
+        {
+            continue;
+        }
+        size_t end = std::min(i + kChunkSize, chunkCount);
+        size_t j = i;
+#ifdef TWO_CHUNK_GVEC
+        // Test 16 rectangles at a time.
+        for (; j + 1 < end; j += 2)
+        {
+            int8x16 isectMasks8 = math::bit_cast<int8x16>(
+                intersection_masks(simd::load<int8_t, 64>(&m_edges[j]),
+                                   complement64));
+            // Sign extend 0xff masks to 0xffff.
+            int16x16 isectMasks16 = simd::cast<int16_t>(isectMasks8);
+            int16x16 maskedGroupIndices =
+                isectMasks16 & simd::load<int16_t, 16>(&m_groupIndices[j]);
+            runningMaxGroupIndices16 =
+                simd::max(maskedGroupIndices, runningMaxGroupIndices16);
+        }
+#endif
+        for (; j < end; ++j)
+        {
+            // Each element of isectMasks8 is 0xff if we intersect with the
+            // corresponding rectangle, otherwise 0.
+            int8x8 isectMasks8 = math::bit_cast<int8x8>(
+                intersection_masks(m_edges[j], complement));
+            // Widen isectMasks8 to 16 bits per mask, where each element of
+            // isectMasks16 is 0xffff if we intersect with the rectangle,
+            // otherwise 0.
+            int16x8 isectMasks16 =
+                math::bit_cast<int16x8>(simd::zip(isectMasks8, isectMasks8));
+            // Mask out any groupIndices we don't intersect with so they don't
+            // participate in the test for maximum groupIndex.
+            int16x8 maskedGroupIndices = isectMasks16 & m_groupIndices[j];
+            runningMaxGroupIndices =
+                simd::max(maskedGroupIndices, runningMaxGroupIndices);
+        }
     }
+#ifdef TWO_CHUNK_GVEC
+    // Fold the maximums from the chunk pairs into the running ones.
+    const int16_t* pairMaxGroupIndices =
+        reinterpret_cast<const int16_t*>(&runningMaxGroupIndices16);
+    runningMaxGroupIndices =
+        simd::max(runningMaxGroupIndices,
+                  simd::max(simd::load<int16_t, 8>(pairMaxGroupIndices),
+                            simd::load<int16_t, 8>(pairMaxGroupIndices + 8)));
+#endif
 #else
     // MSVC doesn't get good codegen for the above loop. Provide direct SSE
     // intrinsics.
@@ -174,30 +287,95 @@ int16x8 IntersectionTile::findMaxIntersectingGroupIndex(
     __m128i complementHI = math::bit_cast<__m128i>(simd::join(_l, _t));
     __m128i localMaxGroupIndices =
         math::bit_cast<__m128i>(runningMaxGroupIndices);
-    for (size_t i = 0; i < m_groupIndices.size(); ++i)
+#ifdef FALLBACK_ON_AVX2_INTRINSICS
+    __m256i complement256 =
+        _mm256_inserti128_si256(_mm256_castsi128_si256(complementLO),
+                                complementHI,
+                                1);
+    __m256i localMaxGroupIndices256 = _mm256_setzero_si256();
+#endif
+    for (size_t i = 0; i < chunkCount; i += kChunkSize)
     {
-        __m128i edgesLO = edgeData[i * 2];
-        __m128i edgesHI = edgeData[i * 2 + 1];
-        // Test 32 edges!
-        __m128i edgeMasksLO = _mm_cmpgt_epi8(complementLO, edgesLO);
-        __m128i edgeMasksHI = _mm_cmpgt_epi8(complementHI, edgesHI);
-        // AND L & R masks (bits 0:63) and T & B masks (bits 63:127).
-        __m128i partialIsectMasks = _mm_and_si128(edgeMasksLO, edgeMasksHI);
-        // Widen partial edge masks from 8 bits to 16.
-        __m128i partialIsectMasksTB16 =
-            _mm_unpackhi_epi8(partialIsectMasks, partialIsectMasks);
-        __m128i partialIsectMasksLR16 =
-            _mm_unpacklo_epi8(partialIsectMasks, partialIsectMasks);
-        // AND LR masks with TB masks for a full LTRB intersection mask.
-        __m128i isectMasks16 =
-            _mm_and_si128(partialIsectMasksLR16, partialIsectMasksTB16);
-        // Mask out the groupIndices that don't intersect.
-        __m128i intersectingGroupIndices =
-            _mm_and_si128(isectMasks16, groupIndices[i]);
-        // Accumulate max intersecting groupIndices.
-        localMaxGroupIndices =
-            _mm_max_epi16(intersectingGroupIndices, localMaxGroupIndices);
+        if (intersection_masks(m_chunkBounds[i / kChunkSize],
+                               complementLO,
+                               complementHI) == 0)
+        {
+            continue;
+        }
+        size_t end = std::min(i + kChunkSize, chunkCount);
+        size_t j = i;
+#ifdef FALLBACK_ON_AVX2_INTRINSICS
+        // Test 16 rectangles at a time.
+        for (; j + 1 < end; j += 2)
+        {
+            __m256i edges0 = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(edgeData + j * 2));
+            __m256i edges1 = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(edgeData + j * 2 + 2));
+            // Test 64 edges!
+            __m256i edgeMasks0 = _mm256_cmpgt_epi8(complement256, edges0);
+            __m256i edgeMasks1 = _mm256_cmpgt_epi8(complement256, edges1);
+            // Gather the [L, T] masks from both chunks into one register and
+            // the [-R, -B] masks into another.
+            __m256i edgeMasksLT =
+                _mm256_permute2x128_si256(edgeMasks0, edgeMasks1, 0x20);
+            __m256i edgeMasksRB =
+                _mm256_permute2x128_si256(edgeMasks0, edgeMasks1, 0x31);
+            // AND L & R masks and T & B masks, for each chunk in its own
+            // 128-bit lane.
+            __m256i partialIsectMasks =
+                _mm256_and_si256(edgeMasksLT, edgeMasksRB);
+            // Widen partial edge masks from 8 bits to 16.
+            __m256i partialIsectMasksTB16 =
+                _mm256_unpackhi_epi8(partialIsectMasks, partialIsectMasks);
+            __m256i partialIsectMasksLR16 =
+                _mm256_unpacklo_epi8(partialIsectMasks, partialIsectMasks);
+            // AND LR masks with TB masks for a full LTRB intersection mask.
+            __m256i isectMasks16 =
+                _mm256_and_si256(partialIsectMasksLR16, partialIsectMasksTB16);
+            // Mask out the groupIndices that don't intersect.
+            __m256i intersectingGroupIndices = _mm256_and_si256(
+                isectMasks16,
+                _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(groupIndices + j)));
+            // Accumulate max intersecting groupIndices.
+            localMaxGroupIndices256 =
+                _mm256_max_epi16(intersectingGroupIndices,
+                                 localMaxGroupIndices256);
+        }
+#endif
+        for (; j < end; ++j)
+        {
+            __m128i edgesLO = _mm_loadu_si128(edgeData + j * 2);
+            __m128i edgesHI = _mm_loadu_si128(edgeData + j * 2 + 1);
+            // Test 32 edges!
+            __m128i edgeMasksLO = _mm_cmpgt_epi8(complementLO, edgesLO);
+            __m128i edgeMasksHI = _mm_cmpgt_epi8(complementHI, edgesHI);
+            // AND L & R masks (bits 0:63) and T & B masks (bits 63:127).
+            __m128i partialIsectMasks = _mm_and_si128(edgeMasksLO, edgeMasksHI);
+            // Widen partial edge masks from 8 bits to 16.
+            __m128i partialIsectMasksTB16 =
+                _mm_unpackhi_epi8(partialIsectMasks, partialIsectMasks);
+            __m128i partialIsectMasksLR16 =
+                _mm_unpacklo_epi8(partialIsectMasks, partialIsectMasks);
+            // AND LR masks with TB masks for a full LTRB intersection mask.
+            __m128i isectMasks16 =
+                _mm_and_si128(partialIsectMasksLR16, partialIsectMasksTB16);
+            // Mask out the groupIndices that don't intersect.
+            __m128i intersectingGroupIndices =
+                _mm_and_si128(isectMasks16, _mm_loadu_si128(groupIndices + j));
+            // Accumulate max intersecting groupIndices.
+            localMaxGroupIndices =
+                _mm_max_epi16(intersectingGroupIndices, localMaxGroupIndices);
+        }
     }
+#ifdef FALLBACK_ON_AVX2_INTRINSICS
+    // Fold the 256-bit maximums into the 128-bit ones.
+    localMaxGroupIndices = _mm_max_epi16(
+        localMaxGroupIndices,
+        _mm_max_epi16(_mm256_castsi256_si128(localMaxGroupIndices256),
+                      _mm256_extracti128_si256(localMaxGroupIndices256, 1)));
+#endif
     runningMaxGroupIndices = math::bit_cast<int16x8>(localMaxGroupIndices);
 #endif // !FALLBACK_ON_SSE2_INTRINSICS
 
@@ -47,6 +47,14 @@ private:
     // Chunk of 8 groupIndices corresponding to the above edges.
     std::vector<int16x8> m_groupIndices;
     static_assert(sizeof(m_groupIndices[0]) == kChunkSize * 2);
+
+    // Bounding boxes of 8 chunks at a time, encoded and transposed the same
+    // way as m_edges, so we can test 8 chunks with a single chunk test and
+    // skip the ones that can't intersect. (Since the right and bottom edges
+    // are stored as "255 - R" and "255 - B", the bounding box of a chunk is
+    // the min of each row.)
+    std::vector<int8x32> m_chunkBounds;
+    static_assert(sizeof(m_chunkBounds[0]) == kChunkSize * 4);
 };
 
 // Manages a set of rectangles and their groupIndex across a variable-sized
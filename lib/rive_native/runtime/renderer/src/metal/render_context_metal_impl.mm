@@ -1113,7 +1113,8 @@ void RenderContextMetalImpl::flush(const FlushDescriptor& desc)
             [MTLRenderPassDescriptor renderPassDescriptor];
         gradPass.renderTargetWidth = kGradTextureWidth;
         gradPass.renderTargetHeight = desc.gradDataHeight;
-        gradPass.colorAttachments[0].loadAction = MTLLoadActionDontCare;
+        // Rows that aren't rendered this flush hold cached color ramps.
+        gradPass.colorAttachments[0].loadAction = MTLLoadActionLoad;
         gradPass.colorAttachments[0].storeAction = MTLStoreActionStore;
         gradPass.colorAttachments[0].texture = m_gradientTexture;
 
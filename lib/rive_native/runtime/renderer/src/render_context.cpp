@@ -4,16 +4,22 @@
 
 #include "rive/renderer/render_context.hpp"
 
+#include "atlas_cache.hpp"
 #include "gr_inner_fan_triangulator.hpp"
 #include "intersection_board.hpp"
+#include "triangulation_cache.hpp"
 #include "gradient.hpp"
+#include "gradient_ramp_cache.hpp"
 #include "rive_render_paint.hpp"
 #include "rive/renderer/draw.hpp"
+#include "rive/renderer/flush_task_scheduler.hpp"
+#include "rive/renderer/flush_trace_sink.hpp"
 #include "rive/renderer/rive_render_image.hpp"
 #include "rive/renderer/render_context_impl.hpp"
 #include "shaders/constants.glsl"
 
 #include <string_view>
+#include <unordered_set>
 
 #ifdef RIVE_DECODERS
 #include "rive/decoders/bitmap_decoder.hpp"
@@ -63,11 +69,11 @@ constexpr static size_t gradient_data_height(size_t simpleRampCount,
            complexRampCount;
 }
 
-inline GradientContentKey::GradientContentKey(rcp<const Gradient> gradient) :
+GradientContentKey::GradientContentKey(rcp<const Gradient> gradient) :
     m_gradient(std::move(gradient))
 {}
 
-inline GradientContentKey::GradientContentKey(GradientContentKey&& other) :
+GradientContentKey::GradientContentKey(GradientContentKey&& other) :
     m_gradient(std::move(other.m_gradient))
 {}
 
@@ -107,7 +113,12 @@ RenderContext::RenderContext(std::unique_ptr<RenderContextImpl> impl) :
     // -1 from m_maxPathID so we reserve a path record for the clearColor paint
     // (for atomic mode). This also allows us to index the storage buffers
     // directly by pathID.
-    m_maxPathID(MaxPathID(m_impl->platformFeatures().pathIDGranularity) - 1)
+    m_maxPathID(MaxPathID(m_impl->platformFeatures().pathIDGranularity) - 1),
+    m_triangulationCache(std::make_unique<TriangulationCache>(
+        kDefaultTriangulationCacheCapacity)),
+    m_gradientRampCache(std::make_unique<GradientRampCache>(
+        kDefaultGradientRampCacheCapacity)),
+    m_atlasCache(std::make_unique<AtlasCache>(kDefaultAtlasCacheCapacity))
 {
     setResourceSizes(ResourceAllocationCounts(), /*forceRealloc =*/true);
     releaseResources();
@@ -120,6 +131,8 @@ RenderContext::~RenderContext()
     // Delete the logical flushes before the block allocators let go of their
     // allocations.
     m_logicalFlushes.clear();
+    // The glyph atlas belongs to the Factory base, which outlives m_impl.
+    releaseGlyphAtlasImages();
 }
 
 const gpu::PlatformFeatures& RenderContext::platformFeatures() const
@@ -162,6 +175,16 @@ rcp<RenderImage> RenderContext::decodeImage(Span<const uint8_t> encodedBytes)
                               : nullptr;
 }
 
+rcp<RenderImage> RenderContext::makeImage(uint32_t width,
+                                          uint32_t height,
+                                          const uint8_t premulRGBA[])
+{
+    rcp<Texture> texture =
+        m_impl->makeImageTexture(width, height, 1, premulRGBA);
+    return texture != nullptr ? make_rcp<RiveRenderImage>(std::move(texture))
+                              : nullptr;
+}
+
 void RenderContext::releaseResources()
 {
     assert(!m_didBeginFrame);
@@ -169,6 +192,55 @@ void RenderContext::releaseResources()
     setResourceSizes(ResourceAllocationCounts());
     m_maxRecentResourceRequirements = ResourceAllocationCounts();
     m_lastResourceTrimTimeInSeconds = m_impl->secondsNow();
+    m_triangulationCache->clear();
+    m_gradientRampCache->clear();
+    m_atlasCache->clear();
+    releaseGlyphAtlasImages();
+}
+
+RenderContext::TriangulationCacheStats RenderContext::triangulationCacheStats()
+    const
+{
+    TriangulationCacheStats stats;
+    stats.hitCount = m_triangulationCache->hitCount();
+    stats.missCount = m_triangulationCache->missCount();
+    stats.entryCount = m_triangulationCache->entryCount();
+    return stats;
+}
+
+void RenderContext::setTriangulationCacheCapacity(size_t capacity)
+{
+    m_triangulationCache->setCapacity(capacity);
+}
+
+RenderContext::GradientRampCacheStats RenderContext::gradientRampCacheStats()
+    const
+{
+    GradientRampCacheStats stats;
+    stats.hitCount = m_gradientRampCache->hitCount();
+    stats.missCount = m_gradientRampCache->missCount();
+    stats.rowCount = m_gradientRampCache->rowCount();
+    stats.gradSpanCount = m_lastFlushStats.gradSpanCount;
+    return stats;
+}
+
+void RenderContext::setGradientRampCacheCapacity(size_t capacity)
+{
+    m_gradientRampCache->setCapacity(capacity);
+}
+
+RenderContext::AtlasCacheStats RenderContext::atlasCacheStats() const
+{
+    AtlasCacheStats stats;
+    stats.hitCount = m_atlasCache->hitCount();
+    stats.missCount = m_atlasCache->missCount();
+    stats.entryCount = m_atlasCache->entryCount();
+    return stats;
+}
+
+void RenderContext::setAtlasCacheCapacity(uint32_t rowCount)
+{
+    m_atlasCache->setCapacity(rowCount);
 }
 
 void RenderContext::resetContainers()
@@ -202,7 +274,14 @@ void RenderContext::LogicalFlush::rewind()
     m_pendingSimpleGradDraws.clear();
     m_complexGradients.clear();
     m_pendingComplexGradDraws.clear();
+    m_complexGradRowCount = 0;
     m_pendingGradSpanCount = 0;
+    if (m_ctx->platformFeatures().alwaysRerenderColorRamps)
+    {
+        m_ctx->m_gradientRampCache->clear();
+    }
+    m_ctx->m_gradientRampCache->beginLogicalFlush();
+    m_ctx->m_atlasCache->beginLogicalFlush();
     m_clips.clear();
     m_draws.clear();
     m_combinedDrawBounds = {std::numeric_limits<int32_t>::max(),
@@ -223,11 +302,14 @@ void RenderContext::LogicalFlush::rewind()
     m_flushDesc = FlushDescriptor();
 
     m_drawList.reset();
+    m_reorderedBatchSavings = 0;
     m_combinedShaderFeatures = gpu::ShaderFeatures::NONE;
 
     m_currentPathID = 0;
     m_currentContourID = 0;
 
+    m_deferredTessellations.clear();
+
     if (m_atlasRectanizer != nullptr)
     {
         m_atlasRectanizer->reset();
@@ -235,9 +317,17 @@ void RenderContext::LogicalFlush::rewind()
     m_atlasMaxX = 0;
     m_atlasMaxY = 0;
     m_pendingAtlasDraws.clear();
+    m_cachedAtlasDraws.clear();
+    m_cachedAtlasResourceCounts = Draw::ResourceCounters();
+    m_usesAtlasCache = false;
+    m_atlasCacheGeneration = 0;
+    m_atlasCacheBlocked = false;
+    m_atlasCacheDiscarded = false;
 
     m_coverageBufferLength = 0;
 
+    m_drawCounts.fill(0);
+
     m_currentZIndex = 0;
 
     RIVE_DEBUG_CODE(m_hasDoneLayout = false;)
@@ -267,6 +357,15 @@ void RenderContext::LogicalFlush::resetContainers()
 
     m_pendingAtlasDraws.clear();
     m_pendingAtlasDraws.shrink_to_fit();
+    m_cachedAtlasDraws.clear();
+    m_cachedAtlasDraws.shrink_to_fit();
+    m_atlasCacheInsertions.clear();
+    m_atlasCacheInsertions.shrink_to_fit();
+
+    m_deferredTessellations.clear();
+    m_deferredTessellations.shrink_to_fit();
+    m_deferredTessSpanScratch.clear();
+    m_deferredTessSpanScratch.shrink_to_fit();
     // Don't reserve any space in m_pendingAtlasDraws since there are many
     // usecases where it isn't used at all.
 }
@@ -310,6 +409,17 @@ void RenderContext::beginFrame(const FrameDescriptor& frameDescriptor)
     }
     m_frameShaderFeaturesMask =
         gpu::ShaderFeaturesMaskFor(m_frameInterlockMode);
+    m_triangulationCache->beginFrame();
+    m_gradientRampCache->beginFrame();
+    // Leave at least half of the atlas for masks that aren't cached.
+    uint32_t atlasCacheHeight =
+        platformFeatures().supportsPersistentAtlas
+            ? std::min(m_atlasCache->capacity(), atlasMaxSize() / 2)
+            : 0;
+    m_atlasCache->beginFrame(
+        math::lossless_numeric_cast<uint16_t>(
+            atlasCacheHeight != 0 ? atlasMaxSize() / 2 : 0),
+        math::lossless_numeric_cast<uint16_t>(atlasCacheHeight));
     if (m_logicalFlushes.empty())
     {
         m_logicalFlushes.emplace_back(new LogicalFlush(this));
@@ -377,6 +487,18 @@ void RenderContext::LogicalFlush::addClipReadBounds(uint32_t clipID,
     clipInfo.readBounds = clipInfo.readBounds.join(bounds);
 }
 
+// Resources an atlas draw doesn't need when its mask is already cached.
+static Draw::ResourceCounters cached_atlas_draw_counts(const PathDraw* draw)
+{
+    Draw::ResourceCounters counts;
+    counts.midpointFanTessVertexCount =
+        draw->resourceCounts().midpointFanTessVertexCount;
+    counts.outerCubicTessVertexCount =
+        draw->resourceCounts().outerCubicTessVertexCount;
+    counts.contourCount = draw->resourceCounts().contourCount;
+    return counts;
+}
+
 bool RenderContext::pushDraws(DrawUniquePtr draws[], size_t drawCount)
 {
     assert(m_didBeginFrame);
@@ -389,7 +511,10 @@ bool RenderContext::LogicalFlush::pushDraws(DrawUniquePtr draws[],
 {
     assert(!m_hasDoneLayout);
 
-    auto countsVector = m_resourceCounts.toVec();
+    // Check limits against the counts without any atlas cache hits, so
+    // discardCachedAtlasDraws() can always add them back.
+    auto countsVector =
+        m_resourceCounts.toVec() + m_cachedAtlasResourceCounts.toVec();
     for (size_t i = 0; i < drawCount; ++i)
     {
         assert(!draws[i]->pixelBounds().empty());
@@ -431,6 +556,9 @@ bool RenderContext::LogicalFlush::pushDraws(DrawUniquePtr draws[],
     }
 
     // Allocate final resources.
+    size_t pendingAtlasDrawCount = m_pendingAtlasDraws.size();
+    size_t cachedAtlasDrawCount = m_cachedAtlasDraws.size();
+    m_atlasCacheInsertions.clear();
     for (size_t i = 0; i < drawCount; ++i)
     {
         if (!draws[i]->allocateResources(this))
@@ -438,14 +566,26 @@ bool RenderContext::LogicalFlush::pushDraws(DrawUniquePtr draws[],
             // The draw failed to allocate resources. Give up and let the caller
             // flush and try again.
             //
-            // FIXME: This works today, but the surrounding code could be
-            // modified to inadvertently leave a stale dangling reference to one
-            // of these draws in m_pendingAtlasDraws. This needs to be
-            // revisited.
+            // Don't leave stale references to this batch in the atlas lists,
+            // and forget any masks it reserved in the atlas cache, since they
+            // won't get rendered.
+            m_pendingAtlasDraws.resize(pendingAtlasDrawCount);
+            m_cachedAtlasDraws.resize(cachedAtlasDrawCount);
+            for (const AtlasCacheKey& key : m_atlasCacheInsertions)
+            {
+                m_ctx->m_atlasCache->erase(key);
+            }
             return false;
         }
     }
 
+    for (size_t i = cachedAtlasDrawCount; i < m_cachedAtlasDraws.size(); ++i)
+    {
+        m_cachedAtlasResourceCounts =
+            m_cachedAtlasResourceCounts.toVec() +
+            cached_atlas_draw_counts(m_cachedAtlasDraws[i]).toVec();
+    }
+
     for (size_t i = 0; i < drawCount; ++i)
     {
         m_draws.push_back(std::move(draws[i]));
@@ -453,7 +593,8 @@ bool RenderContext::LogicalFlush::pushDraws(DrawUniquePtr draws[],
             m_combinedDrawBounds.join(m_draws.back()->pixelBounds());
     }
 
-    m_resourceCounts = countsWithNewBatch;
+    m_resourceCounts =
+        countsWithNewBatch.toVec() - m_cachedAtlasResourceCounts.toVec();
     m_drawPassCount += passCountInBatch;
     return true;
 }
@@ -468,6 +609,11 @@ bool RenderContext::LogicalFlush::allocateGradient(
     size_t stopCount = gradient->count();
     assert(stopCount > 0); // RiveRenderFactory guarantees this.
 
+    // Simple ramps go below every row the gradient ramp cache has reserved so
+    // far, so they never overwrite a cached ramp.
+    GradientRampCache* rampCache = m_ctx->m_gradientRampCache.get();
+    m_complexGradRowCount = rampCache->rowCount();
+
     if (stopCount == 1 || (stopCount == 2 && stops[0] == 0 && stops[1] == 1))
     {
         // This is a simple gradient that can be implemented by a two-texel
@@ -488,13 +634,22 @@ bool RenderContext::LogicalFlush::allocateGradient(
         }
         else
         {
-            if (gradient_data_height(m_simpleGradients.size() + 1,
-                                     m_complexGradients.size()) >
+            size_t simpleGradDataHeight =
+                gradient_data_height(m_simpleGradients.size() + 1, 0);
+            if (simpleGradDataHeight + m_complexGradRowCount >
                 kMaxTextureHeight)
             {
-                // We ran out of rows in the gradient texture. Caller has to
-                // flush and try again.
-                return false;
+                // Make room by releasing cached ramps from the bottom of the
+                // complex region. If this flush still references them, we ran
+                // out of rows in the gradient texture. Caller has to flush and
+                // try again.
+                if (!rampCache->releaseRowsAbove(
+                        math::lossless_numeric_cast<uint32_t>(
+                            kMaxTextureHeight - simpleGradDataHeight)))
+                {
+                    return false;
+                }
+                m_complexGradRowCount = rampCache->rowCount();
             }
             rampTexelsIdx = math::lossless_numeric_cast<uint32_t>(
                 m_simpleGradients.size() * 2);
@@ -520,25 +675,32 @@ bool RenderContext::LogicalFlush::allocateGradient(
         }
         else
         {
-            if (gradient_data_height(m_simpleGradients.size(),
-                                     m_complexGradients.size() + 1) >
-                kMaxTextureHeight)
+            uint32_t simpleGradDataHeight =
+                math::lossless_numeric_cast<uint32_t>(
+                    gradient_data_height(m_simpleGradients.size(), 0));
+            bool needsRender;
+            if (!rampCache->findOrAllocateRow(
+                    gradient,
+                    kMaxTextureHeight - simpleGradDataHeight,
+                    &row,
+                    &needsRender))
             {
                 // We ran out of rows in the gradient texture. Caller has to
                 // flush and try again.
                 return false;
             }
+            m_complexGradRowCount = rampCache->rowCount();
 
-            row = static_cast<uint32_t>(m_complexGradients.size());
             m_complexGradients.emplace(std::move(key), row);
-            m_pendingComplexGradDraws.push_back(gradient);
-
-            size_t spanCount = stopCount - 1;
-            m_pendingGradSpanCount += spanCount;
+            if (needsRender)
+            {
+                m_pendingComplexGradDraws.push_back({gradient, row});
+                size_t spanCount = stopCount - 1;
+                m_pendingGradSpanCount += spanCount;
+            }
         }
-        // Store the row relative to the first complex gradient for now.
-        // PaintData::set() will offset this value by the number of simple
-        // gradient rows once its final value is known.
+        // Complex rows are absolute. It's the simple gradients that
+        // PaintData::set() offsets, once the number of complex rows is known.
         colorRampLocation->row = row;
         colorRampLocation->col = ColorRampLocation::kComplexGradientMarker;
     }
@@ -547,6 +709,7 @@ bool RenderContext::LogicalFlush::allocateGradient(
 
 bool RenderContext::LogicalFlush::allocateAtlasDraw(
     PathDraw* pathDraw,
+    const AtlasCacheKey* cacheKey,
     uint16_t drawWidth,
     uint16_t drawHeight,
     uint16_t desiredPadding,
@@ -554,28 +717,85 @@ bool RenderContext::LogicalFlush::allocateAtlasDraw(
     uint16_t* y,
     TAABB<uint16_t>* paddedRegion)
 {
-    if (m_atlasRectanizer == nullptr)
+    AtlasCache* atlasCache = m_ctx->m_atlasCache.get();
+    const bool atlasCacheAvailable =
+        atlasCache->enabled() && !m_atlasCacheBlocked;
+    if (cacheKey != nullptr && atlasCacheAvailable)
+    {
+        bool needsRender;
+        if (const AtlasCache::Entry* entry =
+                atlasCache->findOrInsert(*cacheKey,
+                                         drawWidth,
+                                         drawHeight,
+                                         desiredPadding,
+                                         &needsRender))
+        {
+            if (!m_usesAtlasCache)
+            {
+                m_usesAtlasCache = true;
+                m_atlasCacheGeneration = atlasCache->generation();
+            }
+            assert(m_atlasCacheGeneration == atlasCache->generation());
+            *x = entry->x;
+            *y = entry->y;
+            *paddedRegion = entry->paddedRegion;
+            // Keep the whole band inside the atlas texture and this flush's
+            // content area, so clearing it covers every cached mask.
+            m_atlasMaxX = std::max<uint32_t>(m_atlasMaxX, atlasCache->width());
+            m_atlasMaxY = std::max<uint32_t>(m_atlasMaxY, atlasCache->height());
+            if (needsRender)
+            {
+                m_pendingAtlasDraws.push_back(pathDraw);
+                m_atlasCacheInsertions.push_back(*cacheKey);
+            }
+            else
+            {
+                m_cachedAtlasDraws.push_back(pathDraw);
+            }
+            return true;
+        }
+    }
+
+    uint16_t atlasMaxSize = m_ctx->atlasMaxSize();
+    // Use an atlas larger than atlasMaxSize if it's too small for the request
+    // (meaning the render target is larger than atlasMaxSize).
+    const uint16_t atlasMaxWidth = std::max(atlasMaxSize, drawWidth);
+    const uint16_t atlasMaxHeight = std::max(atlasMaxSize, drawHeight);
+
+    // Stay below the atlas cache's band.
+    uint16_t top = atlasCacheAvailable ? atlasCache->height() : 0;
+    if (drawHeight > atlasMaxHeight - top)
     {
-        uint16_t atlasMaxSize = m_ctx->atlasMaxSize();
-        // Use an atlas larger than atlasMaxSize if it's too small for the
-        // request (meaning the render target is larger than atlasMaxSize).
-        m_atlasRectanizer = std::make_unique<skgpu::RectanizerSkyline>(
-            std::max(atlasMaxSize, drawWidth),
-            std::max(atlasMaxSize, drawHeight));
+        if (m_usesAtlasCache || !m_pendingAtlasDraws.empty())
+        {
+            return false; // Try again in a fresh flush.
+        }
+        // Give this flush the entire atlas, and start the band over.
+        m_atlasCacheBlocked = true;
+        atlasCache->clear();
+        top = 0;
+    }
+
+    if (m_atlasRectanizer == nullptr || m_atlasRectanizerTop != top)
+    {
+        m_atlasRectanizer =
+            std::make_unique<skgpu::RectanizerSkyline>(atlasMaxWidth,
+                                                       atlasMaxHeight - top);
+        m_atlasRectanizerTop = top;
     }
 
-    const uint16_t atlasMaxWidth = m_atlasRectanizer->width();
-    const uint16_t atlasMaxHeight = m_atlasRectanizer->height();
+    const uint16_t rectanizerWidth = m_atlasRectanizer->width();
+    const uint16_t rectanizerHeight = m_atlasRectanizer->height();
     uint16_t paddedWidth =
-        std::min<uint16_t>(drawWidth + desiredPadding * 2, atlasMaxWidth);
+        std::min<uint16_t>(drawWidth + desiredPadding * 2, rectanizerWidth);
     uint16_t paddedHeight =
-        std::min<uint16_t>(drawHeight + desiredPadding * 2, atlasMaxHeight);
+        std::min<uint16_t>(drawHeight + desiredPadding * 2, rectanizerHeight);
     int16_t ix, iy;
     if (!m_atlasRectanizer->addRect(paddedWidth, paddedHeight, &ix, &iy))
     {
         // Delete the rectanizer of it wasn't big enough for this path. It will
         // be reallocated to a large enough size on the next call.
-        if (drawWidth > atlasMaxWidth || drawHeight > atlasMaxHeight)
+        if (drawWidth > rectanizerWidth || drawHeight > rectanizerHeight)
         {
             m_atlasRectanizer = nullptr;
         }
@@ -585,13 +805,15 @@ bool RenderContext::LogicalFlush::allocateAtlasDraw(
 
     assert(ix >= 0);
     assert(iy >= 0);
-    assert(ix + paddedWidth <= atlasMaxWidth);
-    assert(iy + paddedHeight <= atlasMaxHeight);
+    assert(ix + paddedWidth <= rectanizerWidth);
+    assert(iy + paddedHeight <= rectanizerHeight);
+    iy += top;
 
     *x = ix + (paddedWidth - drawWidth) / 2;
     *y = iy + (paddedHeight - drawHeight) / 2;
     *paddedRegion = {ix, iy, ix + paddedWidth, iy + paddedHeight};
-    assert((TAABB<uint16_t>{0, 0, atlasMaxWidth, atlasMaxHeight})
+    RIVE_DEBUG_CODE(const uint16_t bottom = top + rectanizerHeight;)
+    assert((TAABB<uint16_t>{0, top, rectanizerWidth, bottom})
                .contains(*paddedRegion));
 
     m_atlasMaxX = std::max<uint32_t>(m_atlasMaxX, paddedRegion->right);
@@ -603,6 +825,55 @@ bool RenderContext::LogicalFlush::allocateAtlasDraw(
     return true;
 }
 
+void RenderContext::LogicalFlush::discardCachedAtlasDraws()
+{
+    assert(!m_hasDoneLayout);
+    m_atlasCacheDiscarded = true;
+    if (m_cachedAtlasDraws.empty())
+    {
+        return;
+    }
+    // Render each cached mask once, unless this flush already renders it.
+    auto regionID = [](const PathDraw* draw) {
+        return (uint32_t(draw->atlasScissor().left) << 16) |
+               draw->atlasScissor().top;
+    };
+    std::unordered_set<uint32_t> renderedRegions;
+    for (const PathDraw* draw : m_pendingAtlasDraws)
+    {
+        renderedRegions.insert(regionID(draw));
+    }
+    for (PathDraw* draw : m_cachedAtlasDraws)
+    {
+        if (renderedRegions.insert(regionID(draw)).second)
+        {
+            auto counts = cached_atlas_draw_counts(draw).toVec();
+            m_resourceCounts = m_resourceCounts.toVec() + counts;
+            m_cachedAtlasResourceCounts =
+                m_cachedAtlasResourceCounts.toVec() - counts;
+            m_pendingAtlasDraws.push_back(draw);
+        }
+    }
+    m_cachedAtlasDraws.clear();
+}
+
+void RenderContext::LogicalFlush::accumulateStats(FlushStats* stats) const
+{
+    assert(m_hasDoneLayout);
+    for (size_t i = 0; i < gpu::kDrawTypeCount; ++i)
+    {
+        stats->drawCounts[i] += m_drawCounts[i];
+    }
+    stats->batchCount += m_drawList.count();
+    stats->batchCountBeforeReordering +=
+        m_drawList.count() + m_reorderedBatchSavings;
+    for (const PathDraw* draw : m_pendingAtlasDraws)
+    {
+        const TAABB<uint16_t>& scissor = draw->atlasScissor();
+        stats->atlasPixelCount += size_t(scissor.width()) * scissor.height();
+    }
+}
+
 size_t RenderContext::LogicalFlush::allocateCoverageBufferRange(size_t length)
 {
     assert(m_ctx->frameInterlockMode() == gpu::InterlockMode::clockwiseAtomic);
@@ -629,7 +900,40 @@ void RenderContext::logicalFlush()
     m_logicalFlushes.emplace_back(new LogicalFlush(this));
 }
 
-void RenderContext::flush(const FlushResources& flushResources)
+static void trace_flush_stats(FlushTraceSink* sink,
+                              const RenderContext::FlushStats& stats,
+                              double startTime,
+                              double layoutEndTime,
+                              double prepareEndTime,
+                              double writeEndTime,
+                              double submitEndTime)
+{
+    sink->traceEvent("RenderContext::flush", startTime, submitEndTime);
+    sink->traceEvent("layout", startTime, layoutEndTime);
+    sink->traceEvent("prepareResources", layoutEndTime, prepareEndTime);
+    sink->traceEvent("writeResources", prepareEndTime, writeEndTime);
+    sink->traceEvent("submit", writeEndTime, submitEndTime);
+
+    size_t drawCount = 0;
+    for (size_t count : stats.drawCounts)
+    {
+        drawCount += count;
+    }
+    auto counter = [sink, submitEndTime](const char* name, size_t value) {
+        sink->traceCounter(name, submitEndTime, static_cast<double>(value));
+    };
+    counter("logicalFlushCount", stats.logicalFlushCount);
+    counter("drawCount", drawCount);
+    counter("batchCount", stats.batchCount);
+    counter("batchCountBeforeReordering", stats.batchCountBeforeReordering);
+    counter("tessVertexCount", stats.tessVertexCount);
+    counter("gradSpanCount", stats.gradSpanCount);
+    counter("atlasPixelCount", stats.atlasPixelCount);
+    counter("uploadedBufferBytes", stats.uploadedBufferBytes);
+}
+
+RenderContext::FlushStats RenderContext::flush(
+    const FlushResources& flushResources)
 {
     assert(m_didBeginFrame);
     assert(flushResources.renderTarget->width() ==
@@ -637,8 +941,39 @@ void RenderContext::flush(const FlushResources& flushResources)
     assert(flushResources.renderTarget->height() ==
            m_frameDescriptor.renderTargetHeight);
 
+    const double flushStartTime = m_impl->secondsNow();
+    FlushStats stats;
+    stats.logicalFlushCount = m_logicalFlushes.size();
+
     m_clipContentID = 0;
 
+    // Reallocating the atlas texture discards the masks cached in it. If the
+    // atlas is about to grow (or shrink to fit a smaller render target), render
+    // every mask this frame reads from the cache again. Otherwise, hold on to
+    // the atlas texture for as long as it has cached masks.
+    uint32_t atlasWidth = 0, atlasHeight = 0;
+    for (const auto& flush : m_logicalFlushes)
+    {
+        atlasWidth = std::max(flush->atlasWidth(), atlasWidth);
+        atlasHeight = std::max(flush->atlasHeight(), atlasHeight);
+    }
+    const size_t atlasWidthLimit =
+        std::max(atlasMaxSize(), frameDescriptor().renderTargetWidth);
+    const size_t atlasHeightLimit =
+        std::max(atlasMaxSize(), frameDescriptor().renderTargetHeight);
+    const bool atlasTextureWillResize =
+        atlasWidth > m_currentResourceAllocations.atlasTextureWidth ||
+        atlasHeight > m_currentResourceAllocations.atlasTextureHeight ||
+        m_currentResourceAllocations.atlasTextureWidth > atlasWidthLimit ||
+        m_currentResourceAllocations.atlasTextureHeight > atlasHeightLimit;
+    if (atlasTextureWillResize && m_atlasCache->enabled())
+    {
+        for (const auto& flush : m_logicalFlushes)
+        {
+            flush->discardCachedAtlasDraws();
+        }
+    }
+
     // Layout this frame's resource buffers and textures.
     LogicalFlush::ResourceCounters totalFrameResourceCounts;
     LogicalFlush::LayoutCounters layoutCounts;
@@ -752,12 +1087,55 @@ void RenderContext::flush(const FlushResources& flushResources)
         m_lastResourceTrimTimeInSeconds = flushTime;
     }
 
+    if (!atlasTextureWillResize && m_atlasCache->enabled())
+    {
+        allocs.atlasTextureWidth =
+            m_currentResourceAllocations.atlasTextureWidth;
+        allocs.atlasTextureHeight =
+            m_currentResourceAllocations.atlasTextureHeight;
+    }
+
+    if (allocs.gradTextureHeight !=
+            m_currentResourceAllocations.gradTextureHeight &&
+        m_gradientRampCache->rowCount() != 0)
+    {
+        // Reallocating the gradient texture discards the complex ramps that
+        // were cached in it. Render every ramp this frame references again,
+        // and forget the rest. (This only changes the gradient span counts,
+        // which no other allocation depends on.)
+        m_gradientRampCache->retainOnlyCurrentFrame();
+        layoutCounts.gradSpanCount = 0;
+        layoutCounts.gradSpanPaddingCount = 0;
+        for (const auto& flush : m_logicalFlushes)
+        {
+            flush->rerenderCachedGradients();
+            flush->layoutGradSpans(&layoutCounts);
+        }
+        resourceRequirements.gradSpanBufferCount =
+            layoutCounts.gradSpanCount + layoutCounts.gradSpanPaddingCount;
+        m_maxRecentResourceRequirements.gradSpanBufferCount =
+            std::max(m_maxRecentResourceRequirements.gradSpanBufferCount,
+                     resourceRequirements.gradSpanBufferCount);
+        if (resourceRequirements.gradSpanBufferCount >
+            allocs.gradSpanBufferCount)
+        {
+            allocs.gradSpanBufferCount =
+                resourceRequirements.gradSpanBufferCount * 5 / 4;
+        }
+    }
+    stats.tessVertexCount =
+        totalFrameResourceCounts.midpointFanTessVertexCount +
+        totalFrameResourceCounts.outerCubicTessVertexCount;
+    stats.gradSpanCount = layoutCounts.gradSpanCount;
+    const double layoutEndTime = m_impl->secondsNow();
+
     setResourceSizes(allocs);
 
     m_impl->prepareToFlush(flushResources.currentFrameNumber,
                            flushResources.safeFrameNumber);
 
     mapResourceBuffers(resourceRequirements);
+    const double prepareEndTime = m_impl->secondsNow();
 
     for (const auto& flush : m_logicalFlushes)
     {
@@ -784,6 +1162,21 @@ void RenderContext::flush(const FlushResources& flushResources)
     assert(m_triangleVertexData.elementsWritten() <=
            totalFrameResourceCounts.maxTriangleVertexCount);
 
+    stats.uploadedBufferBytes = m_flushUniformData.bytesWritten() +
+                                m_imageDrawUniformData.bytesWritten() +
+                                m_pathData.bytesWritten() +
+                                m_paintData.bytesWritten() +
+                                m_paintAuxData.bytesWritten() +
+                                m_contourData.bytesWritten() +
+                                m_gradSpanData.bytesWritten() +
+                                m_tessSpanData.bytesWritten() +
+                                m_triangleVertexData.bytesWritten();
+    for (const auto& flush : m_logicalFlushes)
+    {
+        flush->accumulateStats(&stats);
+    }
+    const double writeEndTime = m_impl->secondsNow();
+
     unmapResourceBuffers(resourceRequirements);
 
     // Issue logical flushes to the backend.
@@ -791,6 +1184,24 @@ void RenderContext::flush(const FlushResources& flushResources)
     {
         m_impl->flush(flush->desc());
     }
+    const double submitEndTime = m_impl->secondsNow();
+
+    stats.layoutSeconds = layoutEndTime - flushStartTime;
+    stats.prepareSeconds = prepareEndTime - layoutEndTime;
+    stats.writeResourcesSeconds = writeEndTime - prepareEndTime;
+    stats.submitSeconds = submitEndTime - writeEndTime;
+    stats.totalSeconds = submitEndTime - flushStartTime;
+    m_lastFlushStats = stats;
+    if (m_flushTraceSink != nullptr)
+    {
+        trace_flush_stats(m_flushTraceSink,
+                          stats,
+                          flushStartTime,
+                          layoutEndTime,
+                          prepareEndTime,
+                          writeEndTime,
+                          submitEndTime);
+    }
 
     if (!m_logicalFlushes.empty())
     {
@@ -816,6 +1227,8 @@ void RenderContext::flush(const FlushResources& flushResources)
     {
         resetContainers();
     }
+
+    return stats;
 }
 
 void RenderContext::LogicalFlush::layoutResources(
@@ -847,11 +1260,6 @@ void RenderContext::LogicalFlush::layoutResources(
         gpu::PaddingToAlignUp<gpu::kContourBufferAlignmentInElements>(
             m_resourceCounts.contourCount);
 
-    // Metal requires vertex buffers to be 256-byte aligned.
-    m_gradSpanPaddingCount =
-        gpu::PaddingToAlignUp<gpu::kGradSpanBufferAlignmentInElements>(
-            m_pendingGradSpanCount);
-
     size_t totalTessVertexCountWithPadding = 0;
     if ((m_resourceCounts.midpointFanTessVertexCount |
          m_resourceCounts.outerCubicTessVertexCount) != 0)
@@ -906,11 +1314,9 @@ void RenderContext::LogicalFlush::layoutResources(
             kMaxTessellationAlignmentVertices;
     }
 
-    // Complex gradients begin on the first row immediately after the simple
-    // gradients.
-    m_gradTextureLayout.complexOffsetY = math::lossless_numeric_cast<uint32_t>(
-        resource_texture_height<gpu::kGradTextureWidthInSimpleRamps>(
-            m_simpleGradients.size()));
+    // Simple gradients begin on the first row immediately after the cached
+    // complex gradients.
+    m_gradTextureLayout.simpleOffsetY = m_complexGradRowCount;
 
     m_flushDesc.renderTarget = flushResources.renderTarget;
     m_flushDesc.interlockMode = m_ctx->frameInterlockMode();
@@ -994,6 +1400,24 @@ void RenderContext::LogicalFlush::layoutResources(
     m_flushDesc.atlasContentWidth = m_atlasMaxX;
     m_flushDesc.atlasContentHeight = m_atlasMaxY;
 
+    // Preserve the masks in the atlas cache's band, unless this flush is the
+    // first to render into it since it was reset.
+    AtlasCache* atlasCache = m_ctx->m_atlasCache.get();
+    if (atlasCache->enabled() && !m_atlasCacheBlocked &&
+        !m_atlasCacheDiscarded && !m_pendingAtlasDraws.empty())
+    {
+        if (m_usesAtlasCache &&
+            atlasCache->clearedGeneration() != m_atlasCacheGeneration)
+        {
+            atlasCache->markCleared(m_atlasCacheGeneration);
+        }
+        else
+        {
+            m_flushDesc.atlasCacheHeight = atlasCache->height();
+        }
+        assert(m_flushDesc.atlasCacheHeight <= m_flushDesc.atlasContentHeight);
+    }
+
     m_flushDesc.flushUniformDataOffsetInBytes =
         logicalFlushIdx * sizeof(gpu::FlushUniforms);
     m_flushDesc.pathCount =
@@ -1008,12 +1432,8 @@ void RenderContext::LogicalFlush::layoutResources(
         math::lossless_numeric_cast<uint32_t>(m_resourceCounts.contourCount);
     m_flushDesc.firstContour = runningFrameResourceCounts->contourCount +
                                runningFrameLayoutCounts->contourPaddingCount;
-    m_flushDesc.gradSpanCount =
-        math::lossless_numeric_cast<uint32_t>(m_pendingGradSpanCount);
-    m_flushDesc.firstGradSpan = runningFrameLayoutCounts->gradSpanCount +
-                                runningFrameLayoutCounts->gradSpanPaddingCount;
     m_flushDesc.gradDataHeight = math::lossless_numeric_cast<uint32_t>(
-        m_gradTextureLayout.complexOffsetY + m_complexGradients.size());
+        gradient_data_height(m_simpleGradients.size(), m_complexGradRowCount));
     m_flushDesc.tessDataHeight = tessDataHeight;
     m_flushDesc.clockwiseFillOverride = frameDescriptor.clockwiseFillOverride;
     m_flushDesc.wireframe = frameDescriptor.wireframe;
@@ -1027,8 +1447,7 @@ void RenderContext::LogicalFlush::layoutResources(
     runningFrameLayoutCounts->paintPaddingCount += m_paintPaddingCount;
     runningFrameLayoutCounts->paintAuxPaddingCount += m_paintAuxPaddingCount;
     runningFrameLayoutCounts->contourPaddingCount += m_contourPaddingCount;
-    runningFrameLayoutCounts->gradSpanCount += m_pendingGradSpanCount;
-    runningFrameLayoutCounts->gradSpanPaddingCount += m_gradSpanPaddingCount;
+    layoutGradSpans(runningFrameLayoutCounts);
     runningFrameLayoutCounts->maxGradTextureHeight =
         std::max(m_flushDesc.gradDataHeight,
                  runningFrameLayoutCounts->maxGradTextureHeight);
@@ -1050,10 +1469,39 @@ void RenderContext::LogicalFlush::layoutResources(
            0);
     assert(m_flushDesc.firstContour % gpu::kContourBufferAlignmentInElements ==
            0);
+    RIVE_DEBUG_CODE(m_hasDoneLayout = true;)
+}
+
+void RenderContext::LogicalFlush::layoutGradSpans(
+    LayoutCounters* runningFrameLayoutCounts)
+{
+    // Metal requires vertex buffers to be 256-byte aligned.
+    m_gradSpanPaddingCount =
+        gpu::PaddingToAlignUp<gpu::kGradSpanBufferAlignmentInElements>(
+            m_pendingGradSpanCount);
+
+    m_flushDesc.gradSpanCount =
+        math::lossless_numeric_cast<uint32_t>(m_pendingGradSpanCount);
+    m_flushDesc.firstGradSpan = runningFrameLayoutCounts->gradSpanCount +
+                                runningFrameLayoutCounts->gradSpanPaddingCount;
+
+    runningFrameLayoutCounts->gradSpanCount += m_pendingGradSpanCount;
+    runningFrameLayoutCounts->gradSpanPaddingCount += m_gradSpanPaddingCount;
+
     assert(m_flushDesc.firstGradSpan %
                gpu::kGradSpanBufferAlignmentInElements ==
            0);
-    RIVE_DEBUG_CODE(m_hasDoneLayout = true;)
+}
+
+void RenderContext::LogicalFlush::rerenderCachedGradients()
+{
+    m_pendingComplexGradDraws.clear();
+    m_pendingGradSpanCount = m_pendingSimpleGradDraws.size();
+    for (const auto& [key, row] : m_complexGradients)
+    {
+        m_pendingComplexGradDraws.push_back({key.gradient(), row});
+        m_pendingGradSpanCount += key.gradient()->count() - 1;
+    }
 }
 
 void RenderContext::LogicalFlush::writeResources()
@@ -1101,8 +1549,9 @@ void RenderContext::LogicalFlush::writeResources()
             // Render each simple gradient as a single, empty GradientSpan with
             // 1px borders to the left and right.
             auto [color0, color1] = m_pendingSimpleGradDraws[i];
-            uint32_t y = math::lossless_numeric_cast<uint32_t>(
-                i / gpu::kGradTextureWidthInSimpleRamps);
+            uint32_t y = m_gradTextureLayout.simpleOffsetY +
+                         math::lossless_numeric_cast<uint32_t>(
+                             i / gpu::kGradTextureWidthInSimpleRamps);
             size_t centerX = (i % gpu::kGradTextureWidthInSimpleRamps) * 2 + 1;
             uint32_t centerXFixed = math::lossless_numeric_cast<uint32_t>(
                 centerX * ONE_TEXEL_FIXED);
@@ -1117,20 +1566,18 @@ void RenderContext::LogicalFlush::writeResources()
     }
 
     // Write out the vertex data for rendering complex gradients.
-    assert(m_complexGradients.size() == m_pendingComplexGradDraws.size());
+    assert(m_pendingComplexGradDraws.size() <= m_complexGradients.size());
     if (!m_pendingComplexGradDraws.empty())
     {
-        // The viewport will start at simpleGradDataHeight when rendering color
-        // ramps.
-        for (uint32_t i = 0; i < m_pendingComplexGradDraws.size(); ++i)
+        for (const auto& [gradient, row] : m_pendingComplexGradDraws)
         {
             // Push "GradientSpan" instances that will render each section of
             // this color ramp's gradient.
-            const Gradient* gradient = m_pendingComplexGradDraws[i];
             const float* stops = gradient->stops();
             const ColorInt* colors = gradient->colors();
             size_t stopCount = gradient->count();
-            uint32_t y = i + m_gradTextureLayout.complexOffsetY;
+            uint32_t y = row;
+            assert(y < m_gradTextureLayout.simpleOffsetY);
 
             // "stop * m + a" converts a stop position to a fixed-point x
             // coordinate in the gradient texture. (In an ideal world, stops
@@ -1252,6 +1699,11 @@ void RenderContext::LogicalFlush::writeResources()
         constexpr static int kDrawIndexShift = 2;
         constexpr static int64_t kDrawIndexMask = 0x7fff << kDrawIndexShift;
         constexpr static int64_t kSubpassIndexMask = 0x3;
+        // Draws whose keys match within this mask can usually be batched.
+        constexpr static int64_t kBatchKeyMask = kDrawTypeMask |
+                                                 kTextureHashMask |
+                                                 kBlendModeMask |
+                                                 kDrawContentsMask;
 
         for (size_t i = 0; i < m_draws.size(); ++i)
         {
@@ -1372,6 +1824,7 @@ void RenderContext::LogicalFlush::writeResources()
                                     1,
                                     0,
                                     BlendMode::srcOver);
+            ++m_drawCounts[static_cast<size_t>(DrawType::atomicInitialize)];
             pushBarrier();
         }
 
@@ -1421,13 +1874,63 @@ void RenderContext::LogicalFlush::writeResources()
                 break;
         }
 
+        // Each drawGroupIdx is now sorted by draw type, texture, blend mode,
+        // and contents, but the draws within it don't overlap, so they can be
+        // issued in either order. When changing drawGroupIdx doesn't require a
+        // barrier, reverse the groups whose last draw (but not their first)
+        // can continue the previous group's batch.
+        if ((needsBarrierMask & kDrawGroupMask) == 0)
+        {
+            // Prepasses have negative keys. Only reorder the subpasses.
+            auto groupBegin = std::lower_bound(indirectDrawList.begin(),
+                                               indirectDrawList.end(),
+                                               0);
+            int64_t priorGroupMaxKey = -1;
+            int64_t priorGroupLastKey = -1;
+            while (groupBegin != indirectDrawList.end())
+            {
+                int64_t drawGroup = *groupBegin & kDrawGroupMask;
+                auto groupEnd = std::find_if(
+                    groupBegin,
+                    indirectDrawList.end(),
+                    [drawGroup](int64_t key) {
+                        return (key & kDrawGroupMask) != drawGroup;
+                    });
+                int64_t groupMinKey = groupBegin[0];
+                int64_t groupMaxKey = groupEnd[-1];
+                if (priorGroupLastKey >= 0)
+                {
+                    int64_t priorBatchKey = priorGroupLastKey & kBatchKeyMask;
+                    if ((groupMinKey & kBatchKeyMask) != priorBatchKey &&
+                        (groupMaxKey & kBatchKeyMask) == priorBatchKey)
+                    {
+                        std::reverse(groupBegin, groupEnd);
+                    }
+                    // Track the batches we gained or lost compared to
+                    // leaving every group in ascending order.
+                    m_reorderedBatchSavings +=
+                        ((groupMinKey ^ priorGroupMaxKey) & kBatchKeyMask) !=
+                        0;
+                    m_reorderedBatchSavings -=
+                        ((groupBegin[0] ^ priorGroupLastKey) & kBatchKeyMask) !=
+                        0;
+                }
+                priorGroupMaxKey = groupMaxKey;
+                priorGroupLastKey = groupEnd[-1];
+                groupBegin = groupEnd;
+            }
+        }
+
         // Write out the draw data from the sorted draw list, and build up a
         // condensed/batched list of low-level draws.
         int64_t priorSignedKey =
             !indirectDrawList.empty() ? indirectDrawList[0] : 0;
         for (const int64_t signedKey : indirectDrawList)
         {
-            assert(signedKey >= priorSignedKey);
+            // Keys are ascending, except within groups that were reversed
+            // above.
+            assert(signedKey >= priorSignedKey ||
+                   ((signedKey ^ priorSignedKey) & kDrawGroupMask) == 0);
             if ((priorSignedKey & needsBarrierMask) !=
                 (signedKey & needsBarrierMask))
             {
@@ -1460,6 +1963,7 @@ void RenderContext::LogicalFlush::writeResources()
                                     1,
                                     0,
                                     BlendMode::srcOver);
+            ++m_drawCounts[static_cast<size_t>(DrawType::atomicResolve)];
             m_drawList.tail().shaderFeatures = m_combinedShaderFeatures;
         }
     }
@@ -1553,6 +2057,11 @@ void RenderContext::LogicalFlush::writeResources()
                m_pendingAtlasDraws.size());
     }
 
+    if (!m_deferredTessellations.empty())
+    {
+        writeDeferredTessellationData();
+    }
+
     // Pad our buffers to 256-byte alignment.
     m_ctx->m_pathData.push_back_n(nullptr, m_pathPaddingCount);
     m_ctx->m_paintData.push_back_n(nullptr, m_paintPaddingCount);
@@ -1831,6 +2340,8 @@ void RenderContext::setResourceSizes(ResourceAllocationCounts allocs,
         m_impl->resizeAtlasTexture(
             math::lossless_numeric_cast<uint32_t>(allocs.atlasTextureWidth),
             math::lossless_numeric_cast<uint32_t>(allocs.atlasTextureHeight));
+        // The new texture doesn't have any of the cached masks.
+        m_atlasCache->clear();
     }
 
     assert(allocs.coverageBufferLength <=
@@ -2079,9 +2590,12 @@ RenderContext::TessellationWriter::TessellationWriter(
     uint32_t forwardTessVertexCount,
     uint32_t forwardTessLocation,
     uint32_t mirroredTessVertexCount,
-    uint32_t mirroredTessLocation) :
+    uint32_t mirroredTessLocation,
+    DeferredTessellation* deferred) :
     m_flush(flush),
-    m_tessSpanData(m_flush->m_ctx->m_tessSpanData),
+    m_deferred(deferred),
+    m_tessSpanData(m_deferred != nullptr ? m_deferred->tessSpanData
+                                         : m_flush->m_ctx->m_tessSpanData),
     m_pathID(pathID),
     m_contourDirections(contourDirections),
     m_pathTessLocation(forwardTessLocation),
@@ -2109,11 +2623,12 @@ RenderContext::TessellationWriter::~TessellationWriter()
     assert(m_pathMirroredTessLocation == m_expectedPathMirroredTessEndLocation);
 }
 
-uint32_t RenderContext::LogicalFlush::pushContour(uint32_t pathID,
-                                                  Vec2D midpoint,
-                                                  bool isStroke,
-                                                  bool closed,
-                                                  uint32_t vertexIndex0)
+static void write_contour(WriteOnlyMappedMemory<gpu::ContourData>& contourData,
+                          uint32_t pathID,
+                          Vec2D midpoint,
+                          bool isStroke,
+                          bool closed,
+                          uint32_t vertexIndex0)
 {
     assert(pathID != 0);
     assert(isStroke || closed);
@@ -2122,7 +2637,21 @@ uint32_t RenderContext::LogicalFlush::pushContour(uint32_t pathID,
     {
         midpoint.x = closed ? 1 : 0;
     }
-    m_ctx->m_contourData.emplace_back(midpoint, pathID, vertexIndex0);
+    contourData.emplace_back(midpoint, pathID, vertexIndex0);
+}
+
+uint32_t RenderContext::LogicalFlush::pushContour(uint32_t pathID,
+                                                  Vec2D midpoint,
+                                                  bool isStroke,
+                                                  bool closed,
+                                                  uint32_t vertexIndex0)
+{
+    write_contour(m_ctx->m_contourData,
+                  pathID,
+                  midpoint,
+                  isStroke,
+                  closed,
+                  vertexIndex0);
 
     ++m_currentContourID;
     assert(0 < m_currentContourID && m_currentContourID <= gpu::kMaxContourID);
@@ -2143,6 +2672,19 @@ uint32_t RenderContext::TessellationWriter::pushContour(
     // patch size. (See gpu::PaddingToAlignUp().)
     m_nextCubicPaddingVertexCount = paddingVertexCount;
 
+    if (m_deferred != nullptr)
+    {
+        write_contour(m_deferred->contourData,
+                      m_pathID,
+                      midpoint,
+                      isStroke,
+                      closed,
+                      nextVertexIndex());
+        ++m_deferred->currentContourID;
+        assert(m_deferred->currentContourID <= gpu::kMaxContourID);
+        return m_deferred->currentContourID;
+    }
+
     return m_flush->pushContour(m_pathID,
                                 midpoint,
                                 isStroke,
@@ -2164,7 +2706,9 @@ void RenderContext::TessellationWriter::pushCubic(
     assert(0 <= polarSegmentCount && polarSegmentCount <= kMaxPolarSegments);
     assert(joinSegmentCount > 0);
     assert((contourIDWithFlags & 0xffff) ==
-           (m_flush->m_currentContourID & 0xffff));
+           ((m_deferred != nullptr ? m_deferred->currentContourID
+                                   : m_flush->m_currentContourID) &
+            0xffff));
     assert((contourIDWithFlags & 0xffff) != 0); // contourID can't be zero.
 
     // Polar and parametric segments share the same beginning and ending
@@ -2380,6 +2924,89 @@ void RenderContext::LogicalFlush::pushPaddingVertices(uint32_t count,
                                INVALID_CONTOUR_ID_WITH_FLAGS);
 }
 
+bool RenderContext::LogicalFlush::deferTessellationData(
+    PathDraw* draw,
+    uint32_t tessVertexCount,
+    uint32_t tessLocation)
+{
+    assert(m_hasDoneLayout);
+    if (m_ctx->m_flushTaskScheduler == nullptr)
+    {
+        return false;
+    }
+
+    const ResourceCounters& counts = draw->resourceCounts();
+    uint32_t contourCount =
+        math::lossless_numeric_cast<uint32_t>(counts.contourCount);
+    DeferredTessellation& deferred = m_deferredTessellations.emplace_back();
+    deferred.draw = draw;
+    deferred.tessVertexCount = tessVertexCount;
+    deferred.tessLocation = tessLocation;
+    deferred.contourData = m_ctx->m_contourData.reserve_back(contourCount);
+    deferred.currentContourID = m_currentContourID;
+    m_currentContourID += contourCount;
+    assert(m_currentContourID <= gpu::kMaxContourID);
+    assert(m_flushDesc.firstContour + m_currentContourID ==
+           m_ctx->m_contourData.elementsWritten());
+    return true;
+}
+
+void RenderContext::LogicalFlush::writeDeferredTessellationData()
+{
+    assert(m_ctx->m_flushTaskScheduler != nullptr);
+
+    // Lay out a worst case span range for each tessellation in scratch
+    // memory.
+    size_t scratchSpanCount = 0;
+    for (DeferredTessellation& deferred : m_deferredTessellations)
+    {
+        deferred.firstScratchSpan = scratchSpanCount;
+        scratchSpanCount += deferred.draw->maxTessSpanCount(
+            deferred.tessVertexCount,
+            deferred.tessLocation);
+    }
+    if (m_deferredTessSpanScratch.size() < scratchSpanCount)
+    {
+        m_deferredTessSpanScratch.resize(scratchSpanCount);
+    }
+
+    // Each deferred tessellation only writes its own contour and scratch span
+    // ranges, and only mutates its own draw.
+    m_ctx->m_flushTaskScheduler->parallelFor(
+        m_deferredTessellations.size(),
+        [this](size_t i) {
+            DeferredTessellation& deferred = m_deferredTessellations[i];
+            deferred.tessSpanData.reset(
+                m_deferredTessSpanScratch.data() + deferred.firstScratchSpan,
+                deferred.draw->maxTessSpanCount(deferred.tessVertexCount,
+                                                deferred.tessLocation));
+            deferred.draw->writeTessellationData(this,
+                                                 deferred.tessVertexCount,
+                                                 deferred.tessLocation,
+                                                 &deferred);
+        });
+
+    // Nothing else writes to the tessellation buffer once draws are deferred,
+    // so reserving the exact span counts in draw order puts every span where
+    // the serial path would have written it.
+    for (DeferredTessellation& deferred : m_deferredTessellations)
+    {
+        assert(!deferred.contourData.hasRoomFor(1));
+        deferred.tessSpanCount = deferred.tessSpanData.elementsWritten();
+        deferred.tessSpanData =
+            m_ctx->m_tessSpanData.reserve_back(deferred.tessSpanCount);
+    }
+    m_ctx->m_flushTaskScheduler->parallelFor(
+        m_deferredTessellations.size(),
+        [this](size_t i) {
+            DeferredTessellation& deferred = m_deferredTessellations[i];
+            deferred.tessSpanData.push_back_n(
+                m_deferredTessSpanScratch.data() + deferred.firstScratchSpan,
+                deferred.tessSpanCount);
+        });
+    m_deferredTessellations.clear();
+}
+
 void RenderContext::LogicalFlush::pushMidpointFanDraw(
     const PathDraw* draw,
     gpu::DrawType drawType,
@@ -2652,6 +3279,7 @@ gpu::DrawBatch& RenderContext::LogicalFlush::pushDraw(
     uint32_t baseElement)
 {
     assert(m_hasDoneLayout);
+    ++m_drawCounts[static_cast<size_t>(drawType)];
 
     bool canMergeWithPreviousBatch;
     switch (drawType)
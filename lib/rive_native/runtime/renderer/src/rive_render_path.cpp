@@ -249,6 +249,13 @@ rcp<RiveRenderPath> RiveRenderPath::makeSoftenedCopyForFeathering(
     float feather,
     float matrixMaxScale)
 {
+    if (!(m_dirt & kSoftenedCopyDirt) && m_softenedCopyFeather == feather &&
+        m_softenedCopyMatrixMaxScale == matrixMaxScale &&
+        m_softenedCopy->getFillRule() == m_fillRule)
+    {
+        return m_softenedCopy;
+    }
+
     // Since curvature is what breaks 1-dimensional feathering along the normal
     // vector, chop into segments that rotate no more than a certain threshold.
     constexpr static int POLAR_JOIN_PRECISION = 2;
@@ -364,6 +371,10 @@ rcp<RiveRenderPath> RiveRenderPath::makeSoftenedCopyForFeathering(
                 RIVE_UNREACHABLE();
         }
     }
-    return make_rcp<RiveRenderPath>(m_fillRule, featheredPath);
+    m_softenedCopy = make_rcp<RiveRenderPath>(m_fillRule, featheredPath);
+    m_softenedCopyFeather = feather;
+    m_softenedCopyMatrixMaxScale = matrixMaxScale;
+    m_dirt &= ~kSoftenedCopyDirt;
+    return m_softenedCopy;
 }
 } // namespace rive
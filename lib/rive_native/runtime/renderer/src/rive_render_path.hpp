@@ -50,6 +50,10 @@ public:
     // path with shorter, flatter curves that will more accurately depict a
     // gaussian blur when drawn with the given feather.
     //
+    // The copy is reused until this path mutates or gets softened with
+    // different parameters, so a static feathered path keeps the same mutation
+    // ID from frame to frame.
+    //
     // TODO: Move this work to the GPU.
     rcp<RiveRenderPath> makeSoftenedCopyForFeathering(float feather,
                                                       float matrixMaxScale);
@@ -72,11 +76,16 @@ private:
     mutable float m_coarseArea;
     mutable uint64_t m_rawPathMutationID;
 
+    rcp<RiveRenderPath> m_softenedCopy;
+    float m_softenedCopyFeather;
+    float m_softenedCopyMatrixMaxScale;
+
     enum Dirt
     {
         kPathBoundsDirt = 1 << 0,
         kRawPathMutationIDDirt = 1 << 1,
         kPathCoarseAreaDirt = 1 << 2,
+        kSoftenedCopyDirt = 1 << 3,
         kAllDirt = ~0,
     };
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "triangulation_cache.hpp"
+
+#include <functional>
+
+namespace rive::gpu
+{
+bool TriangulationCache::Key::operator==(const Key& other) const
+{
+    return rawPathMutationID == other.rawPathMutationID &&
+           matrix == other.matrix && fillRule == other.fillRule &&
+           direction == other.direction &&
+           negateWinding == other.negateWinding;
+}
+
+size_t TriangulationCache::KeyHash::operator()(const Key& key) const
+{
+    // Mutation IDs are unique across all paths, the rest of the key rarely
+    // differs between entries with the same ID.
+    size_t hash = std::hash<uint64_t>()(key.rawPathMutationID);
+    for (int i = 0; i < 6; ++i)
+    {
+        hash = hash * 31 + std::hash<float>()(key.matrix[i]);
+    }
+    return hash;
+}
+
+void TriangulationCache::setCapacity(size_t capacity)
+{
+    m_capacity = capacity;
+    trim();
+}
+
+void TriangulationCache::beginFrame()
+{
+    ++m_currentFrame;
+    // Nothing is in use yet, so this gets the cache back within capacity.
+    trim();
+}
+
+void TriangulationCache::trim()
+{
+    while (m_entries.size() > m_capacity &&
+           m_entries.back().lastUsedFrame < m_currentFrame)
+    {
+        m_lookup.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+void TriangulationCache::clear()
+{
+    m_lookup.clear();
+    m_entries.clear();
+}
+
+TriangulationCache::Entry* TriangulationCache::find(const Key& key)
+{
+    auto it = m_lookup.find(key);
+    if (it == m_lookup.end())
+    {
+        return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    Entry* entry = &m_entries.front();
+    entry->lastUsedFrame = m_currentFrame;
+    return entry;
+}
+
+TriangulationCache::Entry* TriangulationCache::insert(const Key& key)
+{
+    if (m_capacity == 0)
+    {
+        return nullptr;
+    }
+    if (m_entries.size() >= m_capacity)
+    {
+        // The least recently used entry is the only eviction candidate. If a
+        // draw in this frame still references it, so does everything else.
+        if (m_entries.back().lastUsedFrame == m_currentFrame)
+        {
+            return nullptr;
+        }
+        m_lookup.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+    m_entries.emplace_front(key);
+    Entry* entry = &m_entries.front();
+    entry->lastUsedFrame = m_currentFrame;
+    m_lookup[key] = m_entries.begin();
+    return entry;
+}
+} // namespace rive::gpu
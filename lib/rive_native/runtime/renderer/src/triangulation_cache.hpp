@@ -0,0 +1,118 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include "gr_inner_fan_triangulator.hpp"
+#include "rive/math/mat2d.hpp"
+#include "rive/renderer/trivial_block_allocator.hpp"
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace rive::gpu
+{
+// Keeps the interior triangulations of large filled paths alive across frames,
+// so static shapes don't rerun GrInnerFanTriangulator every frame.
+//
+// Entries are keyed by the path's raw path mutation ID along with everything
+// else that feeds the triangulator. The triangulation is emitted in pixel
+// space, so the view matrix has to match exactly. Entries are evicted in LRU
+// order, but never while a draw from the current frame may still reference
+// them.
+class TriangulationCache
+{
+public:
+    struct Key
+    {
+        uint64_t rawPathMutationID;
+        Mat2D matrix;
+        FillRule fillRule;
+        GrTriangulator::Comparator::Direction direction;
+        bool negateWinding;
+
+        bool operator==(const Key&) const;
+    };
+
+    explicit TriangulationCache(size_t capacity) : m_capacity(capacity) {}
+
+    // Maximum number of triangulations kept across frames. 0 disables the
+    // cache. Entries over the capacity that the current frame uses are
+    // dropped when the next frame begins.
+    void setCapacity(size_t capacity);
+    size_t capacity() const { return m_capacity; }
+
+    // Entries used on or after this frame can't be evicted.
+    void beginFrame();
+
+    // Drops every entry. Not valid while a frame is in progress.
+    void clear();
+
+    // Returns the triangulation for key, creating it with
+    // makeTriangulator(TrivialBlockAllocator*) on a miss. When every entry is
+    // still in use by the current frame (or the cache is disabled), the new
+    // triangulation is made in frameAllocator and not cached.
+    template <typename MakeTriangulator>
+    GrInnerFanTriangulator* findOrMake(const Key& key,
+                                       TrivialBlockAllocator* frameAllocator,
+                                       MakeTriangulator&& makeTriangulator)
+    {
+        if (Entry* entry = find(key))
+        {
+            ++m_hitCount;
+            return entry->triangulator;
+        }
+        ++m_missCount;
+        Entry* entry = insert(key);
+        if (entry == nullptr)
+        {
+            return makeTriangulator(frameAllocator);
+        }
+        entry->triangulator = makeTriangulator(&entry->allocator);
+        return entry->triangulator;
+    }
+
+    size_t hitCount() const { return m_hitCount; }
+    size_t missCount() const { return m_missCount; }
+    size_t entryCount() const { return m_entries.size(); }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const Key&) const;
+    };
+
+    struct Entry
+    {
+        Entry(const Key& key_) :
+            key(key_), allocator(GrTriangulator::kArenaDefaultChunkSize)
+        {}
+
+        Key key;
+        TrivialBlockAllocator allocator;
+        GrInnerFanTriangulator* triangulator = nullptr;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    // Returns the entry for key and marks it as the most recently used.
+    Entry* find(const Key&);
+
+    // Adds an empty entry for key, evicting the least recently used one if the
+    // cache is full. Returns null if nothing could be evicted.
+    Entry* insert(const Key&);
+
+    // Evicts least recently used entries until the cache is within capacity,
+    // stopping at the first one the current frame uses.
+    void trim();
+
+    size_t m_capacity;
+    uint64_t m_currentFrame = 0;
+    size_t m_hitCount = 0;
+    size_t m_missCount = 0;
+
+    // Most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_lookup;
+};
+} // namespace rive::gpu
@@ -8,6 +8,10 @@
 #include "rive/renderer/texture.hpp"
 #include "rive/renderer/rive_render_buffer.hpp"
 #include "shaders/constants.glsl"
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
 
 #ifdef RIVE_DECODERS
 #include "rive/decoders/bitmap_decoder.hpp"
@@ -723,7 +727,8 @@ public:
         VkAttachmentDescription attachment = {
             .format = VK_FORMAT_R8G8B8A8_UNORM,
             .samples = VK_SAMPLE_COUNT_1_BIT,
-            .loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            // Rows that aren't rendered this flush hold cached color ramps.
+            .loadOp = VK_ATTACHMENT_LOAD_OP_LOAD,
             .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
             .initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
             .finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
@@ -757,7 +762,7 @@ public:
         };
 
         VK_CHECK(m_vk->CreateGraphicsPipelines(m_vk->device,
-                                               VK_NULL_HANDLE,
+                                               impl->m_pipelineCache,
                                                1,
                                                &pipelineCreateInfo,
                                                nullptr,
@@ -930,7 +935,7 @@ public:
         };
 
         VK_CHECK(m_vk->CreateGraphicsPipelines(m_vk->device,
-                                               VK_NULL_HANDLE,
+                                               impl->m_pipelineCache,
                                                1,
                                                &pipelineCreateInfo,
                                                nullptr,
@@ -1086,7 +1091,7 @@ public:
         stages[1].module = fragmentFillShader;
         blendState.colorBlendOp = VK_BLEND_OP_ADD;
         VK_CHECK(m_vk->CreateGraphicsPipelines(m_vk->device,
-                                               VK_NULL_HANDLE,
+                                               impl->m_pipelineCache,
                                                1,
                                                &pipelineCreateInfo,
                                                nullptr,
@@ -1095,7 +1100,7 @@ public:
         stages[1].module = fragmentStrokeShader;
         blendState.colorBlendOp = VK_BLEND_OP_MAX;
         VK_CHECK(m_vk->CreateGraphicsPipelines(m_vk->device,
-                                               VK_NULL_HANDLE,
+                                               impl->m_pipelineCache,
                                                1,
                                                &pipelineCreateInfo,
                                                nullptr,
@@ -1793,9 +1798,36 @@ RIVE_MAKE_ENUM_BITSET(DrawPipelineOptions);
 class RenderContextVulkanImpl::DrawPipeline
 {
 public:
+    // Unique key for a pipeline in m_drawPipelines.
+    static uint32_t Key(gpu::DrawType drawType,
+                        gpu::ShaderFeatures shaderFeatures,
+                        gpu::InterlockMode interlockMode,
+                        gpu::ShaderMiscFlags shaderMiscFlags,
+                        DrawPipelineOptions drawPipelineOptions,
+                        int renderPassVariantIdx)
+    {
+        uint32_t pipelineKey = gpu::ShaderUniqueKey(drawType,
+                                                    shaderFeatures,
+                                                    interlockMode,
+                                                    shaderMiscFlags);
+        assert(pipelineKey << kDrawPipelineOptionCount >>
+                   kDrawPipelineOptionCount ==
+               pipelineKey);
+        pipelineKey = (pipelineKey << kDrawPipelineOptionCount) |
+                      static_cast<uint32_t>(drawPipelineOptions);
+        assert(pipelineKey * DrawPipelineLayout::kRenderPassVariantCount /
+                   DrawPipelineLayout::kRenderPassVariantCount ==
+               pipelineKey);
+        return (pipelineKey * DrawPipelineLayout::kRenderPassVariantCount) +
+               renderPassVariantIdx;
+    }
+
+    // DrawPipeline doesn't touch any mutable state in 'impl', so the
+    // BackgroundPipelineCompiler can create them on its own thread.
     DrawPipeline(RenderContextVulkanImpl* impl,
                  gpu::DrawType drawType,
                  const DrawPipelineLayout& pipelineLayout,
+                 const DrawShader& drawShader,
                  gpu::ShaderFeatures shaderFeatures,
                  gpu::ShaderMiscFlags shaderMiscFlags,
                  DrawPipelineOptions drawPipelineOptions,
@@ -1803,18 +1835,6 @@ public:
         m_vk(ref_rcp(impl->vulkanContext()))
     {
         gpu::InterlockMode interlockMode = pipelineLayout.interlockMode();
-        uint32_t shaderKey = gpu::ShaderUniqueKey(drawType,
-                                                  shaderFeatures,
-                                                  interlockMode,
-                                                  shaderMiscFlags);
-        const DrawShader& drawShader = impl->m_drawShaders
-                                           .try_emplace(shaderKey,
-                                                        m_vk.get(),
-                                                        drawType,
-                                                        interlockMode,
-                                                        shaderFeatures,
-                                                        shaderMiscFlags)
-                                           .first->second;
 
         uint32_t shaderPermutationFlags[SPECIALIZATION_COUNT] = {
             shaderFeatures & gpu::ShaderFeatures::ENABLE_CLIPPING,
@@ -2040,7 +2060,7 @@ public:
         }
 
         VK_CHECK(m_vk->CreateGraphicsPipelines(m_vk->device,
-                                               VK_NULL_HANDLE,
+                                               impl->m_pipelineCache,
                                                1,
                                                &pipelineCreateInfo,
                                                nullptr,
@@ -2059,9 +2079,145 @@ private:
     VkPipeline m_vkPipeline;
 };
 
+// Creates DrawPipelines on a background thread, ahead of their first use in
+// flush().
+class RenderContextVulkanImpl::BackgroundPipelineCompiler
+{
+public:
+    struct Job
+    {
+        uint32_t pipelineKey;
+        gpu::DrawType drawType;
+        const DrawPipelineLayout* pipelineLayout;
+        gpu::ShaderFeatures shaderFeatures;
+        gpu::ShaderMiscFlags shaderMiscFlags;
+        VkRenderPass vkRenderPass;
+        std::unique_ptr<DrawPipeline> drawPipeline; // Set when finished.
+    };
+
+    BackgroundPipelineCompiler(RenderContextVulkanImpl* impl) : m_impl(impl) {}
+
+    ~BackgroundPipelineCompiler()
+    {
+        if (m_compilerThread.joinable())
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_shouldQuit = true;
+            }
+            m_workAddedCondition.notify_all();
+            m_compilerThread.join();
+        }
+    }
+
+    void pushJob(Job&& job)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            if (!m_compilerThread.joinable())
+            {
+                m_compilerThread =
+                    std::thread(&BackgroundPipelineCompiler::threadMain, this);
+            }
+            m_pendingJobs.push(std::move(job));
+        }
+        m_workAddedCondition.notify_all();
+    }
+
+    // Never blocks.
+    bool popFinishedJob(Job* job)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_finishedJobs.empty())
+        {
+            return false;
+        }
+        *job = std::move(m_finishedJobs.back());
+        m_finishedJobs.pop_back();
+        return true;
+    }
+
+private:
+    void threadMain()
+    {
+        std::unique_lock lock(m_mutex);
+        for (;;)
+        {
+            while (m_pendingJobs.empty() && !m_shouldQuit)
+            {
+                m_workAddedCondition.wait(lock);
+            }
+
+            if (m_shouldQuit)
+            {
+                return;
+            }
+
+            Job job = std::move(m_pendingJobs.front());
+            m_pendingJobs.pop();
+
+            lock.unlock();
+
+            // Shader modules are cheap compared to pipelines. Make our own
+            // instead of sharing m_drawShaders with the render thread.
+            gpu::InterlockMode interlockMode =
+                job.pipelineLayout->interlockMode();
+            DrawShader drawShader(m_impl->vulkanContext(),
+                                  job.drawType,
+                                  interlockMode,
+                                  job.shaderFeatures,
+                                  job.shaderMiscFlags);
+            job.drawPipeline =
+                std::make_unique<DrawPipeline>(m_impl,
+                                               job.drawType,
+                                               *job.pipelineLayout,
+                                               drawShader,
+                                               job.shaderFeatures,
+                                               job.shaderMiscFlags,
+                                               DrawPipelineOptions::none,
+                                               job.vkRenderPass);
+
+            lock.lock();
+            m_finishedJobs.push_back(std::move(job));
+        }
+    }
+
+    RenderContextVulkanImpl* const m_impl;
+    std::queue<Job> m_pendingJobs;
+    std::vector<Job> m_finishedJobs;
+    std::mutex m_mutex;
+    std::condition_variable m_workAddedCondition;
+    bool m_shouldQuit = false;
+    std::thread m_compilerThread;
+};
+
+// Checks the header that Vulkan requires at the front of VkPipelineCache data,
+// so we don't hand the driver data that was saved by a different device or
+// driver version.
+static bool is_pipeline_cache_data_compatible(
+    Span<const uint8_t> data,
+    const VkPhysicalDeviceProperties& physicalDeviceProps)
+{
+    VkPipelineCacheHeaderVersionOne header;
+    if (data.size() < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    return header.headerSize >= sizeof(header) &&
+           header.headerSize <= data.size() &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == physicalDeviceProps.vendorID &&
+           header.deviceID == physicalDeviceProps.deviceID &&
+           memcmp(header.pipelineCacheUUID,
+                  physicalDeviceProps.pipelineCacheUUID,
+                  VK_UUID_SIZE) == 0;
+}
+
 RenderContextVulkanImpl::RenderContextVulkanImpl(
     rcp<VulkanContext> vk,
-    const VkPhysicalDeviceProperties& physicalDeviceProps) :
+    const VkPhysicalDeviceProperties& physicalDeviceProps,
+    const ContextOptions& contextOptions) :
     m_vk(std::move(vk)),
     m_vendorID(physicalDeviceProps.vendorID),
     m_atlasFormat(m_vk->isFormatSupportedWithFeatureFlags(
@@ -2109,6 +2265,22 @@ RenderContextVulkanImpl::RenderContextVulkanImpl(
             m_platformFeatures.supportsRasterOrdering = true;
             break;
     }
+
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+    };
+    if (is_pipeline_cache_data_compatible(contextOptions.pipelineCacheData,
+                                          physicalDeviceProps))
+    {
+        pipelineCacheCreateInfo.initialDataSize =
+            contextOptions.pipelineCacheData.size();
+        pipelineCacheCreateInfo.pInitialData =
+            contextOptions.pipelineCacheData.data();
+    }
+    VK_CHECK(m_vk->CreatePipelineCache(m_vk->device,
+                                       &pipelineCacheCreateInfo,
+                                       nullptr,
+                                       &m_pipelineCache));
 }
 
 void RenderContextVulkanImpl::initGPUObjects()
@@ -2454,6 +2626,9 @@ void RenderContextVulkanImpl::initGPUObjects()
 
 RenderContextVulkanImpl::~RenderContextVulkanImpl()
 {
+    // Join the background compiler before any of the objects it uses go away.
+    m_backgroundPipelineCompiler = nullptr;
+
     // These should all have gotten recycled at the end of the last frame.
     assert(m_flushUniformBuffer == nullptr);
     assert(m_imageDrawUniformBuffer == nullptr);
@@ -2485,6 +2660,7 @@ RenderContextVulkanImpl::~RenderContextVulkanImpl()
                                      nullptr);
     m_vk->DestroySampler(m_vk->device, m_mipmapSampler, nullptr);
     m_vk->DestroySampler(m_vk->device, m_linearSampler, nullptr);
+    m_vk->DestroyPipelineCache(m_vk->device, m_pipelineCache, nullptr);
 }
 
 void RenderContextVulkanImpl::resizeGradientTexture(uint32_t width,
@@ -2513,6 +2689,8 @@ void RenderContextVulkanImpl::resizeGradientTexture(uint32_t width,
             .height = height,
             .layers = 1,
         });
+
+        m_gradTextureLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     }
 }
 
@@ -2839,6 +3017,183 @@ vkutil::TextureView* RenderTargetVulkan::ensureDepthStencilTextureView()
     return m_depthStencilTextureView.get();
 }
 
+RenderContextVulkanImpl::DrawPipelineLayout& RenderContextVulkanImpl::
+    drawPipelineLayout(gpu::InterlockMode interlockMode,
+                       gpu::ShaderFeatures combinedShaderFeatures)
+{
+    auto pipelineLayoutOptions = DrawPipelineLayoutOptions::none;
+    if (interlockMode != gpu::InterlockMode::rasterOrdering &&
+        !(combinedShaderFeatures & gpu::ShaderFeatures::ENABLE_ADVANCED_BLEND))
+    {
+        pipelineLayoutOptions |=
+            DrawPipelineLayoutOptions::fixedFunctionColorOutput;
+    }
+
+    int pipelineLayoutIdx = (static_cast<int>(interlockMode)
+                             << kDrawPipelineLayoutOptionCount) |
+                            static_cast<int>(pipelineLayoutOptions);
+    assert(pipelineLayoutIdx < m_drawPipelineLayouts.size());
+    if (m_drawPipelineLayouts[pipelineLayoutIdx] == nullptr)
+    {
+        m_drawPipelineLayouts[pipelineLayoutIdx] =
+            std::make_unique<DrawPipelineLayout>(this,
+                                                 interlockMode,
+                                                 pipelineLayoutOptions);
+    }
+    return *m_drawPipelineLayouts[pipelineLayoutIdx];
+}
+
+std::vector<uint8_t> RenderContextVulkanImpl::pipelineCacheData() const
+{
+    size_t dataSize = 0;
+    VK_CHECK(m_vk->GetPipelineCacheData(m_vk->device,
+                                        m_pipelineCache,
+                                        &dataSize,
+                                        nullptr));
+    std::vector<uint8_t> data(dataSize);
+    // The background compiler may have grown the cache since we queried its
+    // size. In that case we get VK_INCOMPLETE, but what did get written is
+    // still valid cache data.
+    VkResult result = m_vk->GetPipelineCacheData(m_vk->device,
+                                                 m_pipelineCache,
+                                                 &dataSize,
+                                                 data.data());
+    if (result != VK_INCOMPLETE)
+    {
+        VK_CHECK(result);
+    }
+    data.resize(dataSize);
+    return data;
+}
+
+void RenderContextVulkanImpl::precompileDrawPipelines(
+    const gpu::FileDrawRequirements& requirements,
+    gpu::InterlockMode interlockMode,
+    VkFormat framebufferFormat)
+{
+    if ((interlockMode != gpu::InterlockMode::rasterOrdering &&
+         interlockMode != gpu::InterlockMode::atomics) ||
+        (framebufferFormat != VK_FORMAT_B8G8R8A8_UNORM &&
+         framebufferFormat != VK_FORMAT_R8G8B8A8_UNORM))
+    {
+        return; // flush() will create everything on demand.
+    }
+
+    StackVector<gpu::DrawType, 8> drawTypes;
+    drawTypes.push_back(gpu::DrawType::midpointFanPatches);
+    drawTypes.push_back(gpu::DrawType::outerCurvePatches);
+    drawTypes.push_back(gpu::DrawType::interiorTriangulation);
+    if (requirements.shaderFeatures & gpu::ShaderFeatures::ENABLE_FEATHER)
+    {
+        drawTypes.push_back(gpu::DrawType::midpointFanCenterAAPatches);
+        drawTypes.push_back(gpu::DrawType::atlasBlit);
+    }
+    if (requirements.drawsImages)
+    {
+        drawTypes.push_back(gpu::DrawType::imageMesh);
+        if (interlockMode == gpu::InterlockMode::atomics)
+        {
+            drawTypes.push_back(gpu::DrawType::imageRect);
+        }
+    }
+    if (interlockMode == gpu::InterlockMode::atomics)
+    {
+        drawTypes.push_back(gpu::DrawType::atomicResolve);
+    }
+
+    if (m_backgroundPipelineCompiler == nullptr)
+    {
+        m_backgroundPipelineCompiler =
+            std::make_unique<BackgroundPipelineCompiler>(this);
+    }
+
+    // A given flush or batch may only use some of the File's features, so
+    // compile every subset.
+    gpu::ShaderFeatures allShaderFeatures =
+        requirements.shaderFeatures &
+        gpu::ShaderFeaturesMaskFor(interlockMode);
+    uint32_t allFeatureBits = static_cast<uint32_t>(allShaderFeatures);
+    uint32_t featureBits = allFeatureBits;
+    do
+    {
+        auto combinedShaderFeatures =
+            static_cast<gpu::ShaderFeatures>(featureBits);
+        // Pipeline layouts and render passes aren't thread safe. Create them
+        // here on the render thread.
+        DrawPipelineLayout& pipelineLayout =
+            drawPipelineLayout(interlockMode, combinedShaderFeatures);
+        auto shaderMiscFlags = gpu::ShaderMiscFlags::none;
+        if (pipelineLayout.options() &
+            DrawPipelineLayoutOptions::fixedFunctionColorOutput)
+        {
+            shaderMiscFlags |= gpu::ShaderMiscFlags::fixedFunctionColorOutput;
+        }
+        for (uint32_t i = 0; i < drawTypes.size(); ++i)
+        {
+            gpu::DrawType drawType = drawTypes[i];
+            // Match the shader features that flush() will ask for.
+            gpu::ShaderFeatures shaderFeatures = combinedShaderFeatures;
+            if (interlockMode == gpu::InterlockMode::rasterOrdering)
+            {
+                shaderFeatures &=
+                    gpu::ShaderFeaturesMaskFor(drawType, interlockMode);
+                if (drawType == gpu::DrawType::interiorTriangulation ||
+                    drawType == gpu::DrawType::atlasBlit)
+                {
+                    shaderFeatures &= ~gpu::ShaderFeatures::ENABLE_FEATHER;
+                }
+            }
+            for (auto loadAction : {gpu::LoadAction::clear,
+                                    gpu::LoadAction::preserveRenderTarget,
+                                    gpu::LoadAction::dontCare})
+            {
+                int renderPassVariantIdx =
+                    DrawPipelineLayout::RenderPassVariantIdx(framebufferFormat,
+                                                             loadAction);
+                uint32_t pipelineKey =
+                    DrawPipeline::Key(drawType,
+                                      shaderFeatures,
+                                      interlockMode,
+                                      shaderMiscFlags,
+                                      DrawPipelineOptions::none,
+                                      renderPassVariantIdx);
+                if (m_drawPipelines.count(pipelineKey) ||
+                    !m_backgroundPipelineKeys.insert(pipelineKey).second)
+                {
+                    continue;
+                }
+                m_backgroundPipelineCompiler->pushJob({
+                    .pipelineKey = pipelineKey,
+                    .drawType = drawType,
+                    .pipelineLayout = &pipelineLayout,
+                    .shaderFeatures = shaderFeatures,
+                    .shaderMiscFlags = shaderMiscFlags,
+                    .vkRenderPass =
+                        pipelineLayout.renderPassAt(renderPassVariantIdx),
+                });
+            }
+        }
+        featureBits = (featureBits - 1) & allFeatureBits;
+    } while (featureBits != allFeatureBits);
+}
+
+void RenderContextVulkanImpl::collectBackgroundPipelines()
+{
+    if (m_backgroundPipelineCompiler == nullptr)
+    {
+        return;
+    }
+    BackgroundPipelineCompiler::Job job;
+    while (m_backgroundPipelineCompiler->popFinishedJob(&job))
+    {
+        m_backgroundPipelineKeys.erase(job.pipelineKey);
+        // If flush() already created this pipeline itself, the precompiled one
+        // is simply dropped.
+        m_drawPipelines.try_emplace(job.pipelineKey,
+                                    std::move(job.drawPipeline));
+    }
+}
+
 void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
 {
     constexpr static VkDeviceSize zeroOffset[1] = {0};
@@ -2849,6 +3204,8 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
         return;
     }
 
+    collectBackgroundPipelines();
+
     auto commandBuffer =
         reinterpret_cast<VkCommandBuffer>(desc.externalCommandBuffer);
     rcp<DescriptorSetPool> descriptorSetPool =
@@ -3017,9 +3374,12 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
         .pipelineStages = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
         .accessMask = VK_ACCESS_SHADER_READ_BIT,
         // Transition from an "UNDEFINED" layout because we don't care about
-        // preserving color ramp content from the previous frame.
+        // preserving tessellation or atlas content from the previous frame.
         .layout = VK_IMAGE_LAYOUT_UNDEFINED,
     };
+    // The gradient texture does need to be preserved, since complex color
+    // ramps stay cached in it across flushes.
+    lastGradTextureAccess.layout = m_gradTextureLayout;
 
     // Render the complex color ramps to the gradient texture.
     if (desc.gradSpanCount > 0)
@@ -3104,6 +3464,7 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
             .layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
         },
         *m_gradientTexture);
+    m_gradTextureLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
     // Tessellate all curves into vertices in the tessellation texture.
     if (desc.tessVertexSpanCount > 0)
@@ -3335,28 +3696,8 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
 
     auto* renderTarget = static_cast<RenderTargetVulkan*>(desc.renderTarget);
 
-    auto pipelineLayoutOptions = DrawPipelineLayoutOptions::none;
-    if (desc.interlockMode != gpu::InterlockMode::rasterOrdering &&
-        !(desc.combinedShaderFeatures &
-          gpu::ShaderFeatures::ENABLE_ADVANCED_BLEND))
-    {
-        pipelineLayoutOptions |=
-            DrawPipelineLayoutOptions::fixedFunctionColorOutput;
-    }
-
-    int pipelineLayoutIdx = (static_cast<int>(desc.interlockMode)
-                             << kDrawPipelineLayoutOptionCount) |
-                            static_cast<int>(pipelineLayoutOptions);
-    assert(pipelineLayoutIdx < m_drawPipelineLayouts.size());
-    if (m_drawPipelineLayouts[pipelineLayoutIdx] == nullptr)
-    {
-        m_drawPipelineLayouts[pipelineLayoutIdx] =
-            std::make_unique<DrawPipelineLayout>(this,
-                                                 desc.interlockMode,
-                                                 pipelineLayoutOptions);
-    }
     DrawPipelineLayout& pipelineLayout =
-        *m_drawPipelineLayouts[pipelineLayoutIdx];
+        drawPipelineLayout(desc.interlockMode, desc.combinedShaderFeatures);
     bool fixedFunctionColorOutput =
         pipelineLayout.options() &
         DrawPipelineLayoutOptions::fixedFunctionColorOutput;
@@ -3832,39 +4173,47 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
         {
             shaderMiscFlags |= gpu::ShaderMiscFlags::clockwiseFill;
         }
-        uint32_t pipelineKey = gpu::ShaderUniqueKey(drawType,
-                                                    shaderFeatures,
-                                                    desc.interlockMode,
-                                                    shaderMiscFlags);
         auto drawPipelineOptions = DrawPipelineOptions::none;
         if (desc.wireframe && m_vk->features.fillModeNonSolid)
         {
             drawPipelineOptions |= DrawPipelineOptions::wireframe;
         }
-        assert(pipelineKey << kDrawPipelineOptionCount >>
-                   kDrawPipelineOptionCount ==
-               pipelineKey);
-        pipelineKey = (pipelineKey << kDrawPipelineOptionCount) |
-                      static_cast<uint32_t>(drawPipelineOptions);
-        assert(pipelineKey * DrawPipelineLayout::kRenderPassVariantCount /
-                   DrawPipelineLayout::kRenderPassVariantCount ==
-               pipelineKey);
-        pipelineKey =
-            (pipelineKey * DrawPipelineLayout::kRenderPassVariantCount) +
-            renderPassVariantIdx;
-        const DrawPipeline& drawPipeline = m_drawPipelines
-                                               .try_emplace(pipelineKey,
-                                                            this,
-                                                            drawType,
-                                                            pipelineLayout,
-                                                            shaderFeatures,
-                                                            shaderMiscFlags,
-                                                            drawPipelineOptions,
-                                                            vkRenderPass)
-                                               .first->second;
+        uint32_t pipelineKey = DrawPipeline::Key(drawType,
+                                                 shaderFeatures,
+                                                 desc.interlockMode,
+                                                 shaderMiscFlags,
+                                                 drawPipelineOptions,
+                                                 renderPassVariantIdx);
+        std::unique_ptr<DrawPipeline>& drawPipeline =
+            m_drawPipelines[pipelineKey];
+        if (drawPipeline == nullptr)
+        {
+            // Not precompiled (or not finished yet). Create it now.
+            uint32_t shaderKey = gpu::ShaderUniqueKey(drawType,
+                                                      shaderFeatures,
+                                                      desc.interlockMode,
+                                                      shaderMiscFlags);
+            const DrawShader& drawShader =
+                m_drawShaders
+                    .try_emplace(shaderKey,
+                                 m_vk.get(),
+                                 drawType,
+                                 desc.interlockMode,
+                                 shaderFeatures,
+                                 shaderMiscFlags)
+                    .first->second;
+            drawPipeline = std::make_unique<DrawPipeline>(this,
+                                                          drawType,
+                                                          pipelineLayout,
+                                                          drawShader,
+                                                          shaderFeatures,
+                                                          shaderMiscFlags,
+                                                          drawPipelineOptions,
+                                                          vkRenderPass);
+        }
         m_vk->CmdBindPipeline(commandBuffer,
                               VK_PIPELINE_BIND_POINT_GRAPHICS,
-                              drawPipeline.vkPipeline());
+                              drawPipeline->vkPipeline());
 
         if (needsBarrierBeforeNextDraw &&
             drawType != gpu::DrawType::atomicResolve) // The atomic resolve gets
@@ -4161,7 +4510,10 @@ void RenderContextVulkanImpl::hotloadShaders(
     spirv::draw_clockwise_image_mesh_vert = readNextBytecodeSpan();
     spirv::draw_clockwise_image_mesh_frag = readNextBytecodeSpan();
 
-    // Delete and replace old shaders
+    // Delete and replace old shaders. In-flight background compiles are using
+    // the old ones, so throw those out too.
+    m_backgroundPipelineCompiler = nullptr;
+    m_backgroundPipelineKeys.clear();
     m_colorRampPipeline = std::make_unique<ColorRampPipeline>(this);
     m_tessellatePipeline = std::make_unique<TessellatePipeline>(this);
     m_atlasPipeline = std::make_unique<AtlasPipeline>(this);
@@ -4174,7 +4526,8 @@ std::unique_ptr<RenderContext> RenderContextVulkanImpl::MakeContext(
     VkPhysicalDevice physicalDevice,
     VkDevice device,
     const VulkanFeatures& features,
-    PFN_vkGetInstanceProcAddr pfnvkGetInstanceProcAddr)
+    PFN_vkGetInstanceProcAddr pfnvkGetInstanceProcAddr,
+    const ContextOptions& contextOptions)
 {
     rcp<VulkanContext> vk = make_rcp<VulkanContext>(instance,
                                                     physicalDevice,
@@ -4184,7 +4537,9 @@ std::unique_ptr<RenderContext> RenderContextVulkanImpl::MakeContext(
     VkPhysicalDeviceProperties physicalDeviceProps;
     vk->GetPhysicalDeviceProperties(vk->physicalDevice, &physicalDeviceProps);
     std::unique_ptr<RenderContextVulkanImpl> impl(
-        new RenderContextVulkanImpl(std::move(vk), physicalDeviceProps));
+        new RenderContextVulkanImpl(std::move(vk),
+                                    physicalDeviceProps,
+                                    contextOptions));
     if (!impl->platformFeatures().supportsRasterOrdering &&
         !impl->platformFeatures().supportsFragmentShaderAtomics)
     {
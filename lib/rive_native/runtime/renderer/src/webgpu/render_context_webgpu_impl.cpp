@@ -2342,7 +2342,7 @@ void RenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
     };
 
     // Render the complex color ramps to the gradient texture.
-    if (desc.gradDataHeight > 0)
+    if (desc.gradSpanCount > 0)
     {
         wgpu::BindGroupDescriptor colorRampBindGroupDesc = {
             .layout = m_colorRampPipeline->bindGroupLayout(),
@@ -2352,9 +2352,9 @@ void RenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
 
         wgpu::RenderPassColorAttachment attachment = {
             .view = m_gradientTextureView,
-            .loadOp = wgpu::LoadOp::Clear,
+            // Rows that aren't rendered this flush hold cached color ramps.
+            .loadOp = wgpu::LoadOp::Load,
             .storeOp = wgpu::StoreOp::Store,
-            .clearValue = {},
         };
 
         wgpu::RenderPassDescriptor gradPassDesc = {
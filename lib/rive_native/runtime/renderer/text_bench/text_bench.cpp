@@ -0,0 +1,212 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for the text pipeline. Shapes a long paragraph with the given
+// font, then times rebuilding its glyph outlines the way Text does every time
+// it needs new render styles, and reports the median time per glyph.
+//
+//   text_bench [-n frames] [--chars count] [--size points] <font.ttf>
+//
+// "getPath" extracts every outline from the font and transforms a copy of it.
+// "glyphPath" transforms the outlines from the font's glyph path cache
+// straight into the destination. "glyphPath+wght" does the same while cycling
+// through a few weights, as a variable font animation would.
+
+#include "rive/math/raw_path.hpp"
+#include "rive/text/font_hb.hpp"
+#include "rive/text_engine.hpp"
+#include "utils/bench_timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace rive;
+
+constexpr static char kLoremIpsum[] =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
+    "velit esse cillum dolore eu fugiat nulla pariatur. ";
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 100;
+    int charCount = 20000;
+    float fontSize = 16;
+    const char* fontPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--chars") && i + 1 < argc)
+        {
+            charCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+        {
+            fontSize = std::max(static_cast<float>(atof(argv[++i])), 1.f);
+        }
+        else if (argv[i][0] != '-' && fontPath == nullptr)
+        {
+            fontPath = argv[i];
+        }
+        else
+        {
+            fontPath = nullptr;
+            break;
+        }
+    }
+    if (fontPath == nullptr)
+    {
+        fprintf(stderr,
+                "usage: text_bench [-n frames] [--chars count] "
+                "[--size points] <font.ttf>\n");
+        return 1;
+    }
+
+    std::ifstream fontStream(fontPath, std::ios::binary);
+    std::vector<uint8_t> fontBytes(std::istreambuf_iterator<char>(fontStream),
+                                   {});
+    rcp<Font> font = HBFont::Decode(fontBytes);
+    if (font == nullptr)
+    {
+        fprintf(stderr, "failed to decode font: %s\n", fontPath);
+        return 1;
+    }
+
+    std::vector<Unichar> text;
+    text.reserve(charCount);
+    for (size_t i = 0; text.size() < static_cast<size_t>(charCount); ++i)
+    {
+        text.push_back(kLoremIpsum[i % (sizeof(kLoremIpsum) - 1)]);
+    }
+    TextRun run = {
+        font,
+        fontSize,
+        -1.0f,
+        0.0f,
+        static_cast<uint32_t>(text.size()),
+        0,
+        0,
+        0,
+    };
+    SimpleArray<Paragraph> paragraphs =
+        font->shapeText(text, Span<const TextRun>(&run, 1));
+
+    // Lay the glyphs out in 600pt lines.
+    struct PlacedGlyph
+    {
+        GlyphID glyphId;
+        Vec2D position;
+    };
+    std::vector<PlacedGlyph> glyphs;
+    Vec2D pen = {0, 0};
+    for (const Paragraph& paragraph : paragraphs)
+    {
+        for (const GlyphRun& glyphRun : paragraph.runs)
+        {
+            for (size_t i = 0; i < glyphRun.glyphs.size(); ++i)
+            {
+                if (pen.x + glyphRun.advances[i] > 600)
+                {
+                    pen = {0, pen.y + fontSize * 1.2f};
+                }
+                glyphs.push_back({glyphRun.glyphs[i],
+                                  pen + glyphRun.offsets[i]});
+                pen.x += glyphRun.advances[i];
+            }
+        }
+    }
+    if (glyphs.empty())
+    {
+        fprintf(stderr, "no glyphs shaped\n");
+        return 1;
+    }
+
+    printf("%zu glyphs, %i frames, %gpt\n", glyphs.size(), frameCount, fontSize);
+    printf("%-16s %12s %10s\n", "mode", "ns/glyph", "hit rate");
+
+    RawPath stylePath;
+    auto glyphMatrix = [fontSize](const PlacedGlyph& glyph) {
+        return Mat2D(fontSize,
+                     0.0f,
+                     0.0f,
+                     fontSize,
+                     glyph.position.x,
+                     glyph.position.y);
+    };
+
+    double getPathTime =
+        time_frames<std::nano>(frameCount, glyphs.size(), [&](int) {
+            stylePath.rewind();
+            for (const PlacedGlyph& glyph : glyphs)
+            {
+                RawPath path = font->getPath(glyph.glyphId);
+                path.transformInPlace(glyphMatrix(glyph));
+                stylePath.addPath(path);
+            }
+        });
+    printf("%-16s %12.2f %10s\n", "getPath", getPathTime, "-");
+
+    auto hitRate = [](const GlyphPathCache::Stats& before,
+                      const GlyphPathCache::Stats& after) {
+        size_t hits = after.hitCount - before.hitCount;
+        size_t misses = after.missCount - before.missCount;
+        return 100.0 * hits / std::max<size_t>(hits + misses, 1);
+    };
+
+    GlyphPathCache::Stats statsBefore = font->glyphPathCacheStats();
+    double glyphPathTime =
+        time_frames<std::nano>(frameCount, glyphs.size(), [&](int) {
+            stylePath.rewind();
+            for (const PlacedGlyph& glyph : glyphs)
+            {
+                Mat2D matrix = glyphMatrix(glyph);
+                stylePath.addPath(font->glyphPath(glyph.glyphId)->rawPath(),
+                                  &matrix);
+            }
+        });
+    printf("%-16s %12.2f %9.1f%%\n",
+           "glyphPath",
+           glyphPathTime,
+           hitRate(statsBefore, font->glyphPathCacheStats()));
+
+    // Each frame makes a new variation, like TextStyle does when its axes are
+    // animated. The variations share their base font's cache.
+    constexpr static float kWeights[] = {300, 400, 500, 600, 700};
+    constexpr static uint32_t kWeightTag = 0x77676874; // 'wght'
+    statsBefore = font->glyphPathCacheStats();
+    double variationTime =
+        time_frames<std::nano>(frameCount, glyphs.size(), [&](int f) {
+            float weight = kWeights[f % (sizeof(kWeights) / sizeof(*kWeights))];
+            rcp<Font> variableFont = font->makeAtCoord({kWeightTag, weight});
+            stylePath.rewind();
+            for (const PlacedGlyph& glyph : glyphs)
+            {
+                Mat2D matrix = glyphMatrix(glyph);
+                stylePath.addPath(
+                    variableFont->glyphPath(glyph.glyphId)->rawPath(),
+                    &matrix);
+            }
+        });
+    GlyphPathCache::Stats stats = font->glyphPathCacheStats();
+    printf("%-16s %12.2f %9.1f%%\n",
+           "glyphPath+wght",
+           variationTime,
+           hitRate(statsBefore, stats));
+    printf("cache: %zu outlines, %zu bytes, %zu evictions\n",
+           stats.entryCount,
+           stats.byteCount,
+           stats.evictionCount);
+    return 0;
+}
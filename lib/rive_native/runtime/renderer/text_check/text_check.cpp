@@ -0,0 +1,372 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Self-checking test for the Text update paths that only run on request.
+// Imports a .riv file and compares artboard instances updated through them
+// against instances updated the plain serial way. Prints every check and
+// exits with 1 if any of them failed.
+//
+//   text_check <file.riv>
+//
+// The file's default artboard needs at least two Text components with runs
+// and no modifier groups, for example test/assets/follow_path_path.riv.
+//
+// "prepared shapes": Text that needs shaping is shaped through the artboard's
+// update scheduler ahead of the update pass. The update must use those shapes
+// when the text didn't change in between, and reshape when it did.
+//
+// "batched modifiers": GlyphTransformBatch must give the same transforms and
+// opacities as applying each TextModifierGroup one glyph at a time, for every
+// combination of modifier flags. Doesn't use the file.
+
+#include "rive/artboard.hpp"
+#include "rive/component_update_scheduler.hpp"
+#include "rive/file.hpp"
+#include "rive/text/glyph_transform_batch.hpp"
+#include "rive/text/text.hpp"
+#include "rive/text/text_modifier_flags.hpp"
+#include "rive/text/text_modifier_group.hpp"
+#include "rive/text/text_value_run.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/self_check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace rive;
+
+// Runs every batch on the calling thread, back to front so nothing relies on
+// the order items run in, then calls afterBatch once.
+class CheckScheduler : public ComponentUpdateScheduler
+{
+public:
+    std::function<void()> afterBatch;
+
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)>& work) override
+    {
+        for (size_t i = count; i-- > 0;)
+        {
+            work(i);
+        }
+        if (afterBatch != nullptr)
+        {
+            auto callback = std::move(afterBatch);
+            afterBatch = nullptr;
+            callback();
+        }
+    }
+};
+
+static std::vector<Text*> texts_of(Artboard* artboard)
+{
+    std::vector<Text*> texts;
+    for (auto object : artboard->objects())
+    {
+        // Text with modifier groups shapes during update.
+        if (object != nullptr && object->is<Text>() &&
+            !object->as<Text>()->runs().empty() &&
+            !object->as<Text>()->haveModifiers())
+        {
+            texts.push_back(object->as<Text>());
+        }
+    }
+    return texts;
+}
+
+static void append_to_runs(const std::vector<Text*>& texts,
+                           const std::string& suffix)
+{
+    for (auto text : texts)
+    {
+        for (auto run : text->runs())
+        {
+            run->text(run->text() + suffix);
+        }
+    }
+}
+
+static size_t glyph_count(const Text* text)
+{
+    size_t count = 0;
+    for (const Paragraph& paragraph : text->shape())
+    {
+        for (const GlyphRun& run : paragraph.runs)
+        {
+            count += run.glyphs.size();
+        }
+    }
+    return count;
+}
+
+static bool same_layout(const std::vector<Text*>& a,
+                        const std::vector<Text*>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        AABB boundsA = a[i]->localBounds();
+        AABB boundsB = b[i]->localBounds();
+        if (glyph_count(a[i]) != glyph_count(b[i]) ||
+            boundsA.minX != boundsB.minX || boundsA.minY != boundsB.minY ||
+            boundsA.maxX != boundsB.maxX || boundsA.maxY != boundsB.maxY)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool none_prepared(const std::vector<Text*>& texts)
+{
+    for (auto text : texts)
+    {
+        if (text->hasPreparedShape())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void check_prepared_shapes(File* file)
+{
+    std::unique_ptr<ArtboardInstance> serial = file->artboardDefault();
+    std::unique_ptr<ArtboardInstance> scheduled = file->artboardDefault();
+    CheckScheduler scheduler;
+    scheduled->updateScheduler(&scheduler);
+    serial->advance(0.0f);
+    scheduled->advance(0.0f);
+
+    std::vector<Text*> serialTexts = texts_of(serial.get());
+    std::vector<Text*> scheduledTexts = texts_of(scheduled.get());
+    if (scheduledTexts.size() < 2)
+    {
+        check("prepared shapes: two Text with runs", false);
+        return;
+    }
+    check("prepared shapes: initial layout",
+          same_layout(serialTexts, scheduledTexts));
+
+    // Edited text is shaped ahead and the update uses it.
+    append_to_runs(serialTexts, " edited");
+    append_to_runs(scheduledTexts, " edited");
+    bool allPrepared = false;
+    scheduler.afterBatch = [&]() {
+        allPrepared = true;
+        for (auto text : scheduledTexts)
+        {
+            allPrepared = allPrepared && text->hasPreparedShape();
+        }
+    };
+    serial->advance(0.0f);
+    scheduled->advance(0.0f);
+    check("prepared shapes: shaped ahead", allPrepared);
+    check("prepared shapes: consumed", none_prepared(scheduledTexts));
+    check("prepared shapes: used", same_layout(serialTexts, scheduledTexts));
+
+    // A run that changes after its Text was shaped ahead must not keep the
+    // stale shape.
+    append_to_runs(serialTexts, " again");
+    append_to_runs(scheduledTexts, " again");
+    const std::string late = "changed after the shape was prepared";
+    serialTexts[0]->runs()[0]->text(late);
+    scheduler.afterBatch = [&]() { scheduledTexts[0]->runs()[0]->text(late); };
+    serial->advance(0.0f);
+    scheduled->advance(0.0f);
+    check("prepared shapes: consumed after change",
+          none_prepared(scheduledTexts));
+    check("prepared shapes: rejected",
+          same_layout(serialTexts, scheduledTexts));
+}
+
+// A modifier group that isn't parented to a Text, so its properties can be set
+// directly.
+class UnparentedModifierGroup : public TextModifierGroup
+{
+protected:
+    void modifierFlagsChanged() override {}
+    void originXChanged() override {}
+    void originYChanged() override {}
+    void opacityChanged() override {}
+    void xChanged() override {}
+    void yChanged() override {}
+    void rotationChanged() override {}
+    void scaleXChanged() override {}
+    void scaleYChanged() override {}
+};
+
+struct CheckGlyph
+{
+    Mat2D transform;
+    Vec2D translation;
+    float centerX;
+    uint32_t textIndex;
+    uint32_t codePointCount;
+};
+
+static bool nearly_equal(const Mat2D& a, const Mat2D& b)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        if (std::abs(a[i] - b[i]) > 1e-4f * std::max(1.0f, std::abs(b[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void check_batched_modifiers()
+{
+    constexpr static TextModifierFlags kFlags[] = {
+        TextModifierFlags::modifyOrigin,
+        TextModifierFlags::modifyTranslation,
+        TextModifierFlags::modifyRotation,
+        TextModifierFlags::modifyScale,
+        TextModifierFlags::modifyOpacity,
+        TextModifierFlags::invertOpacity,
+    };
+    constexpr static uint32_t kTextSize = 16;
+
+    // 13 glyphs, so the last group of four is padded. Some glyphs span more
+    // than one code point.
+    std::vector<CheckGlyph> glyphs;
+    for (uint32_t i = 0; i < 13; i++)
+    {
+        float size = 10.0f + i;
+        float centerX = .5f * i;
+        glyphs.push_back({Mat2D(size, 0.0f, 0.0f, size, -centerX, 0.0f),
+                          Vec2D(12.0f * i, 20.0f * (i % 3)),
+                          centerX,
+                          i,
+                          1 + i % 3});
+    }
+
+    // Coverage of 0, .25, .5, .75 and 1, so some glyphs are masked out.
+    std::vector<float> coverage(kTextSize);
+    for (uint32_t i = 0; i < kTextSize; i++)
+    {
+        coverage[i] = (i % 5) * .25f;
+    }
+    UnparentedModifierGroup groups[2];
+    groups[0].coverage(coverage);
+    groups[0].x(3.0f);
+    groups[0].y(-2.0f);
+    groups[0].rotation(.7f);
+    groups[0].scaleX(1.5f);
+    groups[0].scaleY(.5f);
+    groups[0].originX(4.0f);
+    groups[0].originY(-6.0f);
+    groups[0].opacity(.3f);
+    std::reverse(coverage.begin(), coverage.end());
+    groups[1].coverage(coverage);
+    groups[1].x(-5.0f);
+    groups[1].y(7.0f);
+    groups[1].rotation(-1.9f);
+    groups[1].scaleX(.25f);
+    groups[1].scaleY(2.0f);
+    groups[1].originX(-1.0f);
+    groups[1].originY(2.5f);
+    groups[1].opacity(.8f);
+
+    // Fill the padding with glyphs that the batch has to ignore after clear().
+    GlyphTransformBatch batch;
+    for (uint32_t i = 0; i < kTextSize; i++)
+    {
+        batch.add(Mat2D(), Vec2D(), 1.0f, 0, 1);
+    }
+
+    bool transformsMatch = true;
+    bool opacitiesMatch = true;
+    const SimpleArray<GlyphLine> noLines;
+    for (uint32_t combination = 0; combination < 1u << 6; combination++)
+    {
+        uint32_t flags = 0;
+        for (uint32_t bit = 0; bit < 6; bit++)
+        {
+            if (combination & (1u << bit))
+            {
+                flags |= static_cast<uint32_t>(kFlags[bit]);
+            }
+        }
+        // The second group uses the complementary flags, so every flag is
+        // also checked on top of another group's transform.
+        groups[0].modifierFlags(flags);
+        groups[1].modifierFlags(~flags & 0x7d);
+
+        batch.clear();
+        for (const CheckGlyph& glyph : glyphs)
+        {
+            batch.add(glyph.transform,
+                      glyph.translation,
+                      1.0f,
+                      glyph.textIndex,
+                      glyph.codePointCount);
+        }
+        for (UnparentedModifierGroup& group : groups)
+        {
+            batch.applyModifierGroup(group);
+        }
+
+        for (size_t i = 0; i < glyphs.size(); i++)
+        {
+            const CheckGlyph& glyph = glyphs[i];
+            Mat2D transform = glyph.transform;
+            float opacity = 1.0f;
+            for (UnparentedModifierGroup& group : groups)
+            {
+                float amount =
+                    group.glyphCoverage(glyph.textIndex, glyph.codePointCount);
+                TransformGlyphArg arg = {Vec2D(), glyph.centerX, 0, noLines};
+                group.transform(amount, transform, arg);
+                if (group.modifiesOpacity())
+                {
+                    opacity = group.computeOpacity(opacity, amount);
+                }
+            }
+            transform[4] += glyph.translation.x;
+            transform[5] += glyph.translation.y;
+            transformsMatch =
+                transformsMatch && nearly_equal(batch.transform(i), transform);
+            opacitiesMatch =
+                opacitiesMatch && std::abs(batch.opacity(i) - opacity) < 1e-6f;
+        }
+    }
+    check("batched modifiers: transforms", transformsMatch);
+    check("batched modifiers: opacities", opacitiesMatch);
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: text_check <file.riv>\n");
+        return 1;
+    }
+
+    std::ifstream rivStream(argv[1], std::ios::binary);
+    std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(rivStream),
+                                  {});
+    NoOpFactory factory;
+    std::unique_ptr<File> file = File::import(rivBytes, &factory);
+    if (file == nullptr || file->artboard() == nullptr)
+    {
+        fprintf(stderr, "failed to import: %s\n", argv[1]);
+        return 1;
+    }
+
+    check_prepared_shapes(file.get());
+    check_batched_modifiers();
+    return check_exit_status();
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Micro-benchmark for the interior triangulation cache. Draws large filled
+// paths, which get an interior triangulation, through the CPU backend and
+// times recording the draws of each frame (where the triangulator runs), with
+// the cache enabled and disabled, and reports the median time per frame.
+//
+//   triangulation_bench [-n frames] [--paths count] [--points count]
+//
+// "static" draws the same paths with the same matrices every frame, so after
+// the first frame every triangulation comes from the cache. "moving" changes
+// every matrix every frame, so nothing can be reused and the numbers show what
+// the cache costs when it misses. The flush isn't timed: the rasterization it
+// does is the same in both modes.
+
+#include "rive/renderer/cpu/render_context_cpu_impl.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/math/math_types.hpp"
+#include "rive/math/raw_path.hpp"
+#include "utils/bench_timer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Small, so rasterizing the clipped paths in the untimed flush stays cheap.
+// Interior triangulation depends on the paths' transformed area, not on what
+// is visible.
+static constexpr uint32_t kWidth = 256;
+static constexpr uint32_t kHeight = 256;
+
+// A wavy star with pointCount cubic spikes, about 800px across.
+static RawPath make_star(int pointCount, float phase)
+{
+    RawPath rawPath;
+    constexpr float kOuterRadius = 400;
+    constexpr float kInnerRadius = 280;
+    auto point = [&](float angle, float radius) {
+        return Vec2D(std::cos(angle) * radius, std::sin(angle) * radius);
+    };
+    float step = 2 * math::PI / pointCount;
+    rawPath.move(point(phase, kInnerRadius));
+    for (int i = 0; i < pointCount; ++i)
+    {
+        float angle = phase + i * step;
+        rawPath.cubic(point(angle + step * .25f, kOuterRadius),
+                      point(angle + step * .5f, kOuterRadius),
+                      point(angle + step, kInnerRadius));
+    }
+    rawPath.close();
+    return rawPath;
+}
+
+int main(int argc, const char** argv)
+{
+    int frameCount = 20;
+    int pathCount = 16;
+    int pointCount = 64;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            frameCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--paths") && i + 1 < argc)
+        {
+            pathCount = std::max(atoi(argv[++i]), 1);
+        }
+        else if (!strcmp(argv[i], "--points") && i + 1 < argc)
+        {
+            // Interior triangulation is only used for paths with fewer than
+            // 1000 verbs.
+            pointCount = std::clamp(atoi(argv[++i]), 3, 900);
+        }
+        else
+        {
+            fprintf(stderr,
+                    "usage: triangulation_bench [-n frames] [--paths count] "
+                    "[--points count]\n");
+            return 1;
+        }
+    }
+
+    std::unique_ptr<RenderContext> context =
+        RenderContextCPUImpl::MakeContext({});
+    rcp<RenderTargetCPU> renderTarget =
+        make_rcp<RenderTargetCPU>(kWidth, kHeight);
+    std::vector<rcp<RenderPath>> paths;
+    for (int i = 0; i < pathCount; ++i)
+    {
+        RawPath star = make_star(pointCount, i * .1f);
+        paths.push_back(context->makeRenderPath(star, FillRule::nonZero));
+    }
+    rcp<RenderPaint> paint = context->makeRenderPaint();
+    paint->color(0x20ff8000);
+
+    printf("%i frames of %i paths with %i points\n",
+           frameCount,
+           pathCount,
+           pointCount);
+    printf("%-8s %-6s %12s %8s %8s\n",
+           "mode",
+           "cache",
+           "us/frame",
+           "hits",
+           "misses");
+
+    for (bool moving : {false, true})
+    {
+        for (bool cached : {true, false})
+        {
+            context->setTriangulationCacheCapacity(
+                cached ? std::max<size_t>(pathCount, 64) : 0);
+            RenderContext::TriangulationCacheStats before =
+                context->triangulationCacheStats();
+            double frameTime =
+                time_frames<std::micro>(frameCount, 1, [&](int frame) {
+                    RenderContext::FrameDescriptor frameDescriptor;
+                    frameDescriptor.renderTargetWidth = kWidth;
+                    frameDescriptor.renderTargetHeight = kHeight;
+                    frameDescriptor.loadAction = LoadAction::clear;
+                    context->beginFrame(frameDescriptor);
+                    RiveRenderer renderer(context.get());
+
+                    auto start = std::chrono::steady_clock::now();
+                    for (int i = 0; i < pathCount; ++i)
+                    {
+                        // Moving paths never draw with the same matrix twice.
+                        float offset = moving ? frame * .25f + i : i;
+                        renderer.save();
+                        renderer.translate(kWidth / 2 + offset, kHeight / 2);
+                        renderer.drawPath(paths[i].get(), paint.get());
+                        renderer.restore();
+                    }
+                    auto elapsed = std::chrono::steady_clock::now() - start;
+
+                    context->flush({.renderTarget = renderTarget.get()});
+                    return elapsed;
+                });
+            RenderContext::TriangulationCacheStats after =
+                context->triangulationCacheStats();
+            printf("%-8s %-6s %12.2f %8zu %8zu\n",
+                   moving ? "moving" : "static",
+                   cached ? "on" : "off",
+                   frameTime,
+                   after.hitCount - before.hitCount,
+                   after.missCount - before.missCount);
+        }
+    }
+    return 0;
+}
@@ -9,6 +9,14 @@ float CubicEaseInterpolator::transformValue(float valueFrom,
     return valueFrom + (valueTo - valueFrom) * transform(factor);
 }
 
+float CubicEaseInterpolator::transformValueForT(float valueFrom,
+                                                float valueTo,
+                                                float t)
+{
+    float eased = CubicInterpolatorSolver::calcBezier(t, y1(), y2());
+    return valueFrom + (valueTo - valueFrom) * eased;
+}
+
 float CubicEaseInterpolator::transform(float factor) const
 {
     return CubicInterpolatorSolver::calcBezier(m_solver.getT(factor),
@@ -0,0 +1,60 @@
+#include "rive/animation/cubic_interpolation_batch.hpp"
+#include "rive/animation/cubic_interpolator.hpp"
+#include "rive/animation/keyframe_double.hpp"
+
+using namespace rive;
+
+bool CubicInterpolationBatch::add(Core* object,
+                                  int propertyKey,
+                                  float seconds,
+                                  const KeyFrame* fromFrame,
+                                  const KeyFrame* toFrame,
+                                  float mix)
+{
+    if (fromFrame->coreType() != KeyFrameDoubleBase::typeKey)
+    {
+        return false;
+    }
+    auto from = fromFrame->as<KeyFrameDouble>();
+    auto interpolator = from->interpolator();
+    if (interpolator == nullptr || !interpolator->is<CubicInterpolator>())
+    {
+        return false;
+    }
+    auto to = toFrame->as<KeyFrameDouble>();
+    auto cubic = interpolator->as<CubicInterpolator>();
+    m_entries.push_back(
+        {object, propertyKey, mix, from->value(), to->value(), cubic});
+    m_solvers.push_back(&cubic->solver());
+    // Same factor KeyFrameDouble::applyInterpolation computes.
+    m_factors.push_back((seconds - from->seconds()) /
+                        (to->seconds() - from->seconds()));
+    return true;
+}
+
+void CubicInterpolationBatch::apply()
+{
+    if (m_entries.empty())
+    {
+        return;
+    }
+    m_ts.resize(m_entries.size());
+    CubicInterpolatorSolver::getTBatch(m_solvers.data(),
+                                       m_factors.data(),
+                                       m_ts.data(),
+                                       m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        const Entry& entry = m_entries[i];
+        KeyFrameDouble::applyValue(
+            entry.object,
+            entry.propertyKey,
+            entry.mix,
+            entry.interpolator->transformValueForT(entry.valueFrom,
+                                                   entry.valueTo,
+                                                   m_ts[i]));
+    }
+    m_entries.clear();
+    m_solvers.clear();
+    m_factors.clear();
+}
@@ -1,4 +1,6 @@
 #include "rive/animation/cubic_interpolator_solver.hpp"
+#include "rive/math/simd.hpp"
+#include <array>
 #include <cmath>
 
 using namespace rive;
@@ -8,8 +10,8 @@ const float NewtonMinSlope = 0.001f;
 const float SubdivisionPrecision = 0.0000001f;
 const int SubdivisionMaxIterations = 10;
 
-// Returns x(t) given t, x1, and x2, or y(t) given t, y1, and y2.
-float CubicInterpolatorSolver::calcBezier(float aT, float aA1, float aA2)
+// The scalar and batched solvers share these so both round identically.
+template <typename T> static T bezier(T aT, T aA1, T aA2)
 {
     return (((1.0f - 3.0f * aA2 + 3.0f * aA1) * aT +
              (3.0f * aA2 - 6.0f * aA1)) *
@@ -18,20 +20,36 @@ float CubicInterpolatorSolver::calcBezier(float aT, float aA1, float aA2)
            aT;
 }
 
-// Returns dx/dt given t, x1, and x2, or dy/dt given t, y1, and y2.
-static float getSlope(float aT, float aA1, float aA2)
+template <typename T> static T slope(T aT, T aA1, T aA2)
 {
     return 3.0f * (1.0f - 3.0f * aA2 + 3.0f * aA1) * aT * aT +
            2.0f * (3.0f * aA2 - 6.0f * aA1) * aT + (3.0f * aA1);
 }
 
+// Returns x(t) given t, x1, and x2, or y(t) given t, y1, and y2.
+float CubicInterpolatorSolver::calcBezier(float aT, float aA1, float aA2)
+{
+    return bezier(aT, aA1, aA2);
+}
+
+// Returns dx/dt given t, x1, and x2, or dy/dt given t, y1, and y2.
+static float getSlope(float aT, float aA1, float aA2)
+{
+    return slope(aT, aA1, aA2);
+}
+
 void CubicInterpolatorSolver::build(float x1, float x2)
 {
     m_x1 = x1;
     m_x2 = x2;
+    m_isMonotonic = true;
     for (int i = 0; i < SplineTableSize; ++i)
     {
         m_values[i] = calcBezier(i * SampleStepSize, x1, x2);
+        if (i > 0 && m_values[i] < m_values[i - 1])
+        {
+            m_isMonotonic = false;
+        }
     }
 }
 
@@ -74,23 +92,131 @@ float CubicInterpolatorSolver::getT(float x) const
     }
     else
     {
-        float aB = intervalStart + SampleStepSize;
-        float currentX, currentT;
-        int i = 0;
-        do
+        return bisect(x, intervalStart);
+    }
+}
+
+float CubicInterpolatorSolver::bisect(float x, float intervalStart) const
+{
+    float aB = intervalStart + SampleStepSize;
+    float currentX, currentT;
+    int i = 0;
+    do
+    {
+        currentT = intervalStart + (aB - intervalStart) / 2.0f;
+        currentX = calcBezier(currentT, m_x1, m_x2) - x;
+        if (currentX > 0.0f)
+        {
+            aB = currentT;
+        }
+        else
+        {
+            intervalStart = currentT;
+        }
+    } while (std::abs(currentX) > SubdivisionPrecision &&
+             ++i < SubdivisionMaxIterations);
+    return currentT;
+}
+
+void CubicInterpolatorSolver::getT4(
+    const CubicInterpolatorSolver* const* solvers,
+    const float* xs,
+    float* ts)
+{
+    // getT accumulates the interval start one step at a time, precompute the
+    // same sums so the batched search can index them.
+    static const std::array<float, SplineTableSize - 1> starts = [] {
+        std::array<float, SplineTableSize - 1> values;
+        float start = 0.0f;
+        for (float& value : values)
         {
-            currentT = intervalStart + (aB - intervalStart) / 2.0f;
-            currentX = calcBezier(currentT, m_x1, m_x2) - x;
-            if (currentX > 0.0f)
+            value = start;
+            start += SampleStepSize;
+        }
+        return values;
+    }();
+
+    float4 x = simd::load4f(xs);
+    float4 x1, x2, sampleFrom, sampleTo, intervalStart;
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        const CubicInterpolatorSolver* solver = solvers[lane];
+        float laneX = xs[lane];
+        // Branch-free table search: the index of the interval x falls in is
+        // the number of interior samples <= x, since the table is sorted.
+        int sample = 0;
+        for (int i = 1; i < SplineTableSize - 1; ++i)
+        {
+            sample += solver->m_values[i] <= laneX;
+        }
+        x1[lane] = solver->m_x1;
+        x2[lane] = solver->m_x2;
+        sampleFrom[lane] = solver->m_values[sample];
+        sampleTo[lane] = solver->m_values[sample + 1];
+        intervalStart[lane] = starts[sample];
+    }
+
+    // Interpolate to provide an initial guess for t
+    float4 dist = (x - sampleFrom) / (sampleTo - sampleFrom);
+    float4 guessForT = intervalStart + dist * SampleStepSize;
+
+    float4 initialSlope = slope(guessForT, x1, x2);
+    int4 newton = initialSlope >= NewtonMinSlope;
+    int4 active = newton;
+    for (int i = 0; i < NewtonIterations; ++i)
+    {
+        float4 currentSlope = slope(guessForT, x1, x2);
+        active &= currentSlope != 0.0f;
+        float4 currentX = bezier(guessForT, x1, x2) - x;
+        guessForT = simd::if_then_else(active,
+                                       guessForT - currentX / currentSlope,
+                                       guessForT);
+    }
+    simd::store(ts, guessForT);
+
+    // Shallow slopes are rare, finish them one at a time.
+    int4 subdivide = ~newton & (initialSlope != 0.0f);
+    if (simd::any(subdivide))
+    {
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if (subdivide[lane])
             {
-                aB = currentT;
+                ts[lane] =
+                    solvers[lane]->bisect(xs[lane], intervalStart[lane]);
             }
-            else
+        }
+    }
+}
+
+void CubicInterpolatorSolver::getTBatch(
+    const CubicInterpolatorSolver* const* solvers,
+    const float* xs,
+    float* ts,
+    size_t count)
+{
+    size_t i = 0;
+#if defined(__clang__)
+    // Without clang's vector extensions simd is a scalar polyfill, which is
+    // slower than solving each value with getT.
+    for (; i + 4 <= count; i += 4)
+    {
+        if (solvers[i]->m_isMonotonic && solvers[i + 1]->m_isMonotonic &&
+            solvers[i + 2]->m_isMonotonic && solvers[i + 3]->m_isMonotonic)
+        {
+            getT4(solvers + i, xs + i, ts + i);
+        }
+        else
+        {
+            for (size_t j = i; j < i + 4; ++j)
             {
-                intervalStart = currentT;
+                ts[j] = solvers[j]->getT(xs[j]);
             }
-        } while (std::abs(currentX) > SubdivisionPrecision &&
-                 ++i < SubdivisionMaxIterations);
-        return currentT;
+        }
     }
-}
\ No newline at end of file
+#endif
+    for (; i < count; ++i)
+    {
+        ts[i] = solvers[i]->getT(xs[i]);
+    }
+}
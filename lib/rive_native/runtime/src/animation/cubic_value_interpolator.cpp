@@ -22,6 +22,13 @@ void CubicValueInterpolator::computeParameters()
 float CubicValueInterpolator::transformValue(float valueFrom,
                                              float valueTo,
                                              float factor)
+{
+    return transformValueForT(valueFrom, valueTo, m_solver.getT(factor));
+}
+
+float CubicValueInterpolator::transformValueForT(float valueFrom,
+                                                 float valueTo,
+                                                 float t)
 {
     if (m_D != valueFrom || m_ValueTo != valueTo)
     {
@@ -29,7 +36,6 @@ float CubicValueInterpolator::transformValue(float valueFrom,
         m_ValueTo = valueTo;
         computeParameters();
     }
-    float t = m_solver.getT(factor);
     return ((m_A * t + m_B) * t + m_C) * t + m_D;
 }
 
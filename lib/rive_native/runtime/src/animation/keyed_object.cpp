@@ -73,20 +73,30 @@ void KeyedObject::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
     }
 }
 
-void KeyedObject::apply(Artboard* artboard, float time, float mix)
+void KeyedObject::apply(Artboard* artboard,
+                        float time,
+                        float mix,
+                        CubicInterpolationBatch* batch,
+                        uint32_t* keyFrameCursors)
 {
     Core* object = artboard->resolve(objectId());
     if (object == nullptr)
     {
         return;
     }
-    for (std::unique_ptr<KeyedProperty>& property : m_keyedProperties)
+    for (size_t i = 0; i < m_keyedProperties.size(); i++)
     {
+        auto& property = m_keyedProperties[i];
         if (CoreRegistry::isCallback(property->propertyKey()))
         {
             continue;
         }
-        property->apply(object, time, mix);
+        property->apply(object,
+                        time,
+                        mix,
+                        batch,
+                        keyFrameCursors == nullptr ? nullptr
+                                                   : keyFrameCursors + i);
     }
 }
 
@@ -1,4 +1,5 @@
 #include "rive/animation/keyed_property.hpp"
+#include "rive/animation/cubic_interpolation_batch.hpp"
 #include "rive/animation/keyed_object.hpp"
 #include "rive/animation/keyframe.hpp"
 #include "rive/animation/keyframe_interpolator.hpp"
@@ -6,6 +7,7 @@
 #include "rive/animation/keyed_callback_reporter.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/keyed_object_importer.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -14,6 +16,7 @@ KeyedProperty::~KeyedProperty() {}
 
 void KeyedProperty::addKeyFrame(std::unique_ptr<KeyFrame> keyframe)
 {
+    m_keyFrameSeconds.push_back(keyframe->seconds());
     m_keyFrames.push_back(std::move(keyframe));
 }
 
@@ -22,11 +25,11 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     int mid = 0;
     float closestSeconds = 0;
     int start = 0;
-    auto numKeyFrames = static_cast<int>(m_keyFrames.size());
+    auto numKeyFrames = static_cast<int>(m_keyFrameSeconds.size());
     int end = numKeyFrames - 1;
 
     // If it's the last keyframe, we skip the binary search
-    if (seconds > m_keyFrames[end]->seconds())
+    if (seconds > m_keyFrameSeconds[end])
     {
         return end + 1;
     }
@@ -34,7 +37,7 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     while (start <= end)
     {
         mid = (start + end) >> 1;
-        closestSeconds = m_keyFrames[mid]->seconds();
+        closestSeconds = m_keyFrameSeconds[mid];
         if (closestSeconds < seconds)
         {
             start = mid + 1;
@@ -51,6 +54,45 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     return start;
 }
 
+int KeyedProperty::closestFrameIndex(float seconds, uint32_t& cursor) const
+{
+    // Playback rarely moves by more than a keyframe between applies, so walk
+    // a few frames from where we were last time before falling back to the
+    // binary search. Only strictly in between hits are taken, exact hits on a
+    // keyframe go through the search so duplicate times resolve the same way.
+    constexpr int maxCursorSteps = 4;
+    const float* keyFrameSeconds = m_keyFrameSeconds.data();
+    auto numKeyFrames = static_cast<int>(m_keyFrameSeconds.size());
+    int index = std::min(static_cast<int>(cursor), numKeyFrames);
+    for (int step = 0; step <= maxCursorSteps; step++)
+    {
+        if (index > 0 && seconds <= keyFrameSeconds[index - 1])
+        {
+            if (seconds == keyFrameSeconds[index - 1])
+            {
+                break;
+            }
+            index--;
+        }
+        else if (index < numKeyFrames && seconds >= keyFrameSeconds[index])
+        {
+            if (seconds == keyFrameSeconds[index])
+            {
+                break;
+            }
+            index++;
+        }
+        else
+        {
+            cursor = index;
+            return index;
+        }
+    }
+    index = closestFrameIndex(seconds);
+    cursor = index;
+    return index;
+}
+
 void KeyedProperty::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
                                          uint32_t objectId,
                                          float secondsFrom,
@@ -97,7 +139,11 @@ void KeyedProperty::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
     }
 }
 
-void KeyedProperty::apply(Core* object, float seconds, float mix)
+void KeyedProperty::apply(Core* object,
+                          float seconds,
+                          float mix,
+                          CubicInterpolationBatch* batch,
+                          uint32_t* keyFrameCursor)
 {
     assert(!m_keyFrames.empty());
 
@@ -109,7 +155,9 @@ void KeyedProperty::apply(Core* object, float seconds, float mix)
         actualMix = 1.0f;
     }
 
-    int idx = closestFrameIndex(seconds);
+    int idx = keyFrameCursor == nullptr
+                  ? closestFrameIndex(seconds)
+                  : closestFrameIndex(seconds, *keyFrameCursor);
     int pk = propertyKey();
 
     if (idx == 0)
@@ -125,7 +173,7 @@ void KeyedProperty::apply(Core* object, float seconds, float mix)
                 static_cast<InterpolatingKeyFrame*>(m_keyFrames[idx - 1].get());
             InterpolatingKeyFrame* toFrame =
                 static_cast<InterpolatingKeyFrame*>(m_keyFrames[idx].get());
-            if (seconds == toFrame->seconds())
+            if (seconds == m_keyFrameSeconds[idx])
             {
                 toFrame->apply(object, pk, actualMix);
             }
@@ -135,7 +183,12 @@ void KeyedProperty::apply(Core* object, float seconds, float mix)
                 {
                     fromFrame->apply(object, pk, actualMix);
                 }
-                else
+                else if (batch == nullptr || !batch->add(object,
+                                                         pk,
+                                                         seconds,
+                                                         fromFrame,
+                                                         toFrame,
+                                                         actualMix))
                 {
                     fromFrame->applyInterpolation(object,
                                                   pk,
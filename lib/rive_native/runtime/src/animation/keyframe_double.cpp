@@ -8,7 +8,10 @@ using namespace rive;
 // floating point numbers suffice. So even though this is a "double keyframe" to
 // match editor names, the actual values are stored and applied in 32 bits.
 
-static void applyDouble(Core* object, int propertyKey, float mix, float value)
+void KeyFrameDouble::applyValue(Core* object,
+                                int propertyKey,
+                                float mix,
+                                float value)
 {
     if (mix == 1.0f)
     {
@@ -26,7 +29,7 @@ static void applyDouble(Core* object, int propertyKey, float mix, float value)
 
 void KeyFrameDouble::apply(Core* object, int propertyKey, float mix)
 {
-    applyDouble(object, propertyKey, mix, value());
+    applyValue(object, propertyKey, mix, value());
 }
 
 void KeyFrameDouble::applyInterpolation(Core* object,
@@ -51,5 +54,5 @@ void KeyFrameDouble::applyInterpolation(Core* object,
         frameValue = value() + (nextDouble.value() - value()) * f;
     }
 
-    applyDouble(object, propertyKey, mix, frameValue);
+    applyValue(object, propertyKey, mix, frameValue);
 }
\ No newline at end of file
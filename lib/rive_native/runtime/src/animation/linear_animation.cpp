@@ -1,4 +1,5 @@
 #include "rive/animation/linear_animation.hpp"
+#include "rive/animation/cubic_interpolation_batch.hpp"
 #include "rive/animation/keyed_object.hpp"
 #include "rive/animation/keyed_callback_reporter.hpp"
 #include "rive/artboard.hpp"
@@ -12,6 +13,10 @@ using namespace rive;
 int LinearAnimation::deleteCount = 0;
 #endif
 
+// Scratch space for batching the cubic interpolations of an apply, animations
+// can be applied from multiple threads.
+static thread_local CubicInterpolationBatch s_cubicBatch;
+
 LinearAnimation::LinearAnimation() {}
 
 LinearAnimation::~LinearAnimation()
@@ -24,12 +29,14 @@ LinearAnimation::~LinearAnimation()
 StatusCode LinearAnimation::onAddedDirty(CoreContext* context)
 {
     StatusCode code;
+    m_keyedPropertyCount = 0;
     for (const auto& object : m_KeyedObjects)
     {
         if ((code = object->onAddedDirty(context)) != StatusCode::Ok)
         {
             return code;
         }
+        m_keyedPropertyCount += object->numKeyedProperties();
     }
     return StatusCode::Ok;
 }
@@ -52,16 +59,31 @@ void LinearAnimation::addKeyedObject(std::unique_ptr<KeyedObject> object)
     m_KeyedObjects.push_back(std::move(object));
 }
 
-void LinearAnimation::apply(Artboard* artboard, float time, float mix) const
+void LinearAnimation::apply(Artboard* artboard,
+                            float time,
+                            float mix,
+                            uint32_t* keyFrameCursors) const
 {
     if (quantize())
     {
         float ffps = (float)fps();
         time = std::floor(time * ffps) / ffps;
     }
+    // A property change that applies another animation while this one is
+    // being applied doesn't batch, so frames are never applied out of order.
+    CubicInterpolationBatch* batch =
+        s_cubicBatch.empty() ? &s_cubicBatch : nullptr;
     for (const auto& object : m_KeyedObjects)
     {
-        object->apply(artboard, time, mix);
+        object->apply(artboard, time, mix, batch, keyFrameCursors);
+        if (keyFrameCursors != nullptr)
+        {
+            keyFrameCursors += object->numKeyedProperties();
+        }
+    }
+    if (batch != nullptr)
+    {
+        batch->apply();
     }
 }
 
@@ -19,7 +19,8 @@ LinearAnimationInstance::LinearAnimationInstance(
     m_totalTime(0.0f),
     m_lastTotalTime(0.0f),
     m_spilledTime(0.0f),
-    m_direction(1)
+    m_direction(1),
+    m_keyFrameCursors(animation->keyedPropertyCount(), 0)
 {}
 
 LinearAnimationInstance::LinearAnimationInstance(
@@ -33,7 +34,8 @@ LinearAnimationInstance::LinearAnimationInstance(
     m_spilledTime(lhs.m_spilledTime),
     m_direction(lhs.m_direction),
     m_didLoop(lhs.m_didLoop),
-    m_loopValue(lhs.m_loopValue)
+    m_loopValue(lhs.m_loopValue),
+    m_keyFrameCursors(lhs.m_keyFrameCursors)
 {}
 
 LinearAnimationInstance::~LinearAnimationInstance() {}
@@ -1645,12 +1645,70 @@ bool StateMachineInstance::advanceAndApply(float seconds)
             break;
         }
     }
-    return keepGoing || !m_reportedEvents.empty();
+    keepGoing = keepGoing || !m_reportedEvents.empty();
+    m_settled = !keepGoing;
+    return keepGoing;
 }
 
-void StateMachineInstance::markNeedsAdvance() { m_needsAdvance = true; }
+void StateMachineInstance::markNeedsAdvance()
+{
+    m_needsAdvance = true;
+    m_settled = false;
+}
 bool StateMachineInstance::needsAdvance() const { return m_needsAdvance; }
 
+static bool hasDirtyDataBinds(const std::vector<DataBind*>& dataBinds)
+{
+    for (auto dataBind : dataBinds)
+    {
+        if (dataBind->dirt() != ComponentDirt::None)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Nested state machines are advanced by their NestedArtboard and never settle
+// on their own, so only look for changes made to them from the outside.
+static bool hasPendingWork(Artboard* artboard)
+{
+    if (artboard->hasDirt(ComponentDirt::Components) ||
+        hasDirtyDataBinds(artboard->allDataBinds()))
+    {
+        return true;
+    }
+    for (auto nestedArtboard : artboard->nestedArtboards())
+    {
+        for (auto animation : nestedArtboard->nestedAnimations())
+        {
+            if (!animation->is<NestedStateMachine>())
+            {
+                continue;
+            }
+            auto machine =
+                animation->as<NestedStateMachine>()->stateMachineInstance();
+            if (machine != nullptr &&
+                (machine->needsAdvance() || machine->reportedEventCount() != 0))
+            {
+                return true;
+            }
+        }
+        auto nested = nestedArtboard->artboardInstance();
+        if (nested != nullptr && hasPendingWork(nested))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool StateMachineInstance::isQuiescent() const
+{
+    return m_settled && !m_needsAdvance && m_reportedEvents.empty() &&
+           !hasDirtyDataBinds(m_dataBinds) && !hasPendingWork(m_artboardInstance);
+}
+
 std::string StateMachineInstance::name() const { return m_machine->name(); }
 
 SMIInput* StateMachineInstance::input(size_t index) const
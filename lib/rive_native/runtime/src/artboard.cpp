@@ -28,15 +28,47 @@
 #include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/shapes/shape.hpp"
+#include "rive/shapes/paint/stroke.hpp"
+#include "rive/generated/bones/bone_base.hpp"
+#include "rive/generated/bones/root_bone_base.hpp"
+#include "rive/generated/shapes/cubic_asymmetric_vertex_base.hpp"
+#include "rive/generated/shapes/cubic_detached_vertex_base.hpp"
+#include "rive/generated/shapes/cubic_mirrored_vertex_base.hpp"
+#include "rive/generated/shapes/ellipse_base.hpp"
+#include "rive/generated/shapes/points_path_base.hpp"
+#include "rive/generated/shapes/polygon_base.hpp"
+#include "rive/generated/shapes/rectangle_base.hpp"
+#include "rive/generated/shapes/star_base.hpp"
+#include "rive/generated/shapes/straight_vertex_base.hpp"
+#include "rive/generated/shapes/triangle_base.hpp"
+#include "rive/generated/shapes/paint/fill_base.hpp"
+#include "rive/generated/shapes/paint/solid_color_base.hpp"
+#include "rive/text/text.hpp"
 #include "rive/text/text_value_run.hpp"
 #include "rive/event.hpp"
 #include "rive/assets/audio_asset.hpp"
 #include "rive/layout/layout_data.hpp"
 
+#include <numeric>
 #include <unordered_map>
 
 using namespace rive;
 
+namespace
+{
+// Tracks dirt raised while a single update island is being updated on a
+// scheduler thread. Artboard::onComponentDirty routes to it instead of
+// touching the artboard's own (shared) dirt state.
+struct IslandUpdateState
+{
+    unsigned int island;
+    unsigned int dirtDepth;
+    Artboard* artboard;
+};
+} // namespace
+
+static thread_local IslandUpdateState* s_islandUpdate = nullptr;
+
 Artboard::Artboard()
 {
     // Artboards need to override default clip value to true.
@@ -66,7 +98,7 @@ Artboard::~Artboard()
         {
             continue;
         }
-        delete object;
+        CoreArena::destroy(m_objectArena.get(), object);
     }
 
     for (auto dataBind : m_DataBinds)
@@ -137,7 +169,7 @@ bool Artboard::validateObjects()
                 {
                     continue;
                 }
-                delete m_Objects[i];
+                CoreArena::destroy(m_objectArena.get(), m_Objects[i]);
                 m_Objects[i] = nullptr;
             }
         }
@@ -531,9 +563,200 @@ void Artboard::sortDependencies()
     {
         component->m_GraphOrder = graphOrder++;
     }
+    buildUpdateIslands();
+    if (m_FlattenTransforms)
+    {
+        m_TransformArrays.build(m_DependencyOrder);
+    }
     m_Dirt |= ComponentDirt::Components;
 }
 
+TextRenderMode Artboard::gDefaultTextRenderMode = TextRenderMode::vector;
+
+void Artboard::textRenderMode(TextRenderMode mode)
+{
+    if (mode == m_TextRenderMode)
+    {
+        return;
+    }
+    m_TextRenderMode = mode;
+    markTextRenderModeDirty();
+}
+
+ComponentUpdateScheduler* Artboard::effectiveUpdateScheduler() const
+{
+    for (const Artboard* artboard = this; artboard != nullptr;
+         artboard = artboard->parentArtboard())
+    {
+        if (artboard->m_UpdateScheduler != nullptr)
+        {
+            return artboard->m_UpdateScheduler;
+        }
+    }
+    return nullptr;
+}
+
+TextRenderMode Artboard::effectiveTextRenderMode() const
+{
+    for (const Artboard* artboard = this; artboard != nullptr;
+         artboard = artboard->parentArtboard())
+    {
+        if (artboard->m_TextRenderMode != TextRenderMode::useDefault)
+        {
+            return artboard->m_TextRenderMode;
+        }
+    }
+    return gDefaultTextRenderMode == TextRenderMode::useDefault
+               ? TextRenderMode::vector
+               : gDefaultTextRenderMode;
+}
+
+void Artboard::markTextRenderModeDirty()
+{
+    for (auto text : m_TextComponents)
+    {
+        text->markPaintDirty();
+    }
+    for (auto nestedArtboard : m_NestedArtboards)
+    {
+        Artboard* nested = nestedArtboard->artboardInstance();
+        if (nested != nullptr &&
+            nested->m_TextRenderMode == TextRenderMode::useDefault)
+        {
+            nested->markTextRenderModeDirty();
+        }
+    }
+}
+
+void Artboard::flattenTransforms(bool value)
+{
+    if (value == m_FlattenTransforms)
+    {
+        return;
+    }
+    m_FlattenTransforms = value;
+    if (value)
+    {
+        m_TransformArrays.build(m_DependencyOrder);
+    }
+    else
+    {
+        m_TransformArrays.clear();
+    }
+}
+
+// Components whose update only reads and writes state owned by themselves
+// or by components they share an island with. Matched on the exact core type
+// so subclasses with their own update logic (Text, layouts, nested artboards,
+// etc.) are never included by accident.
+static bool canUpdateConcurrently(Component* component)
+{
+    switch (component->coreType())
+    {
+        // PathComposer is the only runtime component that reports the bare
+        // Component type.
+        case ComponentBase::typeKey:
+        case NodeBase::typeKey:
+        case ShapeBase::typeKey:
+        case PointsPathBase::typeKey:
+        case RectangleBase::typeKey:
+        case EllipseBase::typeKey:
+        case TriangleBase::typeKey:
+        case PolygonBase::typeKey:
+        case StarBase::typeKey:
+        case StraightVertexBase::typeKey:
+        case CubicDetachedVertexBase::typeKey:
+        case CubicMirroredVertexBase::typeKey:
+        case CubicAsymmetricVertexBase::typeKey:
+        case BoneBase::typeKey:
+        case RootBoneBase::typeKey:
+        case FillBase::typeKey:
+        case SolidColorBase::typeKey:
+            return true;
+        case StrokeBase::typeKey:
+            // Stroke effects build their paths through the factory.
+            return !component->as<Stroke>()->hasStrokeEffect();
+        default:
+            return false;
+    }
+}
+
+void Artboard::buildUpdateIslands()
+{
+    m_UpdateIslands.clear();
+    m_TextComponents.clear();
+    auto count = m_DependencyOrder.size();
+    for (auto component : m_DependencyOrder)
+    {
+        component->m_UpdateIsland = 0;
+        if (component->is<Text>())
+        {
+            m_TextComponents.push_back(component->as<Text>());
+        }
+    }
+
+    // Union components with their parents and their dependents, leaving the
+    // artboard out as everything hangs off of it.
+    std::vector<unsigned int> group(count);
+    std::iota(group.begin(), group.end(), 0);
+    auto find = [&](unsigned int index) {
+        while (group[index] != index)
+        {
+            group[index] = group[group[index]];
+            index = group[index];
+        }
+        return index;
+    };
+    auto join = [&](Component* a, Component* b) {
+        if (a == this || b == this || a == nullptr || b == nullptr)
+        {
+            return;
+        }
+        auto ga = find(a->m_GraphOrder);
+        auto gb = find(b->m_GraphOrder);
+        if (ga != gb)
+        {
+            group[std::max(ga, gb)] = std::min(ga, gb);
+        }
+    };
+    for (auto component : m_DependencyOrder)
+    {
+        join(component, component->parent());
+        for (auto dependent : component->dependents())
+        {
+            join(component, dependent);
+        }
+    }
+
+    std::vector<bool> concurrent(count, true);
+    for (auto component : m_DependencyOrder)
+    {
+        if (component == this || !canUpdateConcurrently(component))
+        {
+            concurrent[find(component->m_GraphOrder)] = false;
+        }
+    }
+
+    // Walk in dependency order so each island's list stays sorted.
+    std::vector<unsigned int> islandOfGroup(count, 0);
+    for (auto component : m_DependencyOrder)
+    {
+        auto root = find(component->m_GraphOrder);
+        if (!concurrent[root])
+        {
+            continue;
+        }
+        if (islandOfGroup[root] == 0)
+        {
+            m_UpdateIslands.emplace_back();
+            islandOfGroup[root] = (unsigned int)m_UpdateIslands.size();
+        }
+        component->m_UpdateIsland = islandOfGroup[root];
+        m_UpdateIslands[islandOfGroup[root] - 1].push_back(component);
+    }
+    m_DeferredIslandDirt.resize(m_UpdateIslands.size());
+}
+
 void Artboard::addObject(Core* object) { m_Objects.push_back(object); }
 
 void Artboard::addAnimation(LinearAnimation* object)
@@ -571,6 +794,18 @@ uint32_t Artboard::idOf(Core* object) const
 
 void Artboard::onComponentDirty(Component* component)
 {
+    if (s_islandUpdate != nullptr)
+    {
+        // Dirt for other islands was deferred by deferIslandDirt, so this
+        // is always a component of the island being updated.
+        auto state = s_islandUpdate;
+        if (component->graphOrder() < state->dirtDepth)
+        {
+            state->dirtDepth = component->graphOrder();
+        }
+        return;
+    }
+
     m_Dirt |= ComponentDirt::Components;
 
     /// If the order of the component is less than the current dirt
@@ -770,16 +1005,33 @@ bool Artboard::updateComponents()
     const int maxSteps = 100;
     int step = 0;
     auto count = m_DependencyOrder.size();
+    auto scheduler = effectiveUpdateScheduler();
+    bool useIslands = scheduler != nullptr && !m_UpdateIslands.empty();
+    if (scheduler != nullptr)
+    {
+        prepareTextShapes(scheduler);
+    }
     while (hasDirt(ComponentDirt::Components) && step < maxSteps)
     {
         m_Dirt = m_Dirt & ~ComponentDirt::Components;
 
+        // Flattened nodes only depend on the artboard and each other, so
+        // their transforms can be resolved up front. What they leave dirty
+        // (opacity, etc.) is still handled by their own update below.
+        m_TransformArrays.update(worldTransform());
+
         // Track dirt depth here so that if something else marks
         // dirty, we restart.
         for (unsigned int i = 0; i < count; i++)
         {
             auto component = m_DependencyOrder[i];
             m_DirtDepth = i;
+            if (useIslands && component->m_UpdateIsland != 0)
+            {
+                // Updated below, islands don't depend on anything in the
+                // serial order except the artboard which is always first.
+                continue;
+            }
             auto d = component->m_Dirt;
             if (d == ComponentDirt::None ||
                 (d & ComponentDirt::Collapsed) == ComponentDirt::Collapsed)
@@ -797,11 +1049,109 @@ bool Artboard::updateComponents()
                 break;
             }
         }
+
+        if (useIslands)
+        {
+            m_UpdatingIslands = true;
+            scheduler->parallelFor(m_UpdateIslands.size(),
+                                   [this](size_t index) { updateIsland(index); });
+            m_UpdatingIslands = false;
+
+            // Apply dirt that landed outside of the island that raised it,
+            // which marks the artboard dirty for another pass to pick it up.
+            for (auto& deferred : m_DeferredIslandDirt)
+            {
+                for (auto& dirt : deferred)
+                {
+                    dirt.component->addDirt(dirt.value, dirt.recurse);
+                }
+                deferred.clear();
+            }
+        }
         step++;
     }
     return true;
 }
 
+void Artboard::prepareTextShapes(ComponentUpdateScheduler* scheduler)
+{
+    std::vector<Text*> texts;
+    for (auto text : m_TextComponents)
+    {
+        auto d = text->m_Dirt;
+        if ((d & ComponentDirt::Path) == ComponentDirt::Path &&
+            (d & ComponentDirt::Collapsed) != ComponentDirt::Collapsed)
+        {
+            texts.push_back(text);
+        }
+    }
+    if (texts.size() < 2)
+    {
+        // Nothing to overlap, let the update shape it.
+        return;
+    }
+    // Shaping only reads each Text's runs and styles, which nothing else
+    // writes to while the scheduler runs. Update re-checks the styled text
+    // before using a prepared shape, in case something earlier in the
+    // dependency order changes it.
+    scheduler->parallelFor(texts.size(), [&texts](size_t index) {
+        texts[index]->prepareShape();
+    });
+}
+
+void Artboard::updateIsland(size_t index)
+{
+    const std::vector<Component*>& order = m_UpdateIslands[index];
+    IslandUpdateState state = {(unsigned int)index + 1, 0, this};
+    s_islandUpdate = &state;
+
+    // Same restart logic as the serial update, scoped to this island.
+    const int maxSteps = 100;
+    for (int step = 0; step < maxSteps; step++)
+    {
+        bool restart = false;
+        for (auto component : order)
+        {
+            auto d = component->m_Dirt;
+            state.dirtDepth = component->graphOrder();
+            if (d == ComponentDirt::None ||
+                (d & ComponentDirt::Collapsed) == ComponentDirt::Collapsed)
+            {
+                continue;
+            }
+            component->m_Dirt = ComponentDirt::None;
+            component->update(d);
+            if (state.dirtDepth < component->graphOrder())
+            {
+                restart = true;
+                break;
+            }
+        }
+        if (!restart)
+        {
+            break;
+        }
+    }
+
+    s_islandUpdate = nullptr;
+}
+
+bool Artboard::deferIslandDirt(Component* component,
+                               ComponentDirt value,
+                               bool recurse)
+{
+    auto state = s_islandUpdate;
+    if (state == nullptr || component->m_UpdateIsland == state->island)
+    {
+        return false;
+    }
+    // Another island (or the serial part of the order) owns this component,
+    // touching its dirt here would race with whoever updates it.
+    state->artboard->m_DeferredIslandDirt[state->island - 1].push_back(
+        {component, value, recurse});
+    return true;
+}
+
 void* Artboard::takeLayoutNode()
 {
 #ifdef WITH_RIVE_LAYOUT
@@ -36,6 +36,14 @@ void Component::addDependent(Component* component)
 
 bool Component::addDirt(ComponentDirt value, bool recurse)
 {
+    if (m_Artboard != nullptr && m_Artboard->m_UpdatingIslands &&
+        Artboard::deferIslandDirt(this, value, recurse))
+    {
+        // Raised from an update island for a component it doesn't own, the
+        // artboard applies it once every island completed.
+        return true;
+    }
+
     if ((m_Dirt & value) == value)
     {
         // Already marked.
@@ -0,0 +1,100 @@
+#include "rive/core/core_arena.hpp"
+#include "rive/core.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+using namespace rive;
+
+static thread_local CoreArena* s_currentArena = nullptr;
+
+static constexpr size_t kCoreAlignment = alignof(std::max_align_t);
+
+static size_t alignSize(size_t size)
+{
+    return (size + kCoreAlignment - 1) & ~(kCoreAlignment - 1);
+}
+
+CoreArena::CoreArena(size_t initialCapacity)
+{
+    addBlock(initialCapacity == 0 ? kDefaultBlockSize
+                                  : alignSize(initialCapacity));
+}
+
+CoreArena::~CoreArena() { assert(s_currentArena != this); }
+
+void CoreArena::addBlock(size_t size)
+{
+    m_blocks.push_back({std::unique_ptr<uint8_t[]>(new uint8_t[size]), size});
+    m_cursor = m_blocks.back().memory.get();
+    m_end = m_cursor + size;
+}
+
+void* CoreArena::allocate(size_t size)
+{
+    size = alignSize(size);
+    if (static_cast<size_t>(m_end - m_cursor) < size)
+    {
+        addBlock(std::max(size, kDefaultBlockSize));
+    }
+    void* result = m_cursor;
+    m_cursor += size;
+    m_bytesUsed += size;
+    return result;
+}
+
+bool CoreArena::owns(const void* ptr) const
+{
+    auto address = static_cast<const uint8_t*>(ptr);
+    for (const Block& block : m_blocks)
+    {
+        if (address >= block.memory.get() &&
+            address < block.memory.get() + block.size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CoreArena::destroy(CoreArena* arena, Core* object)
+{
+    if (arena != nullptr && arena->owns(object))
+    {
+        // The memory is reclaimed when the arena is destroyed.
+        object->~Core();
+    }
+    else
+    {
+        delete object;
+    }
+}
+
+CoreArena* CoreArena::claimForClone()
+{
+    CoreArena* arena = s_currentArena;
+    s_currentArena = nullptr;
+    return arena;
+}
+
+CoreArena::Scope::Scope(CoreArena* arena) : m_previous(s_currentArena)
+{
+    s_currentArena = arena;
+}
+
+CoreArena::Scope::~Scope() { s_currentArena = m_previous; }
+
+void* Core::operator new(size_t size, CoreArena* arena)
+{
+    return arena != nullptr ? arena->allocate(size) : ::operator new(size);
+}
+
+void Core::operator delete(void* ptr, CoreArena* arena)
+{
+    // Only reached when a constructor throws.
+    if (arena == nullptr)
+    {
+        ::operator delete(ptr);
+    }
+}
@@ -73,8 +73,6 @@ void DataConverterFormula::initialize()
 {
     // convert the formula to Reverse Polish Notation using a version of
     // the Shunting yard algorithm
-    // Some optimizations could be done here by precomputing constant parts
-    // of the equation
     std::vector<FormulaToken*> operationsStack;
     int tokenIndex = 0;
     for (auto& token : m_tokens)
@@ -190,6 +188,126 @@ void DataConverterFormula::initialize()
             m_outputQueue.push_back(operation);
         }
     }
+    compile();
+}
+
+void DataConverterFormula::compile()
+{
+    m_program.clear();
+    // Tracks, for every value on the stack, whether it's known at compile
+    // time. Stack depth doesn't depend on values so operand counts can be
+    // resolved here once.
+    std::vector<bool> constants;
+    size_t maxDepth = 0;
+    auto push = [&](const FormulaInstruction& instruction, bool isConstant) {
+        m_program.push_back(instruction);
+        constants.push_back(isConstant);
+        maxDepth = std::max(maxDepth, constants.size());
+    };
+    // Replaces the trailing constant pushes consumed by the last instruction
+    // with a single push of its result.
+    auto fold = [&](int count) {
+        for (size_t i = constants.size() - count; i < constants.size(); i++)
+        {
+            if (!constants[i])
+            {
+                return false;
+            }
+        }
+        FormulaInstruction instruction = m_program.back();
+        m_program.pop_back();
+        float arguments[256];
+        for (int i = 0; i < count; i++)
+        {
+            arguments[i] = m_program[m_program.size() - count + i].value;
+        }
+        float result =
+            instruction.opcode == FormulaOpcode::operation
+                ? applyOperation(arguments[0], arguments[1], instruction.type)
+                : applyFunction(arguments, instruction.type, count);
+        m_program.resize(m_program.size() - count);
+        constants.resize(constants.size() - count);
+        push({FormulaOpcode::pushConstant, 0, 0, result, nullptr}, true);
+        return true;
+    };
+
+    for (auto& token : m_outputQueue)
+    {
+        if (token->is<FormulaTokenOperation>())
+        {
+            // Operations without two operands are skipped.
+            if (constants.size() < 2)
+            {
+                continue;
+            }
+            m_program.push_back(
+                {FormulaOpcode::operation,
+                 2,
+                 (int)token->as<FormulaTokenOperation>()->operationType(),
+                 0.0f,
+                 nullptr});
+            if (!fold(2))
+            {
+                constants.resize(constants.size() - 2);
+                constants.push_back(false);
+            }
+        }
+        else if (token->is<FormulaTokenFunction>())
+        {
+            auto argumentsCount = m_argumentsCount.find(token);
+            int count = std::min(
+                (int)constants.size(),
+                std::min(argumentsCount == m_argumentsCount.end()
+                             ? 0
+                             : argumentsCount->second,
+                         255));
+            auto functionType =
+                token->as<FormulaTokenFunction>()->functionType();
+            m_program.push_back({FormulaOpcode::function,
+                                 (uint8_t)count,
+                                 (int)functionType,
+                                 0.0f,
+                                 nullptr});
+            // Random values are drawn lazily at evaluation time.
+            if ((FunctionType)functionType == FunctionType::random ||
+                !fold(count))
+            {
+                constants.resize(constants.size() - count);
+                constants.push_back(false);
+                maxDepth = std::max(maxDepth, constants.size());
+            }
+        }
+        else if (token->is<FormulaTokenInput>())
+        {
+            push({FormulaOpcode::pushInput, 0, 0, 0.0f, nullptr}, false);
+        }
+        else if (token->is<FormulaTokenValue>())
+        {
+            auto valueToken = token->as<FormulaTokenValue>();
+#ifdef WITH_RIVE_TOOLS
+            // Values can be edited live.
+            bool isConstant = false;
+#else
+            bool isConstant = valueToken->dataBinds().empty();
+#endif
+            if (isConstant)
+            {
+                push({FormulaOpcode::pushConstant,
+                      0,
+                      0,
+                      valueToken->operationValue(),
+                      nullptr},
+                     true);
+            }
+            else
+            {
+                push({FormulaOpcode::pushToken, 0, 0, 0.0f, valueToken},
+                     false);
+            }
+        }
+    }
+    m_hasResult = constants.size() == 1;
+    m_stack.resize(std::max(maxDepth, (size_t)1));
 }
 
 float DataConverterFormula::applyOperation(float left,
@@ -223,37 +341,27 @@ float DataConverterFormula::getRandom(int randomIndex)
     return m_randoms[randomIndex];
 }
 
-float DataConverterFormula::applyFunction(std::vector<float>& stack,
+// arguments holds the values in the order they were pushed, so arguments[0]
+// is the first argument of the function.
+float DataConverterFormula::applyFunction(const float* arguments,
                                           int functionTypeIndex,
                                           int totalArguments)
 {
-
-    std::vector<float> functionArguments;
-    int index = 0;
     int currentRandom = 0;
-    while (index < totalArguments)
-    {
-        if (stack.size() > 0)
-        {
-            auto functionArgument = stack.back();
-            stack.pop_back();
-            functionArguments.push_back(functionArgument);
-        }
-        index++;
-    }
     auto functionType = (FunctionType)functionTypeIndex;
     switch (functionType)
     {
         case FunctionType::min:
         {
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                float minValue = functionArguments[0];
-                for (auto i = 1; i < functionArguments.size(); i++)
+                // Compare from the last pushed argument down.
+                float minValue = arguments[totalArguments - 1];
+                for (auto i = totalArguments - 2; i >= 0; i--)
                 {
-                    if (functionArguments[i] < minValue)
+                    if (arguments[i] < minValue)
                     {
-                        minValue = functionArguments[i];
+                        minValue = arguments[i];
                     }
                 }
                 return minValue;
@@ -262,14 +370,15 @@ float DataConverterFormula::applyFunction(std::vector<float>& stack,
         break;
         case FunctionType::max:
         {
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                float maxValue = functionArguments[0];
-                for (auto i = 1; i < functionArguments.size(); i++)
+                // Compare from the last pushed argument down.
+                float maxValue = arguments[totalArguments - 1];
+                for (auto i = totalArguments - 2; i >= 0; i--)
                 {
-                    if (functionArguments[i] > maxValue)
+                    if (arguments[i] > maxValue)
                     {
-                        maxValue = functionArguments[i];
+                        maxValue = arguments[i];
                     }
                 }
                 return maxValue;
@@ -277,97 +386,97 @@ float DataConverterFormula::applyFunction(std::vector<float>& stack,
         }
         break;
         case FunctionType::round:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return roundf(functionArguments.back());
+                return roundf(arguments[0]);
             }
             break;
         case FunctionType::ceil:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return ceilf(functionArguments.back());
+                return ceilf(arguments[0]);
             }
             break;
         case FunctionType::floor:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return floorf(functionArguments.back());
+                return floorf(arguments[0]);
             }
             break;
         case FunctionType::sqrt:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return sqrtf(functionArguments.back());
+                return sqrtf(arguments[0]);
             }
             break;
         case FunctionType::pow:
         {
-            if (functionArguments.size() > 1)
+            if (totalArguments > 1)
             {
-                auto exponent = functionArguments[functionArguments.size() - 2];
-                auto x = functionArguments.back();
+                auto exponent = arguments[1];
+                auto x = arguments[0];
                 return powf(x, exponent);
             }
         }
         break;
         case FunctionType::exp:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return exp(functionArguments.back());
+                return exp(arguments[0]);
             }
             break;
         case FunctionType::log:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return log(functionArguments.back());
+                return log(arguments[0]);
             }
             break;
         case FunctionType::cosine:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return cos(functionArguments.back());
+                return cos(arguments[0]);
             }
             break;
         case FunctionType::sine:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return sin(functionArguments.back());
+                return sin(arguments[0]);
             }
             break;
         case FunctionType::tangent:
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return tan(functionArguments.back());
+                return tan(arguments[0]);
             }
             break;
         case FunctionType::acosine:
 
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return acos(functionArguments.back());
+                return acos(arguments[0]);
             }
             break;
         case FunctionType::asine:
 
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return asin(functionArguments.back());
+                return asin(arguments[0]);
             }
             break;
         case FunctionType::atangent:
 
-            if (functionArguments.size() > 0)
+            if (totalArguments > 0)
             {
-                return atan(functionArguments.back());
+                return atan(arguments[0]);
             }
             break;
         case FunctionType::atangent2:
         {
-            if (functionArguments.size() > 1)
+            if (totalArguments > 1)
             {
-                auto argument1 = functionArguments.back();
+                auto argument1 = arguments[0];
                 auto argument2 =
-                    functionArguments[functionArguments.size() - 2];
+                    arguments[1];
                 return atan2(argument1, argument2);
             }
         }
@@ -377,14 +486,14 @@ float DataConverterFormula::applyFunction(std::vector<float>& stack,
             float randomValue = getRandom(currentRandom++);
             float lowerBound = 0;
             float upperBound = 1;
-            if (functionArguments.size() == 1)
+            if (totalArguments == 1)
             {
-                upperBound = functionArguments.back();
+                upperBound = arguments[0];
             }
-            else if (functionArguments.size() > 1)
+            else if (totalArguments > 1)
             {
-                lowerBound = functionArguments.back();
-                upperBound = functionArguments[functionArguments.size() - 2];
+                lowerBound = arguments[0];
+                upperBound = arguments[1];
             }
             return lowerBound + (upperBound - lowerBound) * randomValue;
         }
@@ -395,59 +504,54 @@ float DataConverterFormula::applyFunction(std::vector<float>& stack,
     return 0;
 }
 
-DataValue* DataConverterFormula::convert(DataValue* value, DataBind* dataBind)
+float DataConverterFormula::evaluate(float inputValue)
 {
-    if (value->is<DataValueNumber>())
+    float* stack = m_stack.data();
+    size_t size = 0;
+    for (const FormulaInstruction& instruction : m_program)
     {
-        float inputValue = value->as<DataValueNumber>()->value();
-        float resultValue = inputValue;
-
-        std::vector<float> stack;
-        for (auto& token : m_outputQueue)
+        switch (instruction.opcode)
         {
-            if (token->is<FormulaTokenOperation>())
-            {
-                if (stack.size() > 1)
-                {
-                    auto right = stack.back();
-                    stack.pop_back();
-                    auto left = stack.back();
-                    stack.pop_back();
-                    float operationResult = applyOperation(
-                        left,
-                        right,
-                        token->as<FormulaTokenOperation>()->operationType());
-                    stack.push_back(operationResult);
-                }
-            }
-            else if (token->is<FormulaTokenFunction>())
-            {
-                auto argumentsCount = m_argumentsCount.find(token);
-                float operationResult = applyFunction(
-                    stack,
-                    token->as<FormulaTokenFunction>()->functionType(),
-                    argumentsCount == m_argumentsCount.end()
-                        ? 0
-                        : argumentsCount->second);
-                stack.push_back(operationResult);
-            }
-            else if (token->is<FormulaTokenInput>())
+            case FormulaOpcode::pushConstant:
+                stack[size++] = instruction.value;
+                break;
+            case FormulaOpcode::pushInput:
+                stack[size++] = inputValue;
+                break;
+            case FormulaOpcode::pushToken:
+                stack[size++] = instruction.token->operationValue();
+                break;
+            case FormulaOpcode::operation:
+                size--;
+                stack[size - 1] = applyOperation(stack[size - 1],
+                                                 stack[size],
+                                                 instruction.type);
+                break;
+            case FormulaOpcode::function:
             {
-                stack.push_back(inputValue);
-            }
-            else if (token->is<FormulaTokenValue>())
-            {
-                stack.push_back(
-                    token->as<FormulaTokenValue>()->operationValue());
+                size -= instruction.argumentsCount;
+                stack[size] = applyFunction(stack + size,
+                                            instruction.type,
+                                            instruction.argumentsCount);
+                size++;
+                break;
             }
         }
+    }
+    assert(size == 1);
+    return stack[0];
+}
+
+DataValue* DataConverterFormula::convert(DataValue* value, DataBind* dataBind)
+{
+    if (value->is<DataValueNumber>())
+    {
+        float inputValue = value->as<DataValueNumber>()->value();
+        float resultValue = inputValue;
 
-        // If the formula is well formed, the stack at the end has to be of size
-        // 1
-        if (stack.size() == 1)
+        if (m_hasResult)
         {
-            resultValue = stack.back();
-            stack.pop_back();
+            resultValue = evaluate(inputValue);
         }
 
         m_output.value(resultValue);
@@ -495,6 +599,7 @@ Core* DataConverterFormula::clone() const
         auto clonedToken = token->clone()->as<FormulaToken>();
         cloned->addOutputToken(clonedToken, argumentsCount);
     }
+    cloned->compile();
     cloned->isInstance(true);
     return cloned;
 }
@@ -1,12 +1,28 @@
 #include "rive/dependency_sorter.hpp"
 #include "rive/component.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
 using namespace rive;
 
+// Every sorter claims two fresh mark values. Marks left on components by
+// previous sorts can never match them.
+static std::atomic<uint32_t> s_nextMark{1};
+
+DependencySorter::DependencySorter()
+{
+    m_TempMark = s_nextMark.fetch_add(2, std::memory_order_relaxed);
+    m_PermMark = m_TempMark + 1;
+}
+
 void DependencySorter::sort(Component* root, std::vector<Component*>& order)
 {
     order.clear();
     visit(root, order);
+    // visit builds a post-order, dependencies come first when reversed.
+    std::reverse(order.begin(), order.end());
 }
 
 void DependencySorter::sort(std::vector<Component*> roots,
@@ -17,33 +33,33 @@ void DependencySorter::sort(std::vector<Component*> roots,
     {
         visit(root, order);
     }
+    std::reverse(order.begin(), order.end());
 }
 
 bool DependencySorter::visit(Component* component,
                              std::vector<Component*>& order)
 {
-    if (m_Perm.find(component) != m_Perm.end())
+    if (component->m_SortMark == m_PermMark)
     {
         return true;
     }
-    if (m_Temp.find(component) != m_Temp.end())
+    if (component->m_SortMark == m_TempMark)
     {
         fprintf(stderr, "Dependency cycle!\n");
         return false;
     }
 
-    m_Temp.emplace(component);
+    component->m_SortMark = m_TempMark;
 
-    auto dependents = component->dependents();
-    for (auto dependent : dependents)
+    for (auto dependent : component->dependents())
     {
         if (!visit(dependent, order))
         {
             return false;
         }
     }
-    m_Perm.emplace(component);
-    order.insert(order.begin(), component);
+    component->m_SortMark = m_PermMark;
+    order.push_back(component);
 
     return true;
-}
\ No newline at end of file
+}
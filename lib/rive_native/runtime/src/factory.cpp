@@ -5,6 +5,7 @@
 #include "rive/factory.hpp"
 #include "rive/math/aabb.hpp"
 #include "rive/math/raw_path.hpp"
+#include "rive/text/glyph_atlas.hpp"
 #include "rive/text/raw_text.hpp"
 #ifdef WITH_RIVE_TEXT
 #include "rive/text/font_hb.hpp"
@@ -12,6 +13,31 @@
 
 using namespace rive;
 
+Factory::Factory() {}
+
+Factory::~Factory() {}
+
+GlyphAtlas* Factory::glyphAtlas()
+{
+    std::call_once(m_glyphAtlasOnce, [this]() {
+        // Probe with a single pixel, the atlas is useless without images.
+        const uint8_t pixel[4] = {0, 0, 0, 0};
+        if (makeImage(1, 1, pixel) != nullptr)
+        {
+            m_glyphAtlas = rivestd::make_unique<GlyphAtlas>(this);
+        }
+    });
+    return m_glyphAtlas.get();
+}
+
+void Factory::releaseGlyphAtlasImages()
+{
+    if (m_glyphAtlas != nullptr)
+    {
+        m_glyphAtlas->releaseImages();
+    }
+}
+
 rcp<RenderPath> Factory::makeRenderPath(const AABB& r)
 {
     RawPath rawPath;
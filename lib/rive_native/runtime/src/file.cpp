@@ -1,6 +1,8 @@
 #include "rive/file.hpp"
 #include "rive/runtime_header.hpp"
 #include "rive/animation/animation.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/core/field_types/core_bytes_type.hpp"
 #include "rive/core/field_types/core_color_type.hpp"
 #include "rive/core/field_types/core_double_type.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
@@ -45,11 +47,14 @@
 #include "rive/data_bind/bindable_property_boolean.hpp"
 #include "rive/data_bind/bindable_property_trigger.hpp"
 #include "rive/data_bind/converters/data_converter_group.hpp"
+#include "rive/data_bind/converters/data_converter_group_item.hpp"
+#include "rive/data_bind/converters/formula/formula_token.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/audio_asset.hpp"
 #include "rive/assets/file_asset_contents.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/viewmodel/data_enum.hpp"
+#include "rive/viewmodel/data_enum_value.hpp"
 #include "rive/viewmodel/viewmodel_instance.hpp"
 #include "rive/viewmodel/viewmodel_instance_list.hpp"
 #include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
@@ -157,6 +162,113 @@ static Core* readRuntimeObject(BinaryReader& reader,
     return object;
 }
 
+// Skip over a single Rive runtime object without instancing it. Used by the
+// lazy importer to index artboards, fieldIds caches the field type of each
+// property key seen so far (-2 when not looked up yet).
+static bool skipRuntimeObject(BinaryReader& reader,
+                              const RuntimeHeader& header,
+                              std::vector<int>& fieldIds)
+{
+    reader.readVarUint64();
+    while (true)
+    {
+        auto propertyKey = reader.readVarUintAs<uint16_t>();
+        if (propertyKey == 0 || reader.hasError())
+        {
+            break;
+        }
+        if (propertyKey >= fieldIds.size())
+        {
+            fieldIds.resize(propertyKey + 1, -2);
+        }
+        int id = fieldIds[propertyKey];
+        if (id == -2)
+        {
+            id = CoreRegistry::propertyFieldId(propertyKey);
+            if (id == -1)
+            {
+                id = header.propertyFieldId(propertyKey);
+            }
+            fieldIds[propertyKey] = id;
+        }
+        switch (id)
+        {
+            case CoreUintType::id:
+                reader.readVarUint64();
+                break;
+            case CoreBytesType::id:
+                // Strings share the bytes encoding, skip them without
+                // decoding.
+                reader.readBytes();
+                break;
+            case CoreDoubleType::id:
+                reader.readFloat32();
+                break;
+            case CoreColorType::id:
+                reader.readUint32();
+                break;
+            default:
+                fprintf(stderr,
+                        "Unknown property key %d, missing from property ToC.\n",
+                        propertyKey);
+                return false;
+        }
+    }
+    return !reader.hasError();
+}
+
+namespace
+{
+enum class LazyObjectScope : uint8_t
+{
+    // Belongs to the artboard that was last read.
+    artboard,
+    // Belongs to the file and is read up front.
+    file,
+    // Data binds belong to whatever object they follow.
+    dataBind,
+};
+} // namespace
+
+static LazyObjectScope lazyObjectScope(
+    uint16_t typeKey,
+    std::unordered_map<uint16_t, LazyObjectScope>& cache)
+{
+    auto itr = cache.find(typeKey);
+    if (itr != cache.end())
+    {
+        return itr->second;
+    }
+    // Core has no static type hierarchy, so build a throwaway instance once
+    // per type key to ask it.
+    std::unique_ptr<Core> object(CoreRegistry::makeCoreInstance(typeKey));
+    LazyObjectScope scope = LazyObjectScope::artboard;
+    if (object == nullptr)
+    {
+        // Unknown objects are null objects, the artboard importer uses them
+        // to keep component ids stable.
+    }
+    else if (object->is<DataBind>())
+    {
+        scope = LazyObjectScope::dataBind;
+    }
+    else if (object->is<Backboard>() || object->is<Artboard>() ||
+             object->is<FileAsset>() || object->is<FileAssetContents>() ||
+             object->is<ViewModelComponent>() ||
+             object->is<ViewModelInstance>() ||
+             object->is<ViewModelInstanceValue>() ||
+             object->is<ViewModelInstanceListItem>() ||
+             object->is<DataEnum>() || object->is<DataEnumValue>() ||
+             object->is<DataConverter>() ||
+             object->is<DataConverterGroupItem>() ||
+             object->is<FormulaToken>() || object->is<ScrollPhysics>())
+    {
+        scope = LazyObjectScope::file;
+    }
+    cache[typeKey] = scope;
+    return scope;
+}
+
 File::File(Factory* factory, FileAssetLoader* assetLoader) :
     m_factory(factory), m_assetLoader(assetLoader)
 {
@@ -205,13 +317,10 @@ File::~File()
     delete m_backboard;
 }
 
-std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
-                                   Factory* factory,
-                                   ImportResult* result,
-                                   FileAssetLoader* assetLoader)
+static bool readHeader(BinaryReader& reader,
+                       RuntimeHeader& header,
+                       ImportResult* result)
 {
-    BinaryReader reader(bytes);
-    RuntimeHeader header;
     if (!RuntimeHeader::read(reader, header))
     {
         fprintf(stderr, "Bad header\n");
@@ -219,20 +328,34 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
         {
             *result = ImportResult::malformed;
         }
-        return nullptr;
+        return false;
     }
-    if (header.majorVersion() != majorVersion)
+    if (header.majorVersion() != File::majorVersion)
     {
         fprintf(stderr,
                 "Unsupported version %u.%u expected %u.%u.\n",
                 header.majorVersion(),
                 header.minorVersion(),
-                majorVersion,
-                minorVersion);
+                File::majorVersion,
+                File::minorVersion);
         if (result)
         {
             *result = ImportResult::unsupportedVersion;
         }
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
+                                   Factory* factory,
+                                   ImportResult* result,
+                                   FileAssetLoader* assetLoader)
+{
+    BinaryReader reader(bytes);
+    RuntimeHeader header;
+    if (!readHeader(reader, header, result))
+    {
         return nullptr;
     }
     auto file = rivestd::make_unique<File>(factory, assetLoader);
@@ -249,80 +372,139 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
     return file;
 }
 
+std::unique_ptr<File> File::importLazy(Span<const uint8_t> bytes,
+                                       Factory* factory,
+                                       ImportResult* result,
+                                       FileAssetLoader* assetLoader)
+{
+    BinaryReader reader(bytes);
+    auto header = rivestd::make_unique<RuntimeHeader>();
+    if (!readHeader(reader, *header, result))
+    {
+        return nullptr;
+    }
+    auto file = rivestd::make_unique<File>(factory, assetLoader);
+    file->m_lazyData = bytes;
+
+    auto readResult = file->readLazy(reader, *header);
+    file->m_lazyHeader = std::move(header);
+    if (result)
+    {
+        *result = readResult;
+    }
+    if (readResult != ImportResult::success)
+    {
+        file.reset(nullptr);
+    }
+    return file;
+}
+
 ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
 {
     ImportStack importStack;
     // TODO: @hernan consider moving this to a special importer. It's not that
     // simple because Core doesn't have a typeKey, so it should be treated as
     // a special case. In any case, it's not that bad having it here for now.
-    Core* lastBindableObject;
+    Core* lastBindableObject = nullptr;
     while (!reader.reachedEnd())
     {
-        auto object = readRuntimeObject(reader, header);
-        if (object == nullptr)
+        if (!importObject(readRuntimeObject(reader, header),
+                          importStack,
+                          lastBindableObject))
         {
-            importStack.readNullObject();
-            continue;
-        }
-        if (!object->is<DataBind>())
-        {
-            lastBindableObject = object;
+            return ImportResult::malformed;
         }
-        else if (lastBindableObject != nullptr)
+    }
+
+    return !reader.hasError() && importStack.resolve() == StatusCode::Ok
+               ? ImportResult::success
+               : ImportResult::malformed;
+}
+
+ImportResult File::readLazy(BinaryReader& reader, const RuntimeHeader& header)
+{
+    ImportStack importStack;
+    Core* lastBindableObject = nullptr;
+    std::unordered_map<uint16_t, LazyObjectScope> scopes;
+    std::vector<int> fieldIds;
+    // Whether the last object read belongs to an artboard, data binds follow
+    // it.
+    bool inArtboard = false;
+    while (!reader.reachedEnd())
+    {
+        size_t offset = reader.position() - m_lazyData.data();
+        BinaryReader peek = reader;
+        auto typeKey = peek.readVarUintAs<uint16_t>();
+        if (peek.hasError())
         {
-            object->as<DataBind>()->target(lastBindableObject);
+            return ImportResult::malformed;
         }
-        if (object->import(importStack) == StatusCode::Ok)
+
+        switch (lazyObjectScope(typeKey, scopes))
         {
-            switch (object->coreType())
-            {
-                case Backboard::typeKey:
-                    m_backboard = object->as<Backboard>();
-                    break;
-                case Artboard::typeKey:
-                {
-                    Artboard* ab = object->as<Artboard>();
-                    ab->m_Factory = m_factory;
-                    m_artboards.push_back(ab);
-                }
+            case LazyObjectScope::artboard:
+                // Objects before the first artboard have no artboard importer
+                // to go to, they're read like any other file object.
+                inArtboard = !m_lazyArtboards.empty();
                 break;
-                case ImageAsset::typeKey:
-                case FontAsset::typeKey:
-                case AudioAsset::typeKey:
-                {
-                    auto fa = object->as<FileAsset>();
-                    m_fileAssets.push_back(fa);
-                }
+            case LazyObjectScope::file:
+                inArtboard = false;
                 break;
-                case ViewModel::typeKey:
-                {
-                    auto vmc = object->as<ViewModel>();
-                    m_ViewModels.push_back(vmc);
-                    break;
-                }
-                case ViewModelInstance::typeKey:
-                {
-                    auto vmi = object->as<ViewModelInstance>();
-                    m_ViewModelInstances.push_back(vmi);
-                    break;
-                }
-                case DataEnum::typeKey:
-                case DataEnumCustom::typeKey:
-                {
-                    auto de = object->as<DataEnum>();
-                    m_Enums.push_back(de);
-                    break;
-                }
-                case ViewModelPropertyEnumCustom::typeKey:
-                {
-                    auto vme = object->as<ViewModelPropertyEnumCustom>();
-                    if (vme->enumId() < m_Enums.size())
-                    {
-                        vme->dataEnum(m_Enums[vme->enumId()]);
-                    }
-                }
+            case LazyObjectScope::dataBind:
                 break;
+        }
+
+        if (inArtboard)
+        {
+            if (!skipRuntimeObject(reader, header, fieldIds))
+            {
+                return ImportResult::malformed;
+            }
+            size_t end = reader.position() - m_lazyData.data();
+            // Objects of an artboard that failed to import go to the last one
+            // that didn't, like they would in File::read.
+            auto lazyArtboard =
+                std::find_if(m_lazyArtboards.rbegin(),
+                             m_lazyArtboards.rend(),
+                             [](const LazyArtboard& lazy) {
+                                 return lazy.artboard != nullptr;
+                             });
+            if (lazyArtboard == m_lazyArtboards.rend())
+            {
+                continue;
+            }
+            auto& ranges = lazyArtboard->ranges;
+            if (!ranges.empty() && ranges.back().second == offset)
+            {
+                ranges.back().second = end;
+            }
+            else
+            {
+                ranges.emplace_back(offset, end);
             }
+            continue;
+        }
+
+        auto object = readRuntimeObject(reader, header);
+        if (object == nullptr || !object->is<Artboard>())
+        {
+            if (!importObject(object, importStack, lastBindableObject))
+            {
+                return ImportResult::malformed;
+            }
+            continue;
+        }
+
+        // Only read the artboard itself so its name is available, the rest
+        // of its objects are indexed and loaded on demand.
+        LazyArtboard lazyArtboard;
+        if (object->import(importStack) == StatusCode::Ok)
+        {
+            Artboard* ab = object->as<Artboard>();
+            ab->m_Factory = m_factory;
+            m_artboards.push_back(ab);
+            lazyArtboard.artboard = ab;
+            inArtboard = true;
         }
         else
         {
@@ -330,181 +512,377 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
                     "Failed to import object of type %d\n",
                     object->coreType());
             delete object;
-            continue;
         }
-        std::unique_ptr<ImportStackObject> stackObject = nullptr;
-        auto stackType = object->coreType();
+        m_lazyArtboards.push_back(std::move(lazyArtboard));
+    }
+
+    return !reader.hasError() && importStack.resolve() == StatusCode::Ok
+               ? ImportResult::success
+               : ImportResult::malformed;
+}
 
-        switch (stackType)
+bool File::loadArtboard(Artboard* artboard) const
+{
+    if (m_lazyArtboards.empty())
+    {
+        return true;
+    }
+    std::unique_lock<std::recursive_mutex> lock(m_lazyMutex);
+    for (size_t i = 0; i < m_lazyArtboards.size(); i++)
+    {
+        if (m_lazyArtboards[i].artboard == artboard)
         {
-            case Backboard::typeKey:
-                stackObject = rivestd::make_unique<BackboardImporter>(
-                    object->as<Backboard>());
-                break;
-            case Artboard::typeKey:
-                stackObject = rivestd::make_unique<ArtboardImporter>(
-                    object->as<Artboard>());
-                break;
-            case DataEnumCustom::typeKey:
-                stackObject = rivestd::make_unique<EnumImporter>(
-                    object->as<DataEnumCustom>());
-                break;
-            case LinearAnimation::typeKey:
-                stackObject = rivestd::make_unique<LinearAnimationImporter>(
-                    object->as<LinearAnimation>());
-                break;
-            case KeyedObject::typeKey:
-                stackObject = rivestd::make_unique<KeyedObjectImporter>(
-                    object->as<KeyedObject>());
-                break;
-            case KeyedProperty::typeKey:
+            // Loading an artboard doesn't change what the file describes, it
+            // only fills in objects we deferred reading.
+            return const_cast<File*>(this)->loadLazyArtboard(i);
+        }
+    }
+    return true;
+}
+
+bool File::loadLazyArtboard(size_t lazyIndex)
+{
+    LazyArtboard& lazyArtboard = m_lazyArtboards[lazyIndex];
+    switch (lazyArtboard.state)
+    {
+        case LazyArtboardState::loaded:
+        // Nested artboards referencing each other, the cycle is broken by
+        // the artboard that's already loading.
+        case LazyArtboardState::loading:
+            return true;
+        case LazyArtboardState::failed:
+            return false;
+        case LazyArtboardState::unloaded:
+            break;
+    }
+    lazyArtboard.state = LazyArtboardState::loading;
+    Artboard* artboard = lazyArtboard.artboard;
+
+    // Rebuild the backboard importer's view of the file so the artboard's
+    // objects can resolve assets, converters, interpolators and other
+    // artboards.
+    auto backboardImporter =
+        rivestd::make_unique<BackboardImporter>(m_backboard);
+    for (const auto& lazy : m_lazyArtboards)
+    {
+        if (lazy.artboard != nullptr)
+        {
+            backboardImporter->addArtboard(lazy.artboard);
+        }
+        else
+        {
+            backboardImporter->addMissingArtboard();
+        }
+    }
+    for (auto asset : m_fileAssets)
+    {
+        backboardImporter->addImportedFileAsset(asset);
+    }
+    for (auto converter : m_DataConverters)
+    {
+        backboardImporter->addDataConverter(converter);
+    }
+    for (auto interpolator : m_keyframeInterpolators)
+    {
+        backboardImporter->addInterpolator(interpolator);
+    }
+    for (auto physics : m_scrollPhysics)
+    {
+        backboardImporter->addPhysics(physics);
+    }
+
+    ImportStack importStack;
+    importStack.makeLatest(Backboard::typeKey, std::move(backboardImporter));
+    importStack.makeLatest(Artboard::typeKey,
+                           rivestd::make_unique<ArtboardImporter>(artboard));
+
+    bool success = true;
+    Core* lastBindableObject = artboard;
+    for (const auto& range : lazyArtboard.ranges)
+    {
+        BinaryReader reader(
+            m_lazyData.subset(range.first, range.second - range.first));
+        while (success && !reader.reachedEnd())
+        {
+            success = importObject(readRuntimeObject(reader, *m_lazyHeader),
+                                   importStack,
+                                   lastBindableObject);
+        }
+        success = success && !reader.hasError();
+        if (!success)
+        {
+            break;
+        }
+    }
+    success = importStack.resolve() == StatusCode::Ok && success;
+
+    // Nested artboards instance their source artboard, make sure it's been
+    // read too.
+    if (success)
+    {
+        for (auto nestedArtboard : artboard->nestedArtboards())
+        {
+            auto source = nestedArtboard->sourceArtboard();
+            if (source != nullptr && !loadArtboard(source))
             {
-                auto importer = importStack.latest<LinearAnimationImporter>(
-                    LinearAnimation::typeKey);
-                if (importer == nullptr)
-                {
-                    return ImportResult::malformed;
-                }
-                stackObject = rivestd::make_unique<KeyedPropertyImporter>(
-                    importer->animation(),
-                    object->as<KeyedProperty>());
-                break;
+                success = false;
             }
-            case StateMachine::typeKey:
-                stackObject = rivestd::make_unique<StateMachineImporter>(
-                    object->as<StateMachine>());
-                break;
-            case StateMachineLayer::typeKey:
-            {
-                auto artboardImporter =
-                    importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
-                if (artboardImporter == nullptr)
-                {
-                    return ImportResult::malformed;
-                }
+        }
+    }
 
-                stackObject = rivestd::make_unique<StateMachineLayerImporter>(
-                    object->as<StateMachineLayer>(),
-                    artboardImporter->artboard());
+    lazyArtboard.ranges.clear();
+    lazyArtboard.ranges.shrink_to_fit();
+    lazyArtboard.state =
+        success ? LazyArtboardState::loaded : LazyArtboardState::failed;
+    return success;
+}
 
+bool File::importObject(Core* object,
+                        ImportStack& importStack,
+                        Core*& lastBindableObject)
+{
+    if (object == nullptr)
+    {
+        importStack.readNullObject();
+        return true;
+    }
+    if (!object->is<DataBind>())
+    {
+        lastBindableObject = object;
+    }
+    else if (lastBindableObject != nullptr)
+    {
+        object->as<DataBind>()->target(lastBindableObject);
+    }
+    if (object->import(importStack) == StatusCode::Ok)
+    {
+        switch (object->coreType())
+        {
+            case Backboard::typeKey:
+                m_backboard = object->as<Backboard>();
                 break;
+            case Artboard::typeKey:
+            {
+                Artboard* ab = object->as<Artboard>();
+                ab->m_Factory = m_factory;
+                m_artboards.push_back(ab);
             }
-            case EntryState::typeKey:
-            case ExitState::typeKey:
-            case AnyState::typeKey:
-            case AnimationState::typeKey:
-            case BlendState1DViewModel::typeKey:
-            case BlendState1DInput::typeKey:
-            case BlendStateDirect::typeKey:
-                stackObject = rivestd::make_unique<LayerStateImporter>(
-                    object->as<LayerState>());
-                stackType = LayerState::typeKey;
-                break;
-            case StateTransition::typeKey:
-            case BlendStateTransition::typeKey:
-                stackObject = rivestd::make_unique<StateTransitionImporter>(
-                    object->as<StateTransition>());
-                stackType = StateTransition::typeKey;
-                break;
-            case StateMachineListener::typeKey:
-                stackObject =
-                    rivestd::make_unique<StateMachineListenerImporter>(
-                        object->as<StateMachineListener>());
-                break;
+            break;
             case ImageAsset::typeKey:
             case FontAsset::typeKey:
             case AudioAsset::typeKey:
-                stackObject = rivestd::make_unique<FileAssetImporter>(
-                    object->as<FileAsset>(),
-                    m_assetLoader,
-                    m_factory);
-                stackType = FileAsset::typeKey;
-                break;
+            {
+                auto fa = object->as<FileAsset>();
+                m_fileAssets.push_back(fa);
+            }
+            break;
             case ViewModel::typeKey:
-                stackObject = rivestd::make_unique<ViewModelImporter>(
-                    object->as<ViewModel>());
-                stackType = ViewModel::typeKey;
+            {
+                auto vmc = object->as<ViewModel>();
+                m_ViewModels.push_back(vmc);
                 break;
+            }
             case ViewModelInstance::typeKey:
-                stackObject = rivestd::make_unique<ViewModelInstanceImporter>(
-                    object->as<ViewModelInstance>());
-                stackType = ViewModelInstance::typeKey;
-                break;
-            case ViewModelInstanceList::typeKey:
-                stackObject =
-                    rivestd::make_unique<ViewModelInstanceListImporter>(
-                        object->as<ViewModelInstanceList>());
-                stackType = ViewModelInstanceList::typeKey;
-                break;
-            case TransitionViewModelCondition::typeKey:
-            case TransitionArtboardCondition::typeKey:
-                stackObject =
-                    rivestd::make_unique<TransitionViewModelConditionImporter>(
-                        object->as<TransitionViewModelCondition>());
-                stackType = TransitionViewModelCondition::typeKey;
-                break;
-            case BindablePropertyNumber::typeKey:
-            case BindablePropertyString::typeKey:
-            case BindablePropertyColor::typeKey:
-            case BindablePropertyEnum::typeKey:
-            case BindablePropertyBoolean::typeKey:
-            case BindablePropertyTrigger::typeKey:
-                stackObject = rivestd::make_unique<BindablePropertyImporter>(
-                    object->as<BindableProperty>());
-                stackType = BindablePropertyBase::typeKey;
-                break;
-            case DataConverterGroupBase::typeKey:
-                stackObject = rivestd::make_unique<DataConverterGroupImporter>(
-                    object->as<DataConverterGroup>());
-                stackType = DataConverterGroupBase::typeKey;
+            {
+                auto vmi = object->as<ViewModelInstance>();
+                m_ViewModelInstances.push_back(vmi);
                 break;
-            case DataConverterFormulaBase::typeKey:
-                stackObject =
-                    rivestd::make_unique<DataConverterFormulaImporter>(
-                        object->as<DataConverterFormula>());
-                stackType = DataConverterFormulaBase::typeKey;
+            }
+            case DataEnum::typeKey:
+            case DataEnumCustom::typeKey:
+            {
+                auto de = object->as<DataEnum>();
+                m_Enums.push_back(de);
                 break;
+            }
+            case ViewModelPropertyEnumCustom::typeKey:
+            {
+                auto vme = object->as<ViewModelPropertyEnumCustom>();
+                if (vme->enumId() < m_Enums.size())
+                {
+                    vme->dataEnum(m_Enums[vme->enumId()]);
+                }
+            }
+            break;
         }
-        if (importStack.makeLatest(stackType, std::move(stackObject)) !=
-            StatusCode::Ok)
-        {
-            // Some previous stack item didn't resolve.
-            return ImportResult::malformed;
-        }
-        if (object->is<StateMachineLayerComponent>() &&
-            importStack.makeLatest(
-                StateMachineLayerComponent::typeKey,
-                rivestd::make_unique<StateMachineLayerComponentImporter>(
-                    object->as<StateMachineLayerComponent>())) !=
-                StatusCode::Ok)
-        {
-            return ImportResult::malformed;
-        }
-        if (object->is<DataConverter>())
+    }
+    else
+    {
+        fprintf(stderr,
+                "Failed to import object of type %d\n",
+                object->coreType());
+        delete object;
+        return true;
+    }
+    std::unique_ptr<ImportStackObject> stackObject = nullptr;
+    auto stackType = object->coreType();
+
+    switch (stackType)
+    {
+        case Backboard::typeKey:
+            stackObject = rivestd::make_unique<BackboardImporter>(
+                object->as<Backboard>());
+            break;
+        case Artboard::typeKey:
+            stackObject = rivestd::make_unique<ArtboardImporter>(
+                object->as<Artboard>());
+            break;
+        case DataEnumCustom::typeKey:
+            stackObject = rivestd::make_unique<EnumImporter>(
+                object->as<DataEnumCustom>());
+            break;
+        case LinearAnimation::typeKey:
+            stackObject = rivestd::make_unique<LinearAnimationImporter>(
+                object->as<LinearAnimation>());
+            break;
+        case KeyedObject::typeKey:
+            stackObject = rivestd::make_unique<KeyedObjectImporter>(
+                object->as<KeyedObject>());
+            break;
+        case KeyedProperty::typeKey:
         {
-            m_DataConverters.push_back(object->as<DataConverter>());
+            auto importer = importStack.latest<LinearAnimationImporter>(
+                LinearAnimation::typeKey);
+            if (importer == nullptr)
+            {
+                return false;
+            }
+            stackObject = rivestd::make_unique<KeyedPropertyImporter>(
+                importer->animation(),
+                object->as<KeyedProperty>());
+            break;
         }
-        else if (object->is<KeyFrameInterpolator>())
+        case StateMachine::typeKey:
+            stackObject = rivestd::make_unique<StateMachineImporter>(
+                object->as<StateMachine>());
+            break;
+        case StateMachineLayer::typeKey:
         {
-            // The file only owns the interpolators that don't belong to a
-            // specific artboard
             auto artboardImporter =
                 importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
             if (artboardImporter == nullptr)
             {
-                m_keyframeInterpolators.push_back(
-                    object->as<KeyFrameInterpolator>());
+                return false;
             }
+
+            stackObject = rivestd::make_unique<StateMachineLayerImporter>(
+                object->as<StateMachineLayer>(),
+                artboardImporter->artboard());
+
+            break;
         }
-        else if (object->is<ScrollPhysics>())
+        case EntryState::typeKey:
+        case ExitState::typeKey:
+        case AnyState::typeKey:
+        case AnimationState::typeKey:
+        case BlendState1DViewModel::typeKey:
+        case BlendState1DInput::typeKey:
+        case BlendStateDirect::typeKey:
+            stackObject = rivestd::make_unique<LayerStateImporter>(
+                object->as<LayerState>());
+            stackType = LayerState::typeKey;
+            break;
+        case StateTransition::typeKey:
+        case BlendStateTransition::typeKey:
+            stackObject = rivestd::make_unique<StateTransitionImporter>(
+                object->as<StateTransition>());
+            stackType = StateTransition::typeKey;
+            break;
+        case StateMachineListener::typeKey:
+            stackObject =
+                rivestd::make_unique<StateMachineListenerImporter>(
+                    object->as<StateMachineListener>());
+            break;
+        case ImageAsset::typeKey:
+        case FontAsset::typeKey:
+        case AudioAsset::typeKey:
+            stackObject = rivestd::make_unique<FileAssetImporter>(
+                object->as<FileAsset>(),
+                m_assetLoader,
+                m_factory);
+            stackType = FileAsset::typeKey;
+            break;
+        case ViewModel::typeKey:
+            stackObject = rivestd::make_unique<ViewModelImporter>(
+                object->as<ViewModel>());
+            stackType = ViewModel::typeKey;
+            break;
+        case ViewModelInstance::typeKey:
+            stackObject = rivestd::make_unique<ViewModelInstanceImporter>(
+                object->as<ViewModelInstance>());
+            stackType = ViewModelInstance::typeKey;
+            break;
+        case ViewModelInstanceList::typeKey:
+            stackObject =
+                rivestd::make_unique<ViewModelInstanceListImporter>(
+                    object->as<ViewModelInstanceList>());
+            stackType = ViewModelInstanceList::typeKey;
+            break;
+        case TransitionViewModelCondition::typeKey:
+        case TransitionArtboardCondition::typeKey:
+            stackObject =
+                rivestd::make_unique<TransitionViewModelConditionImporter>(
+                    object->as<TransitionViewModelCondition>());
+            stackType = TransitionViewModelCondition::typeKey;
+            break;
+        case BindablePropertyNumber::typeKey:
+        case BindablePropertyString::typeKey:
+        case BindablePropertyColor::typeKey:
+        case BindablePropertyEnum::typeKey:
+        case BindablePropertyBoolean::typeKey:
+        case BindablePropertyTrigger::typeKey:
+            stackObject = rivestd::make_unique<BindablePropertyImporter>(
+                object->as<BindableProperty>());
+            stackType = BindablePropertyBase::typeKey;
+            break;
+        case DataConverterGroupBase::typeKey:
+            stackObject = rivestd::make_unique<DataConverterGroupImporter>(
+                object->as<DataConverterGroup>());
+            stackType = DataConverterGroupBase::typeKey;
+            break;
+        case DataConverterFormulaBase::typeKey:
+            stackObject =
+                rivestd::make_unique<DataConverterFormulaImporter>(
+                    object->as<DataConverterFormula>());
+            stackType = DataConverterFormulaBase::typeKey;
+            break;
+    }
+    if (importStack.makeLatest(stackType, std::move(stackObject)) !=
+        StatusCode::Ok)
+    {
+        // Some previous stack item didn't resolve.
+        return false;
+    }
+    if (object->is<StateMachineLayerComponent>() &&
+        importStack.makeLatest(
+            StateMachineLayerComponent::typeKey,
+            rivestd::make_unique<StateMachineLayerComponentImporter>(
+                object->as<StateMachineLayerComponent>())) !=
+            StatusCode::Ok)
+    {
+        return false;
+    }
+    if (object->is<DataConverter>())
+    {
+        m_DataConverters.push_back(object->as<DataConverter>());
+    }
+    else if (object->is<KeyFrameInterpolator>())
+    {
+        // The file only owns the interpolators that don't belong to a
+        // specific artboard
+        auto artboardImporter =
+            importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
+        if (artboardImporter == nullptr)
         {
-            m_scrollPhysics.push_back(object->as<ScrollPhysics>());
+            m_keyframeInterpolators.push_back(
+                object->as<KeyFrameInterpolator>());
         }
     }
-
-    return !reader.hasError() && importStack.resolve() == StatusCode::Ok
-               ? ImportResult::success
-               : ImportResult::malformed;
+    else if (object->is<ScrollPhysics>())
+    {
+        m_scrollPhysics.push_back(object->as<ScrollPhysics>());
+    }
+    return true;
 }
 
 Artboard* File::artboard(std::string name) const
@@ -513,7 +891,7 @@ Artboard* File::artboard(std::string name) const
     {
         if (artboard->name() == name)
         {
-            return artboard;
+            return loadArtboard(artboard) ? artboard : nullptr;
         }
     }
     return nullptr;
@@ -521,26 +899,41 @@ Artboard* File::artboard(std::string name) const
 
 Artboard* File::artboard() const
 {
-    if (m_artboards.empty())
+    return artboard((size_t)0);
+}
+
+Artboard* File::artboard(size_t index) const
+{
+    if (index >= m_artboards.size())
     {
         return nullptr;
     }
-    return m_artboards[0];
+    auto ab = m_artboards[index];
+    return loadArtboard(ab) ? ab : nullptr;
 }
 
-Artboard* File::artboard(size_t index) const
+bool File::isArtboardLoaded(size_t index) const
 {
     if (index >= m_artboards.size())
     {
-        return nullptr;
+        return false;
+    }
+    // Another thread may be loading the artboard.
+    std::unique_lock<std::recursive_mutex> lock(m_lazyMutex);
+    for (const auto& lazy : m_lazyArtboards)
+    {
+        if (lazy.artboard == m_artboards[index])
+        {
+            return lazy.state == LazyArtboardState::loaded;
+        }
     }
-    return m_artboards[index];
+    return true;
 }
 
 std::string File::artboardNameAt(size_t index) const
 {
-    auto ab = this->artboard(index);
-    return ab ? ab->name() : "";
+    // The name is read up front, no need to load the artboard for it.
+    return index < m_artboards.size() ? m_artboards[index]->name() : "";
 }
 
 std::unique_ptr<ArtboardInstance> File::artboardDefault() const
@@ -634,9 +1027,10 @@ void File::completeViewModelInstance(
                     {
                         listItem->viewModelInstance(itr->second);
                     }
-                    if (listItem->artboardId() < m_artboards.size())
+                    auto artboard = this->artboard(listItem->artboardId());
+                    if (artboard != nullptr)
                     {
-                        listItem->artboard(m_artboards[listItem->artboardId()]);
+                        listItem->artboard(artboard);
                     }
                 }
             }
@@ -844,6 +1238,10 @@ ViewModelInstanceListItem* File::viewModelInstanceListItem(
     {
         if (artboard->viewModelId() == viewModelInstance->viewModelId())
         {
+            if (!loadArtboard(artboard))
+            {
+                return nullptr;
+            }
             return viewModelInstanceListItem(viewModelInstance, artboard);
         }
     }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/animation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/animation.hpp"
 
 using namespace rive;
 
 Core* AnimationBase::clone() const
 {
-    auto cloned = new Animation();
+    auto cloned = new (CoreArena::claimForClone()) Animation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/animation_state_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/animation_state.hpp"
 
 using namespace rive;
 
 Core* AnimationStateBase::clone() const
 {
-    auto cloned = new AnimationState();
+    auto cloned = new (CoreArena::claimForClone()) AnimationState();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/any_state_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/any_state.hpp"
 
 using namespace rive;
 
 Core* AnyStateBase::clone() const
 {
-    auto cloned = new AnyState();
+    auto cloned = new (CoreArena::claimForClone()) AnyState();
     cloned->copy(*this);
     return cloned;
 }
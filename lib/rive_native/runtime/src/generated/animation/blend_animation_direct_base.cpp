@@ -1,11 +1,12 @@
 #include "rive/generated/animation/blend_animation_direct_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/blend_animation_direct.hpp"
 
 using namespace rive;
 
 Core* BlendAnimationDirectBase::clone() const
 {
-    auto cloned = new BlendAnimationDirect();
+    auto cloned = new (CoreArena::claimForClone()) BlendAnimationDirect();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/blend_state_1d_input_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/blend_state_1d_input.hpp"
 
 using namespace rive;
 
 Core* BlendState1DInputBase::clone() const
 {
-    auto cloned = new BlendState1DInput();
+    auto cloned = new (CoreArena::claimForClone()) BlendState1DInput();
     cloned->copy(*this);
     return cloned;
 }
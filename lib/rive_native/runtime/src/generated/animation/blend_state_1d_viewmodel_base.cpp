@@ -1,11 +1,12 @@
 #include "rive/generated/animation/blend_state_1d_viewmodel_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/blend_state_1d_viewmodel.hpp"
 
 using namespace rive;
 
 Core* BlendState1DViewModelBase::clone() const
 {
-    auto cloned = new BlendState1DViewModel();
+    auto cloned = new (CoreArena::claimForClone()) BlendState1DViewModel();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/blend_state_direct_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/blend_state_direct.hpp"
 
 using namespace rive;
 
 Core* BlendStateDirectBase::clone() const
 {
-    auto cloned = new BlendStateDirect();
+    auto cloned = new (CoreArena::claimForClone()) BlendStateDirect();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/blend_state_transition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/blend_state_transition.hpp"
 
 using namespace rive;
 
 Core* BlendStateTransitionBase::clone() const
 {
-    auto cloned = new BlendStateTransition();
+    auto cloned = new (CoreArena::claimForClone()) BlendStateTransition();
     cloned->copy(*this);
     return cloned;
 }
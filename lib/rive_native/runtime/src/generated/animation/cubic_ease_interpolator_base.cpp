@@ -1,11 +1,12 @@
 #include "rive/generated/animation/cubic_ease_interpolator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/cubic_ease_interpolator.hpp"
 
 using namespace rive;
 
 Core* CubicEaseInterpolatorBase::clone() const
 {
-    auto cloned = new CubicEaseInterpolator();
+    auto cloned = new (CoreArena::claimForClone()) CubicEaseInterpolator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/cubic_interpolator_component_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/cubic_interpolator_component.hpp"
 
 using namespace rive;
 
 Core* CubicInterpolatorComponentBase::clone() const
 {
-    auto cloned = new CubicInterpolatorComponent();
+    auto cloned = new (CoreArena::claimForClone()) CubicInterpolatorComponent();
     cloned->copy(*this);
     return cloned;
 }
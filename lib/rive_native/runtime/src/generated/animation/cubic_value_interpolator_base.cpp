@@ -1,11 +1,12 @@
 #include "rive/generated/animation/cubic_value_interpolator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/cubic_value_interpolator.hpp"
 
 using namespace rive;
 
 Core* CubicValueInterpolatorBase::clone() const
 {
-    auto cloned = new CubicValueInterpolator();
+    auto cloned = new (CoreArena::claimForClone()) CubicValueInterpolator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/elastic_interpolator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/elastic_interpolator.hpp"
 
 using namespace rive;
 
 Core* ElasticInterpolatorBase::clone() const
 {
-    auto cloned = new ElasticInterpolator();
+    auto cloned = new (CoreArena::claimForClone()) ElasticInterpolator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/entry_state_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/entry_state.hpp"
 
 using namespace rive;
 
 Core* EntryStateBase::clone() const
 {
-    auto cloned = new EntryState();
+    auto cloned = new (CoreArena::claimForClone()) EntryState();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/exit_state_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/exit_state.hpp"
 
 using namespace rive;
 
 Core* ExitStateBase::clone() const
 {
-    auto cloned = new ExitState();
+    auto cloned = new (CoreArena::claimForClone()) ExitState();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyed_object_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyed_object.hpp"
 
 using namespace rive;
 
 Core* KeyedObjectBase::clone() const
 {
-    auto cloned = new KeyedObject();
+    auto cloned = new (CoreArena::claimForClone()) KeyedObject();
     cloned->copy(*this);
     return cloned;
 }
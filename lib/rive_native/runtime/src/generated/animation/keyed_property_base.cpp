@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyed_property_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyed_property.hpp"
 
 using namespace rive;
 
 Core* KeyedPropertyBase::clone() const
 {
-    auto cloned = new KeyedProperty();
+    auto cloned = new (CoreArena::claimForClone()) KeyedProperty();
     cloned->copy(*this);
     return cloned;
 }
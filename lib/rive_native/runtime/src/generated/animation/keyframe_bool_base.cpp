@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_bool_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_bool.hpp"
 
 using namespace rive;
 
 Core* KeyFrameBoolBase::clone() const
 {
-    auto cloned = new KeyFrameBool();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameBool();
     cloned->copy(*this);
     return cloned;
 }
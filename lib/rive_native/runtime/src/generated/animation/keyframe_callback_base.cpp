@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_callback_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_callback.hpp"
 
 using namespace rive;
 
 Core* KeyFrameCallbackBase::clone() const
 {
-    auto cloned = new KeyFrameCallback();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameCallback();
     cloned->copy(*this);
     return cloned;
 }
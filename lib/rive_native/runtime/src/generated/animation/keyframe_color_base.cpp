@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_color_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_color.hpp"
 
 using namespace rive;
 
 Core* KeyFrameColorBase::clone() const
 {
-    auto cloned = new KeyFrameColor();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameColor();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_double_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_double.hpp"
 
 using namespace rive;
 
 Core* KeyFrameDoubleBase::clone() const
 {
-    auto cloned = new KeyFrameDouble();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameDouble();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_id_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_id.hpp"
 
 using namespace rive;
 
 Core* KeyFrameIdBase::clone() const
 {
-    auto cloned = new KeyFrameId();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameId();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_string.hpp"
 
 using namespace rive;
 
 Core* KeyFrameStringBase::clone() const
 {
-    auto cloned = new KeyFrameString();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameString();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/keyframe_uint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/keyframe_uint.hpp"
 
 using namespace rive;
 
 Core* KeyFrameUintBase::clone() const
 {
-    auto cloned = new KeyFrameUint();
+    auto cloned = new (CoreArena::claimForClone()) KeyFrameUint();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/linear_animation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/linear_animation.hpp"
 
 using namespace rive;
 
 Core* LinearAnimationBase::clone() const
 {
-    auto cloned = new LinearAnimation();
+    auto cloned = new (CoreArena::claimForClone()) LinearAnimation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_align_target_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_align_target.hpp"
 
 using namespace rive;
 
 Core* ListenerAlignTargetBase::clone() const
 {
-    auto cloned = new ListenerAlignTarget();
+    auto cloned = new (CoreArena::claimForClone()) ListenerAlignTarget();
     cloned->copy(*this);
     return cloned;
 }
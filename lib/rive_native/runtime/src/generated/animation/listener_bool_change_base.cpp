@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_bool_change_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_bool_change.hpp"
 
 using namespace rive;
 
 Core* ListenerBoolChangeBase::clone() const
 {
-    auto cloned = new ListenerBoolChange();
+    auto cloned = new (CoreArena::claimForClone()) ListenerBoolChange();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_fire_event_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_fire_event.hpp"
 
 using namespace rive;
 
 Core* ListenerFireEventBase::clone() const
 {
-    auto cloned = new ListenerFireEvent();
+    auto cloned = new (CoreArena::claimForClone()) ListenerFireEvent();
     cloned->copy(*this);
     return cloned;
 }
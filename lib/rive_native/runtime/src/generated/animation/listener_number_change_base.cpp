@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_number_change_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_number_change.hpp"
 
 using namespace rive;
 
 Core* ListenerNumberChangeBase::clone() const
 {
-    auto cloned = new ListenerNumberChange();
+    auto cloned = new (CoreArena::claimForClone()) ListenerNumberChange();
     cloned->copy(*this);
     return cloned;
 }
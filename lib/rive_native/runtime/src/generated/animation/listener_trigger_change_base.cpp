@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_trigger_change_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_trigger_change.hpp"
 
 using namespace rive;
 
 Core* ListenerTriggerChangeBase::clone() const
 {
-    auto cloned = new ListenerTriggerChange();
+    auto cloned = new (CoreArena::claimForClone()) ListenerTriggerChange();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/listener_viewmodel_change_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/listener_viewmodel_change.hpp"
 
 using namespace rive;
 
 Core* ListenerViewModelChangeBase::clone() const
 {
-    auto cloned = new ListenerViewModelChange();
+    auto cloned = new (CoreArena::claimForClone()) ListenerViewModelChange();
     cloned->copy(*this);
     return cloned;
 }
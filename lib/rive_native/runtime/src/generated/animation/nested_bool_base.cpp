@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_bool_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_bool.hpp"
 
 using namespace rive;
 
 Core* NestedBoolBase::clone() const
 {
-    auto cloned = new NestedBool();
+    auto cloned = new (CoreArena::claimForClone()) NestedBool();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_number.hpp"
 
 using namespace rive;
 
 Core* NestedNumberBase::clone() const
 {
-    auto cloned = new NestedNumber();
+    auto cloned = new (CoreArena::claimForClone()) NestedNumber();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_remap_animation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_remap_animation.hpp"
 
 using namespace rive;
 
 Core* NestedRemapAnimationBase::clone() const
 {
-    auto cloned = new NestedRemapAnimation();
+    auto cloned = new (CoreArena::claimForClone()) NestedRemapAnimation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_simple_animation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_simple_animation.hpp"
 
 using namespace rive;
 
 Core* NestedSimpleAnimationBase::clone() const
 {
-    auto cloned = new NestedSimpleAnimation();
+    auto cloned = new (CoreArena::claimForClone()) NestedSimpleAnimation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_state_machine_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_state_machine.hpp"
 
 using namespace rive;
 
 Core* NestedStateMachineBase::clone() const
 {
-    auto cloned = new NestedStateMachine();
+    auto cloned = new (CoreArena::claimForClone()) NestedStateMachine();
     cloned->copy(*this);
     return cloned;
 }
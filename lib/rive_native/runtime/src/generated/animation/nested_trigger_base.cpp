@@ -1,11 +1,12 @@
 #include "rive/generated/animation/nested_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/nested_trigger.hpp"
 
 using namespace rive;
 
 Core* NestedTriggerBase::clone() const
 {
-    auto cloned = new NestedTrigger();
+    auto cloned = new (CoreArena::claimForClone()) NestedTrigger();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine.hpp"
 
 using namespace rive;
 
 Core* StateMachineBase::clone() const
 {
-    auto cloned = new StateMachine();
+    auto cloned = new (CoreArena::claimForClone()) StateMachine();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_bool_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_bool.hpp"
 
 using namespace rive;
 
 Core* StateMachineBoolBase::clone() const
 {
-    auto cloned = new StateMachineBool();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineBool();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_fire_event_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_fire_event.hpp"
 
 using namespace rive;
 
 Core* StateMachineFireEventBase::clone() const
 {
-    auto cloned = new StateMachineFireEvent();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineFireEvent();
     cloned->copy(*this);
     return cloned;
 }
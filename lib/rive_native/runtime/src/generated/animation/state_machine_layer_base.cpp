@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_layer_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_layer.hpp"
 
 using namespace rive;
 
 Core* StateMachineLayerBase::clone() const
 {
-    auto cloned = new StateMachineLayer();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineLayer();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_listener_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_listener.hpp"
 
 using namespace rive;
 
 Core* StateMachineListenerBase::clone() const
 {
-    auto cloned = new StateMachineListener();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineListener();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_number.hpp"
 
 using namespace rive;
 
 Core* StateMachineNumberBase::clone() const
 {
-    auto cloned = new StateMachineNumber();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineNumber();
     cloned->copy(*this);
     return cloned;
 }
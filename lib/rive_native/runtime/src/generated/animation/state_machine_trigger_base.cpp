@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_machine_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_machine_trigger.hpp"
 
 using namespace rive;
 
 Core* StateMachineTriggerBase::clone() const
 {
-    auto cloned = new StateMachineTrigger();
+    auto cloned = new (CoreArena::claimForClone()) StateMachineTrigger();
     cloned->copy(*this);
     return cloned;
 }
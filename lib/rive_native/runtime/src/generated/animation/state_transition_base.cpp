@@ -1,11 +1,12 @@
 #include "rive/generated/animation/state_transition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/state_transition.hpp"
 
 using namespace rive;
 
 Core* StateTransitionBase::clone() const
 {
-    auto cloned = new StateTransition();
+    auto cloned = new (CoreArena::claimForClone()) StateTransition();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_artboard_condition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_artboard_condition.hpp"
 
 using namespace rive;
 
 Core* TransitionArtboardConditionBase::clone() const
 {
-    auto cloned = new TransitionArtboardCondition();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionArtboardCondition();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/animation/transition_bool_condition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_bool_condition.hpp"
 
 using namespace rive;
 
 Core* TransitionBoolConditionBase::clone() const
 {
-    auto cloned = new TransitionBoolCondition();
+    auto cloned = new (CoreArena::claimForClone()) TransitionBoolCondition();
     cloned->copy(*this);
     return cloned;
 }
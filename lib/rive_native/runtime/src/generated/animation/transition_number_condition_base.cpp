@@ -1,11 +1,12 @@
 #include "rive/generated/animation/transition_number_condition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_number_condition.hpp"
 
 using namespace rive;
 
 Core* TransitionNumberConditionBase::clone() const
 {
-    auto cloned = new TransitionNumberCondition();
+    auto cloned = new (CoreArena::claimForClone()) TransitionNumberCondition();
     cloned->copy(*this);
     return cloned;
 }
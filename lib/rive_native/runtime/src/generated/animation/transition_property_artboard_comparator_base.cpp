@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_property_artboard_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_property_artboard_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionPropertyArtboardComparatorBase::clone() const
 {
-    auto cloned = new TransitionPropertyArtboardComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionPropertyArtboardComparator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_property_viewmodel_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_property_viewmodel_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionPropertyViewModelComparatorBase::clone() const
 {
-    auto cloned = new TransitionPropertyViewModelComparator();
+    auto cloned = new (CoreArena::claimForClone())
+        TransitionPropertyViewModelComparator();
     cloned->copy(*this);
     return cloned;
 }
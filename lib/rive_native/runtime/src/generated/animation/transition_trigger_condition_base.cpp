@@ -1,11 +1,12 @@
 #include "rive/generated/animation/transition_trigger_condition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_trigger_condition.hpp"
 
 using namespace rive;
 
 Core* TransitionTriggerConditionBase::clone() const
 {
-    auto cloned = new TransitionTriggerCondition();
+    auto cloned = new (CoreArena::claimForClone()) TransitionTriggerCondition();
     cloned->copy(*this);
     return cloned;
 }
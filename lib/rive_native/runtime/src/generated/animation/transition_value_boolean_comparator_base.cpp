@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_boolean_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_boolean_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueBooleanComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueBooleanComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueBooleanComparator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_color_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_color_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueColorComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueColorComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueColorComparator();
     cloned->copy(*this);
     return cloned;
 }
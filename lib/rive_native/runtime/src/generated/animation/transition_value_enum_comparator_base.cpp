@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_enum_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_enum_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueEnumComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueEnumComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueEnumComparator();
     cloned->copy(*this);
     return cloned;
 }
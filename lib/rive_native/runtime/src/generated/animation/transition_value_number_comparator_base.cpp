@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_number_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_number_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueNumberComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueNumberComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueNumberComparator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_string_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_string_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueStringComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueStringComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueStringComparator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_value_trigger_comparator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_value_trigger_comparator.hpp"
 
 using namespace rive;
 
 Core* TransitionValueTriggerComparatorBase::clone() const
 {
-    auto cloned = new TransitionValueTriggerComparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionValueTriggerComparator();
     cloned->copy(*this);
     return cloned;
 }
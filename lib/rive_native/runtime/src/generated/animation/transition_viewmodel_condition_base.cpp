@@ -1,11 +1,13 @@
 #include "rive/generated/animation/transition_viewmodel_condition_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/animation/transition_viewmodel_condition.hpp"
 
 using namespace rive;
 
 Core* TransitionViewModelConditionBase::clone() const
 {
-    auto cloned = new TransitionViewModelCondition();
+    auto cloned =
+        new (CoreArena::claimForClone()) TransitionViewModelCondition();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/artboard_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/artboard.hpp"
 
 using namespace rive;
 
 Core* ArtboardBase::clone() const
 {
-    auto cloned = new Artboard();
+    auto cloned = new (CoreArena::claimForClone()) Artboard();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/assets/audio_asset_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/assets/audio_asset.hpp"
 
 using namespace rive;
 
 Core* AudioAssetBase::clone() const
 {
-    auto cloned = new AudioAsset();
+    auto cloned = new (CoreArena::claimForClone()) AudioAsset();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/assets/file_asset_contents_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/assets/file_asset_contents.hpp"
 
 using namespace rive;
 
 Core* FileAssetContentsBase::clone() const
 {
-    auto cloned = new FileAssetContents();
+    auto cloned = new (CoreArena::claimForClone()) FileAssetContents();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/assets/folder_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/assets/folder.hpp"
 
 using namespace rive;
 
 Core* FolderBase::clone() const
 {
-    auto cloned = new Folder();
+    auto cloned = new (CoreArena::claimForClone()) Folder();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/assets/font_asset_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/assets/font_asset.hpp"
 
 using namespace rive;
 
 Core* FontAssetBase::clone() const
 {
-    auto cloned = new FontAsset();
+    auto cloned = new (CoreArena::claimForClone()) FontAsset();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/assets/image_asset_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/assets/image_asset.hpp"
 
 using namespace rive;
 
 Core* ImageAssetBase::clone() const
 {
-    auto cloned = new ImageAsset();
+    auto cloned = new (CoreArena::claimForClone()) ImageAsset();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/audio_event_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/audio_event.hpp"
 
 using namespace rive;
 
 Core* AudioEventBase::clone() const
 {
-    auto cloned = new AudioEvent();
+    auto cloned = new (CoreArena::claimForClone()) AudioEvent();
     cloned->copy(*this);
     return cloned;
 }
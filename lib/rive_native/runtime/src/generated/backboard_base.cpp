@@ -1,11 +1,12 @@
 #include "rive/generated/backboard_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/backboard.hpp"
 
 using namespace rive;
 
 Core* BackboardBase::clone() const
 {
-    auto cloned = new Backboard();
+    auto cloned = new (CoreArena::claimForClone()) Backboard();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/bones/bone_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/bone.hpp"
 
 using namespace rive;
 
 Core* BoneBase::clone() const
 {
-    auto cloned = new Bone();
+    auto cloned = new (CoreArena::claimForClone()) Bone();
     cloned->copy(*this);
     return cloned;
 }
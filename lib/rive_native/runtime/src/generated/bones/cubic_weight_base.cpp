@@ -1,11 +1,12 @@
 #include "rive/generated/bones/cubic_weight_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/cubic_weight.hpp"
 
 using namespace rive;
 
 Core* CubicWeightBase::clone() const
 {
-    auto cloned = new CubicWeight();
+    auto cloned = new (CoreArena::claimForClone()) CubicWeight();
     cloned->copy(*this);
     return cloned;
 }
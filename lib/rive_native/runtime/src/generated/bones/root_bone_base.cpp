@@ -1,11 +1,12 @@
 #include "rive/generated/bones/root_bone_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/root_bone.hpp"
 
 using namespace rive;
 
 Core* RootBoneBase::clone() const
 {
-    auto cloned = new RootBone();
+    auto cloned = new (CoreArena::claimForClone()) RootBone();
     cloned->copy(*this);
     return cloned;
 }
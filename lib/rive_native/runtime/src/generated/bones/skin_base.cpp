@@ -1,11 +1,12 @@
 #include "rive/generated/bones/skin_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/skin.hpp"
 
 using namespace rive;
 
 Core* SkinBase::clone() const
 {
-    auto cloned = new Skin();
+    auto cloned = new (CoreArena::claimForClone()) Skin();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/bones/tendon_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/tendon.hpp"
 
 using namespace rive;
 
 Core* TendonBase::clone() const
 {
-    auto cloned = new Tendon();
+    auto cloned = new (CoreArena::claimForClone()) Tendon();
     cloned->copy(*this);
     return cloned;
 }
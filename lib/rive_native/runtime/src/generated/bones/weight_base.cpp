@@ -1,11 +1,12 @@
 #include "rive/generated/bones/weight_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/bones/weight.hpp"
 
 using namespace rive;
 
 Core* WeightBase::clone() const
 {
-    auto cloned = new Weight();
+    auto cloned = new (CoreArena::claimForClone()) Weight();
     cloned->copy(*this);
     return cloned;
 }
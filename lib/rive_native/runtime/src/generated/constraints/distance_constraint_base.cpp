@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/distance_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/distance_constraint.hpp"
 
 using namespace rive;
 
 Core* DistanceConstraintBase::clone() const
 {
-    auto cloned = new DistanceConstraint();
+    auto cloned = new (CoreArena::claimForClone()) DistanceConstraint();
     cloned->copy(*this);
     return cloned;
 }
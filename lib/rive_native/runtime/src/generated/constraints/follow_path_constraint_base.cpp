@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/follow_path_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/follow_path_constraint.hpp"
 
 using namespace rive;
 
 Core* FollowPathConstraintBase::clone() const
 {
-    auto cloned = new FollowPathConstraint();
+    auto cloned = new (CoreArena::claimForClone()) FollowPathConstraint();
     cloned->copy(*this);
     return cloned;
 }
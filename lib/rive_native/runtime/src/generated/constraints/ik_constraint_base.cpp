@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/ik_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/ik_constraint.hpp"
 
 using namespace rive;
 
 Core* IKConstraintBase::clone() const
 {
-    auto cloned = new IKConstraint();
+    auto cloned = new (CoreArena::claimForClone()) IKConstraint();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/rotation_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/rotation_constraint.hpp"
 
 using namespace rive;
 
 Core* RotationConstraintBase::clone() const
 {
-    auto cloned = new RotationConstraint();
+    auto cloned = new (CoreArena::claimForClone()) RotationConstraint();
     cloned->copy(*this);
     return cloned;
 }
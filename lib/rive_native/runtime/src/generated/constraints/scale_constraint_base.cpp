@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/scale_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/scale_constraint.hpp"
 
 using namespace rive;
 
 Core* ScaleConstraintBase::clone() const
 {
-    auto cloned = new ScaleConstraint();
+    auto cloned = new (CoreArena::claimForClone()) ScaleConstraint();
     cloned->copy(*this);
     return cloned;
 }
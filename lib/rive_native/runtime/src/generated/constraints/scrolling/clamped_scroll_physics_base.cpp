@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/scrolling/clamped_scroll_physics_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/scrolling/clamped_scroll_physics.hpp"
 
 using namespace rive;
 
 Core* ClampedScrollPhysicsBase::clone() const
 {
-    auto cloned = new ClampedScrollPhysics();
+    auto cloned = new (CoreArena::claimForClone()) ClampedScrollPhysics();
     cloned->copy(*this);
     return cloned;
 }
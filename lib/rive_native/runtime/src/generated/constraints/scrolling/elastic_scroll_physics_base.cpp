@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/scrolling/elastic_scroll_physics_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/scrolling/elastic_scroll_physics.hpp"
 
 using namespace rive;
 
 Core* ElasticScrollPhysicsBase::clone() const
 {
-    auto cloned = new ElasticScrollPhysics();
+    auto cloned = new (CoreArena::claimForClone()) ElasticScrollPhysics();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/scrolling/scroll_bar_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/scrolling/scroll_bar_constraint.hpp"
 
 using namespace rive;
 
 Core* ScrollBarConstraintBase::clone() const
 {
-    auto cloned = new ScrollBarConstraint();
+    auto cloned = new (CoreArena::claimForClone()) ScrollBarConstraint();
     cloned->copy(*this);
     return cloned;
 }
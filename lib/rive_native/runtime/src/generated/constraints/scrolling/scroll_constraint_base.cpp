@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/scrolling/scroll_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/scrolling/scroll_constraint.hpp"
 
 using namespace rive;
 
 Core* ScrollConstraintBase::clone() const
 {
-    auto cloned = new ScrollConstraint();
+    auto cloned = new (CoreArena::claimForClone()) ScrollConstraint();
     cloned->copy(*this);
     return cloned;
 }
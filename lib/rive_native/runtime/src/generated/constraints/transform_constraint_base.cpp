@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/transform_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/transform_constraint.hpp"
 
 using namespace rive;
 
 Core* TransformConstraintBase::clone() const
 {
-    auto cloned = new TransformConstraint();
+    auto cloned = new (CoreArena::claimForClone()) TransformConstraint();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/constraints/translation_constraint_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/constraints/translation_constraint.hpp"
 
 using namespace rive;
 
 Core* TranslationConstraintBase::clone() const
 {
-    auto cloned = new TranslationConstraint();
+    auto cloned = new (CoreArena::claimForClone()) TranslationConstraint();
     cloned->copy(*this);
     return cloned;
 }
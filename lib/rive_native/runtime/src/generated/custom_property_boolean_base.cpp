@@ -1,11 +1,12 @@
 #include "rive/generated/custom_property_boolean_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/custom_property_boolean.hpp"
 
 using namespace rive;
 
 Core* CustomPropertyBooleanBase::clone() const
 {
-    auto cloned = new CustomPropertyBoolean();
+    auto cloned = new (CoreArena::claimForClone()) CustomPropertyBoolean();
     cloned->copy(*this);
     return cloned;
 }
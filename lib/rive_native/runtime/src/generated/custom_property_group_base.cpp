@@ -1,11 +1,12 @@
 #include "rive/generated/custom_property_group_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/custom_property_group.hpp"
 
 using namespace rive;
 
 Core* CustomPropertyGroupBase::clone() const
 {
-    auto cloned = new CustomPropertyGroup();
+    auto cloned = new (CoreArena::claimForClone()) CustomPropertyGroup();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/custom_property_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/custom_property_number.hpp"
 
 using namespace rive;
 
 Core* CustomPropertyNumberBase::clone() const
 {
-    auto cloned = new CustomPropertyNumber();
+    auto cloned = new (CoreArena::claimForClone()) CustomPropertyNumber();
     cloned->copy(*this);
     return cloned;
 }
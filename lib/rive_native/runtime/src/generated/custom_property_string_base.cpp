@@ -1,11 +1,12 @@
 #include "rive/generated/custom_property_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/custom_property_string.hpp"
 
 using namespace rive;
 
 Core* CustomPropertyStringBase::clone() const
 {
-    auto cloned = new CustomPropertyString();
+    auto cloned = new (CoreArena::claimForClone()) CustomPropertyString();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_boolean_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_boolean.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyBooleanBase::clone() const
 {
-    auto cloned = new BindablePropertyBoolean();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyBoolean();
     cloned->copy(*this);
     return cloned;
 }
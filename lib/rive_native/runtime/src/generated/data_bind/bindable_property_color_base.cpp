@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_color_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_color.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyColorBase::clone() const
 {
-    auto cloned = new BindablePropertyColor();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyColor();
     cloned->copy(*this);
     return cloned;
 }
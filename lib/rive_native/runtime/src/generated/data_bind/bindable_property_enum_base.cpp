@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_enum_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_enum.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyEnumBase::clone() const
 {
-    auto cloned = new BindablePropertyEnum();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyEnum();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_number.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyNumberBase::clone() const
 {
-    auto cloned = new BindablePropertyNumber();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyNumber();
     cloned->copy(*this);
     return cloned;
 }
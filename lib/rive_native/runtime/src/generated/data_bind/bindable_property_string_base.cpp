@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_string.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyStringBase::clone() const
 {
-    auto cloned = new BindablePropertyString();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyString();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/bindable_property_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/bindable_property_trigger.hpp"
 
 using namespace rive;
 
 Core* BindablePropertyTriggerBase::clone() const
 {
-    auto cloned = new BindablePropertyTrigger();
+    auto cloned = new (CoreArena::claimForClone()) BindablePropertyTrigger();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_formula_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_formula.hpp"
 
 using namespace rive;
 
 Core* DataConverterFormulaBase::clone() const
 {
-    auto cloned = new DataConverterFormula();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterFormula();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_operation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_operation.hpp"
 
 using namespace rive;
 
 Core* DataConverterOperationBase::clone() const
 {
-    auto cloned = new DataConverterOperation();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterOperation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/data_converter_operation_value_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_operation_value.hpp"
 
 using namespace rive;
 
 Core* DataConverterOperationValueBase::clone() const
 {
-    auto cloned = new DataConverterOperationValue();
+    auto cloned =
+        new (CoreArena::claimForClone()) DataConverterOperationValue();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/data_converter_operation_viewmodel_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_operation_viewmodel.hpp"
 
 using namespace rive;
 
 Core* DataConverterOperationViewModelBase::clone() const
 {
-    auto cloned = new DataConverterOperationViewModel();
+    auto cloned =
+        new (CoreArena::claimForClone()) DataConverterOperationViewModel();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_rounder_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_rounder.hpp"
 
 using namespace rive;
 
 Core* DataConverterRounderBase::clone() const
 {
-    auto cloned = new DataConverterRounder();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterRounder();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/data_converter_string_remove_zeros_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_string_remove_zeros.hpp"
 
 using namespace rive;
 
 Core* DataConverterStringRemoveZerosBase::clone() const
 {
-    auto cloned = new DataConverterStringRemoveZeros();
+    auto cloned =
+        new (CoreArena::claimForClone()) DataConverterStringRemoveZeros();
     cloned->copy(*this);
     return cloned;
 }
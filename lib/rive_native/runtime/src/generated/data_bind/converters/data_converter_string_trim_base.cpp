@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_string_trim_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_string_trim.hpp"
 
 using namespace rive;
 
 Core* DataConverterStringTrimBase::clone() const
 {
-    auto cloned = new DataConverterStringTrim();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterStringTrim();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/data_converter_system_degs_to_rads_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_system_degs_to_rads.hpp"
 
 using namespace rive;
 
 Core* DataConverterSystemDegsToRadsBase::clone() const
 {
-    auto cloned = new DataConverterSystemDegsToRads();
+    auto cloned =
+        new (CoreArena::claimForClone()) DataConverterSystemDegsToRads();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/data_converter_system_normalizer_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_system_normalizer.hpp"
 
 using namespace rive;
 
 Core* DataConverterSystemNormalizerBase::clone() const
 {
-    auto cloned = new DataConverterSystemNormalizer();
+    auto cloned =
+        new (CoreArena::claimForClone()) DataConverterSystemNormalizer();
     cloned->copy(*this);
     return cloned;
 }
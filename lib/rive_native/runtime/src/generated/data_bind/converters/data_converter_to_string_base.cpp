@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_to_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_to_string.hpp"
 
 using namespace rive;
 
 Core* DataConverterToStringBase::clone() const
 {
-    auto cloned = new DataConverterToString();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterToString();
     cloned->copy(*this);
     return cloned;
 }
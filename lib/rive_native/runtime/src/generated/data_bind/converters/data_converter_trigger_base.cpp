@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/data_converter_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/data_converter_trigger.hpp"
 
 using namespace rive;
 
 Core* DataConverterTriggerBase::clone() const
 {
-    auto cloned = new DataConverterTrigger();
+    auto cloned = new (CoreArena::claimForClone()) DataConverterTrigger();
     cloned->copy(*this);
     return cloned;
 }
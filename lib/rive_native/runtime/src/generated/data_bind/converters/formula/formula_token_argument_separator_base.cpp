@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_argument_separator_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token_argument_separator.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenArgumentSeparatorBase::clone() const
 {
-    auto cloned = new FormulaTokenArgumentSeparator();
+    auto cloned =
+        new (CoreArena::claimForClone()) FormulaTokenArgumentSeparator();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenBase::clone() const
 {
-    auto cloned = new FormulaToken();
+    auto cloned = new (CoreArena::claimForClone()) FormulaToken();
     cloned->copy(*this);
     return cloned;
 }
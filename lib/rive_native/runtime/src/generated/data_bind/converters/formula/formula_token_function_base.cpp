@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_function_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token_function.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenFunctionBase::clone() const
 {
-    auto cloned = new FormulaTokenFunction();
+    auto cloned = new (CoreArena::claimForClone()) FormulaTokenFunction();
     cloned->copy(*this);
     return cloned;
 }
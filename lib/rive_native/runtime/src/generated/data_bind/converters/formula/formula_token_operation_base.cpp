@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_operation_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token_operation.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenOperationBase::clone() const
 {
-    auto cloned = new FormulaTokenOperation();
+    auto cloned = new (CoreArena::claimForClone()) FormulaTokenOperation();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_parenthesis_close_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token_parenthesis_close.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenParenthesisCloseBase::clone() const
 {
-    auto cloned = new FormulaTokenParenthesisClose();
+    auto cloned =
+        new (CoreArena::claimForClone()) FormulaTokenParenthesisClose();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/data_bind/converters/formula/formula_token_parenthesis_open_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/converters/formula/formula_token_parenthesis_open.hpp"
 
 using namespace rive;
 
 Core* FormulaTokenParenthesisOpenBase::clone() const
 {
-    auto cloned = new FormulaTokenParenthesisOpen();
+    auto cloned =
+        new (CoreArena::claimForClone()) FormulaTokenParenthesisOpen();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/data_bind_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/data_bind.hpp"
 
 using namespace rive;
 
 Core* DataBindBase::clone() const
 {
-    auto cloned = new DataBind();
+    auto cloned = new (CoreArena::claimForClone()) DataBind();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/data_bind/data_bind_context_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/data_bind_context.hpp"
 
 using namespace rive;
 
 Core* DataBindContextBase::clone() const
 {
-    auto cloned = new DataBindContext();
+    auto cloned = new (CoreArena::claimForClone()) DataBindContext();
     cloned->copy(*this);
     return cloned;
 }
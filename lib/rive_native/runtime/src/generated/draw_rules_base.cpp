@@ -1,11 +1,12 @@
 #include "rive/generated/draw_rules_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/draw_rules.hpp"
 
 using namespace rive;
 
 Core* DrawRulesBase::clone() const
 {
-    auto cloned = new DrawRules();
+    auto cloned = new (CoreArena::claimForClone()) DrawRules();
     cloned->copy(*this);
     return cloned;
 }
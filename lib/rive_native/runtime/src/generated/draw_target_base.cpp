@@ -1,11 +1,12 @@
 #include "rive/generated/draw_target_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/draw_target.hpp"
 
 using namespace rive;
 
 Core* DrawTargetBase::clone() const
 {
-    auto cloned = new DrawTarget();
+    auto cloned = new (CoreArena::claimForClone()) DrawTarget();
     cloned->copy(*this);
     return cloned;
 }
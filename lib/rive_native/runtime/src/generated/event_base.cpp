@@ -1,11 +1,12 @@
 #include "rive/generated/event_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/event.hpp"
 
 using namespace rive;
 
 Core* EventBase::clone() const
 {
-    auto cloned = new Event();
+    auto cloned = new (CoreArena::claimForClone()) Event();
     cloned->copy(*this);
     return cloned;
 }
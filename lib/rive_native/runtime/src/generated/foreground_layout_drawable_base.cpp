@@ -1,11 +1,12 @@
 #include "rive/generated/foreground_layout_drawable_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/foreground_layout_drawable.hpp"
 
 using namespace rive;
 
 Core* ForegroundLayoutDrawableBase::clone() const
 {
-    auto cloned = new ForegroundLayoutDrawable();
+    auto cloned = new (CoreArena::claimForClone()) ForegroundLayoutDrawable();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/joystick_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/joystick.hpp"
 
 using namespace rive;
 
 Core* JoystickBase::clone() const
 {
-    auto cloned = new Joystick();
+    auto cloned = new (CoreArena::claimForClone()) Joystick();
     cloned->copy(*this);
     return cloned;
 }
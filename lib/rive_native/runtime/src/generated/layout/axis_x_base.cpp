@@ -1,11 +1,12 @@
 #include "rive/generated/layout/axis_x_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/axis_x.hpp"
 
 using namespace rive;
 
 Core* AxisXBase::clone() const
 {
-    auto cloned = new AxisX();
+    auto cloned = new (CoreArena::claimForClone()) AxisX();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/layout/axis_y_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/axis_y.hpp"
 
 using namespace rive;
 
 Core* AxisYBase::clone() const
 {
-    auto cloned = new AxisY();
+    auto cloned = new (CoreArena::claimForClone()) AxisY();
     cloned->copy(*this);
     return cloned;
 }
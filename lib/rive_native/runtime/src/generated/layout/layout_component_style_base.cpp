@@ -1,11 +1,12 @@
 #include "rive/generated/layout/layout_component_style_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/layout_component_style.hpp"
 
 using namespace rive;
 
 Core* LayoutComponentStyleBase::clone() const
 {
-    auto cloned = new LayoutComponentStyle();
+    auto cloned = new (CoreArena::claimForClone()) LayoutComponentStyle();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/layout/n_sliced_node_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/n_sliced_node.hpp"
 
 using namespace rive;
 
 Core* NSlicedNodeBase::clone() const
 {
-    auto cloned = new NSlicedNode();
+    auto cloned = new (CoreArena::claimForClone()) NSlicedNode();
     cloned->copy(*this);
     return cloned;
 }
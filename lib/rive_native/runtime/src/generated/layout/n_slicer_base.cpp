@@ -1,11 +1,12 @@
 #include "rive/generated/layout/n_slicer_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/n_slicer.hpp"
 
 using namespace rive;
 
 Core* NSlicerBase::clone() const
 {
-    auto cloned = new NSlicer();
+    auto cloned = new (CoreArena::claimForClone()) NSlicer();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/layout/n_slicer_tile_mode_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout/n_slicer_tile_mode.hpp"
 
 using namespace rive;
 
 Core* NSlicerTileModeBase::clone() const
 {
-    auto cloned = new NSlicerTileMode();
+    auto cloned = new (CoreArena::claimForClone()) NSlicerTileMode();
     cloned->copy(*this);
     return cloned;
 }
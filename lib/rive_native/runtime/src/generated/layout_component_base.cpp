@@ -1,11 +1,12 @@
 #include "rive/generated/layout_component_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/layout_component.hpp"
 
 using namespace rive;
 
 Core* LayoutComponentBase::clone() const
 {
-    auto cloned = new LayoutComponent();
+    auto cloned = new (CoreArena::claimForClone()) LayoutComponent();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/nested_artboard_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/nested_artboard.hpp"
 
 using namespace rive;
 
 Core* NestedArtboardBase::clone() const
 {
-    auto cloned = new NestedArtboard();
+    auto cloned = new (CoreArena::claimForClone()) NestedArtboard();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/nested_artboard_layout_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/nested_artboard_layout.hpp"
 
 using namespace rive;
 
 Core* NestedArtboardLayoutBase::clone() const
 {
-    auto cloned = new NestedArtboardLayout();
+    auto cloned = new (CoreArena::claimForClone()) NestedArtboardLayout();
     cloned->copy(*this);
     return cloned;
 }
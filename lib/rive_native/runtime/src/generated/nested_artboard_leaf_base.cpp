@@ -1,11 +1,12 @@
 #include "rive/generated/nested_artboard_leaf_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/nested_artboard_leaf.hpp"
 
 using namespace rive;
 
 Core* NestedArtboardLeafBase::clone() const
 {
-    auto cloned = new NestedArtboardLeaf();
+    auto cloned = new (CoreArena::claimForClone()) NestedArtboardLeaf();
     cloned->copy(*this);
     return cloned;
 }
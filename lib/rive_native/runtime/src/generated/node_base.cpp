@@ -1,11 +1,12 @@
 #include "rive/generated/node_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/node.hpp"
 
 using namespace rive;
 
 Core* NodeBase::clone() const
 {
-    auto cloned = new Node();
+    auto cloned = new (CoreArena::claimForClone()) Node();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/open_url_event_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/open_url_event.hpp"
 
 using namespace rive;
 
 Core* OpenUrlEventBase::clone() const
 {
-    auto cloned = new OpenUrlEvent();
+    auto cloned = new (CoreArena::claimForClone()) OpenUrlEvent();
     cloned->copy(*this);
     return cloned;
 }
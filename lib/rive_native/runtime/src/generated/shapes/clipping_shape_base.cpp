@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/clipping_shape_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/clipping_shape.hpp"
 
 using namespace rive;
 
 Core* ClippingShapeBase::clone() const
 {
-    auto cloned = new ClippingShape();
+    auto cloned = new (CoreArena::claimForClone()) ClippingShape();
     cloned->copy(*this);
     return cloned;
 }
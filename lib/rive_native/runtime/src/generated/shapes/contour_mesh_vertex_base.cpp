@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/contour_mesh_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/contour_mesh_vertex.hpp"
 
 using namespace rive;
 
 Core* ContourMeshVertexBase::clone() const
 {
-    auto cloned = new ContourMeshVertex();
+    auto cloned = new (CoreArena::claimForClone()) ContourMeshVertex();
     cloned->copy(*this);
     return cloned;
 }
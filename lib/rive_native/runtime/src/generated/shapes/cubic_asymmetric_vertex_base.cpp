@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/cubic_asymmetric_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/cubic_asymmetric_vertex.hpp"
 
 using namespace rive;
 
 Core* CubicAsymmetricVertexBase::clone() const
 {
-    auto cloned = new CubicAsymmetricVertex();
+    auto cloned = new (CoreArena::claimForClone()) CubicAsymmetricVertex();
     cloned->copy(*this);
     return cloned;
 }
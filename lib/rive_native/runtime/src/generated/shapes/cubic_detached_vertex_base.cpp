@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/cubic_detached_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/cubic_detached_vertex.hpp"
 
 using namespace rive;
 
 Core* CubicDetachedVertexBase::clone() const
 {
-    auto cloned = new CubicDetachedVertex();
+    auto cloned = new (CoreArena::claimForClone()) CubicDetachedVertex();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/cubic_mirrored_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/cubic_mirrored_vertex.hpp"
 
 using namespace rive;
 
 Core* CubicMirroredVertexBase::clone() const
 {
-    auto cloned = new CubicMirroredVertex();
+    auto cloned = new (CoreArena::claimForClone()) CubicMirroredVertex();
     cloned->copy(*this);
     return cloned;
 }
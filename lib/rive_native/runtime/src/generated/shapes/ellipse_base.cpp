@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/ellipse_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/ellipse.hpp"
 
 using namespace rive;
 
 Core* EllipseBase::clone() const
 {
-    auto cloned = new Ellipse();
+    auto cloned = new (CoreArena::claimForClone()) Ellipse();
     cloned->copy(*this);
     return cloned;
 }
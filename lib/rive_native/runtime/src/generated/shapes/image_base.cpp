@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/image_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/image.hpp"
 
 using namespace rive;
 
 Core* ImageBase::clone() const
 {
-    auto cloned = new Image();
+    auto cloned = new (CoreArena::claimForClone()) Image();
     cloned->copy(*this);
     return cloned;
 }
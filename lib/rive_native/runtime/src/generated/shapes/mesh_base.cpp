@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/mesh_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/mesh.hpp"
 
 using namespace rive;
 
 Core* MeshBase::clone() const
 {
-    auto cloned = new Mesh();
+    auto cloned = new (CoreArena::claimForClone()) Mesh();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/mesh_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/mesh_vertex.hpp"
 
 using namespace rive;
 
 Core* MeshVertexBase::clone() const
 {
-    auto cloned = new MeshVertex();
+    auto cloned = new (CoreArena::claimForClone()) MeshVertex();
     cloned->copy(*this);
     return cloned;
 }
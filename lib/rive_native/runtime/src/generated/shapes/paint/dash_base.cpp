@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/dash_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/dash.hpp"
 
 using namespace rive;
 
 Core* DashBase::clone() const
 {
-    auto cloned = new Dash();
+    auto cloned = new (CoreArena::claimForClone()) Dash();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/dash_path_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/dash_path.hpp"
 
 using namespace rive;
 
 Core* DashPathBase::clone() const
 {
-    auto cloned = new DashPath();
+    auto cloned = new (CoreArena::claimForClone()) DashPath();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/feather_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/feather.hpp"
 
 using namespace rive;
 
 Core* FeatherBase::clone() const
 {
-    auto cloned = new Feather();
+    auto cloned = new (CoreArena::claimForClone()) Feather();
     cloned->copy(*this);
     return cloned;
 }
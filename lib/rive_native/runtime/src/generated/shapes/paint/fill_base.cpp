@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/fill_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/fill.hpp"
 
 using namespace rive;
 
 Core* FillBase::clone() const
 {
-    auto cloned = new Fill();
+    auto cloned = new (CoreArena::claimForClone()) Fill();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/gradient_stop_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/gradient_stop.hpp"
 
 using namespace rive;
 
 Core* GradientStopBase::clone() const
 {
-    auto cloned = new GradientStop();
+    auto cloned = new (CoreArena::claimForClone()) GradientStop();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/linear_gradient_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/linear_gradient.hpp"
 
 using namespace rive;
 
 Core* LinearGradientBase::clone() const
 {
-    auto cloned = new LinearGradient();
+    auto cloned = new (CoreArena::claimForClone()) LinearGradient();
     cloned->copy(*this);
     return cloned;
 }
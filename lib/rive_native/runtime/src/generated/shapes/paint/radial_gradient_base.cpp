@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/radial_gradient_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/radial_gradient.hpp"
 
 using namespace rive;
 
 Core* RadialGradientBase::clone() const
 {
-    auto cloned = new RadialGradient();
+    auto cloned = new (CoreArena::claimForClone()) RadialGradient();
     cloned->copy(*this);
     return cloned;
 }
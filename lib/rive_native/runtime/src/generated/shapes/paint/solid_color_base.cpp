@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/solid_color_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/solid_color.hpp"
 
 using namespace rive;
 
 Core* SolidColorBase::clone() const
 {
-    auto cloned = new SolidColor();
+    auto cloned = new (CoreArena::claimForClone()) SolidColor();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/stroke_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/stroke.hpp"
 
 using namespace rive;
 
 Core* StrokeBase::clone() const
 {
-    auto cloned = new Stroke();
+    auto cloned = new (CoreArena::claimForClone()) Stroke();
     cloned->copy(*this);
     return cloned;
 }
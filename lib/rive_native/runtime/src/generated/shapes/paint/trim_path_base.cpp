@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/paint/trim_path_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/paint/trim_path.hpp"
 
 using namespace rive;
 
 Core* TrimPathBase::clone() const
 {
-    auto cloned = new TrimPath();
+    auto cloned = new (CoreArena::claimForClone()) TrimPath();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/points_path_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/points_path.hpp"
 
 using namespace rive;
 
 Core* PointsPathBase::clone() const
 {
-    auto cloned = new PointsPath();
+    auto cloned = new (CoreArena::claimForClone()) PointsPath();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/polygon_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/polygon.hpp"
 
 using namespace rive;
 
 Core* PolygonBase::clone() const
 {
-    auto cloned = new Polygon();
+    auto cloned = new (CoreArena::claimForClone()) Polygon();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/rectangle_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/rectangle.hpp"
 
 using namespace rive;
 
 Core* RectangleBase::clone() const
 {
-    auto cloned = new Rectangle();
+    auto cloned = new (CoreArena::claimForClone()) Rectangle();
     cloned->copy(*this);
     return cloned;
 }
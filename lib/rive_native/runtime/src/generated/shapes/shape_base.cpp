@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/shape_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/shape.hpp"
 
 using namespace rive;
 
 Core* ShapeBase::clone() const
 {
-    auto cloned = new Shape();
+    auto cloned = new (CoreArena::claimForClone()) Shape();
     cloned->copy(*this);
     return cloned;
 }
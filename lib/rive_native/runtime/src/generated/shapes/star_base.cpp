@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/star_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/star.hpp"
 
 using namespace rive;
 
 Core* StarBase::clone() const
 {
-    auto cloned = new Star();
+    auto cloned = new (CoreArena::claimForClone()) Star();
     cloned->copy(*this);
     return cloned;
 }
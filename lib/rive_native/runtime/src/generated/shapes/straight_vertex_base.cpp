@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/straight_vertex_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/straight_vertex.hpp"
 
 using namespace rive;
 
 Core* StraightVertexBase::clone() const
 {
-    auto cloned = new StraightVertex();
+    auto cloned = new (CoreArena::claimForClone()) StraightVertex();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/shapes/triangle_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/shapes/triangle.hpp"
 
 using namespace rive;
 
 Core* TriangleBase::clone() const
 {
-    auto cloned = new Triangle();
+    auto cloned = new (CoreArena::claimForClone()) Triangle();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/solo_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/solo.hpp"
 
 using namespace rive;
 
 Core* SoloBase::clone() const
 {
-    auto cloned = new Solo();
+    auto cloned = new (CoreArena::claimForClone()) Solo();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text.hpp"
 
 using namespace rive;
 
 Core* TextBase::clone() const
 {
-    auto cloned = new Text();
+    auto cloned = new (CoreArena::claimForClone()) Text();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_follow_path_modifier_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_follow_path_modifier.hpp"
 
 using namespace rive;
 
 Core* TextFollowPathModifierBase::clone() const
 {
-    auto cloned = new TextFollowPathModifier();
+    auto cloned = new (CoreArena::claimForClone()) TextFollowPathModifier();
     cloned->copy(*this);
     return cloned;
 }
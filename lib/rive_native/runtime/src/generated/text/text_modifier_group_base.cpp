@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_modifier_group_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_modifier_group.hpp"
 
 using namespace rive;
 
 Core* TextModifierGroupBase::clone() const
 {
-    auto cloned = new TextModifierGroup();
+    auto cloned = new (CoreArena::claimForClone()) TextModifierGroup();
     cloned->copy(*this);
     return cloned;
 }
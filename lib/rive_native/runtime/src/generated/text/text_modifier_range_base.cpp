@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_modifier_range_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_modifier_range.hpp"
 
 using namespace rive;
 
 Core* TextModifierRangeBase::clone() const
 {
-    auto cloned = new TextModifierRange();
+    auto cloned = new (CoreArena::claimForClone()) TextModifierRange();
     cloned->copy(*this);
     return cloned;
 }
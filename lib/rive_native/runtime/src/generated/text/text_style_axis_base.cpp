@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_style_axis_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_style_axis.hpp"
 
 using namespace rive;
 
 Core* TextStyleAxisBase::clone() const
 {
-    auto cloned = new TextStyleAxis();
+    auto cloned = new (CoreArena::claimForClone()) TextStyleAxis();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_style_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_style.hpp"
 
 using namespace rive;
 
 Core* TextStyleBase::clone() const
 {
-    auto cloned = new TextStyle();
+    auto cloned = new (CoreArena::claimForClone()) TextStyle();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_style_feature_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_style_feature.hpp"
 
 using namespace rive;
 
 Core* TextStyleFeatureBase::clone() const
 {
-    auto cloned = new TextStyleFeature();
+    auto cloned = new (CoreArena::claimForClone()) TextStyleFeature();
     cloned->copy(*this);
     return cloned;
 }
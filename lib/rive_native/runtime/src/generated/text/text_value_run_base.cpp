@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_value_run_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_value_run.hpp"
 
 using namespace rive;
 
 Core* TextValueRunBase::clone() const
 {
-    auto cloned = new TextValueRun();
+    auto cloned = new (CoreArena::claimForClone()) TextValueRun();
     cloned->copy(*this);
     return cloned;
 }
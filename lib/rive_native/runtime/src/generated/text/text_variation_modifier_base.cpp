@@ -1,11 +1,12 @@
 #include "rive/generated/text/text_variation_modifier_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/text/text_variation_modifier.hpp"
 
 using namespace rive;
 
 Core* TextVariationModifierBase::clone() const
 {
-    auto cloned = new TextVariationModifier();
+    auto cloned = new (CoreArena::claimForClone()) TextVariationModifier();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/data_enum_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/data_enum.hpp"
 
 using namespace rive;
 
 Core* DataEnumBase::clone() const
 {
-    auto cloned = new DataEnum();
+    auto cloned = new (CoreArena::claimForClone()) DataEnum();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/data_enum_custom_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/data_enum_custom.hpp"
 
 using namespace rive;
 
 Core* DataEnumCustomBase::clone() const
 {
-    auto cloned = new DataEnumCustom();
+    auto cloned = new (CoreArena::claimForClone()) DataEnumCustom();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/data_enum_system_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/data_enum_system.hpp"
 
 using namespace rive;
 
 Core* DataEnumSystemBase::clone() const
 {
-    auto cloned = new DataEnumSystem();
+    auto cloned = new (CoreArena::claimForClone()) DataEnumSystem();
     cloned->copy(*this);
     return cloned;
 }
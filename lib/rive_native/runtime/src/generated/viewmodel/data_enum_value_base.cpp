@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/data_enum_value_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/data_enum_value.hpp"
 
 using namespace rive;
 
 Core* DataEnumValueBase::clone() const
 {
-    auto cloned = new DataEnumValue();
+    auto cloned = new (CoreArena::claimForClone()) DataEnumValue();
     cloned->copy(*this);
     return cloned;
 }
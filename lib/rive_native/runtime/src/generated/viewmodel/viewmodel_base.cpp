@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
 
 using namespace rive;
 
 Core* ViewModelBase::clone() const
 {
-    auto cloned = new ViewModel();
+    auto cloned = new (CoreArena::claimForClone()) ViewModel();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_component_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_component.hpp"
 
 using namespace rive;
 
 Core* ViewModelComponentBase::clone() const
 {
-    auto cloned = new ViewModelComponent();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelComponent();
     cloned->copy(*this);
     return cloned;
 }
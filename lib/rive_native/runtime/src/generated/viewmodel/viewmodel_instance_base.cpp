@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceBase::clone() const
 {
-    auto cloned = new ViewModelInstance();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstance();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_boolean_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_boolean.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceBooleanBase::clone() const
 {
-    auto cloned = new ViewModelInstanceBoolean();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceBoolean();
     cloned->copy(*this);
     return cloned;
 }
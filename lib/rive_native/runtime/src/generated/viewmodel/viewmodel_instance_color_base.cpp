@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_color_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_color.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceColorBase::clone() const
 {
-    auto cloned = new ViewModelInstanceColor();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceColor();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_enum_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_enum.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceEnumBase::clone() const
 {
-    auto cloned = new ViewModelInstanceEnum();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceEnum();
     cloned->copy(*this);
     return cloned;
 }
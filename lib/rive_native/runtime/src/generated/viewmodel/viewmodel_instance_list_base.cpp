@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_list_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_list.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceListBase::clone() const
 {
-    auto cloned = new ViewModelInstanceList();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceList();
     cloned->copy(*this);
     return cloned;
 }
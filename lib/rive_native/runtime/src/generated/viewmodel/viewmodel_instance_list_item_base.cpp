@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_list_item_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_list_item.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceListItemBase::clone() const
 {
-    auto cloned = new ViewModelInstanceListItem();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceListItem();
     cloned->copy(*this);
     return cloned;
 }
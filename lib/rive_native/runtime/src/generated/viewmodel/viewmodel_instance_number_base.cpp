@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_number.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceNumberBase::clone() const
 {
-    auto cloned = new ViewModelInstanceNumber();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceNumber();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_string.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceStringBase::clone() const
 {
-    auto cloned = new ViewModelInstanceString();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceString();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_trigger.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceTriggerBase::clone() const
 {
-    auto cloned = new ViewModelInstanceTrigger();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceTrigger();
     cloned->copy(*this);
     return cloned;
 }
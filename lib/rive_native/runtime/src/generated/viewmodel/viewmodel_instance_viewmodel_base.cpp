@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_instance_viewmodel_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
 
 using namespace rive;
 
 Core* ViewModelInstanceViewModelBase::clone() const
 {
-    auto cloned = new ViewModelInstanceViewModel();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceViewModel();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyBase::clone() const
 {
-    auto cloned = new ViewModelProperty();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelProperty();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_boolean_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_boolean.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyBooleanBase::clone() const
 {
-    auto cloned = new ViewModelPropertyBoolean();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyBoolean();
     cloned->copy(*this);
     return cloned;
 }
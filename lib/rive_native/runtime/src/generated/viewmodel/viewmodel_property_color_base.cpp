@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_color_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_color.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyColorBase::clone() const
 {
-    auto cloned = new ViewModelPropertyColor();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyColor();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_enum_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_enum.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyEnumBase::clone() const
 {
-    auto cloned = new ViewModelPropertyEnum();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyEnum();
     cloned->copy(*this);
     return cloned;
 }
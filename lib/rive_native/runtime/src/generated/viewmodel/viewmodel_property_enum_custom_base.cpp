@@ -1,11 +1,13 @@
 #include "rive/generated/viewmodel/viewmodel_property_enum_custom_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_enum_custom.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyEnumCustomBase::clone() const
 {
-    auto cloned = new ViewModelPropertyEnumCustom();
+    auto cloned =
+        new (CoreArena::claimForClone()) ViewModelPropertyEnumCustom();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,13 @@
 #include "rive/generated/viewmodel/viewmodel_property_enum_system_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_enum_system.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyEnumSystemBase::clone() const
 {
-    auto cloned = new ViewModelPropertyEnumSystem();
+    auto cloned =
+        new (CoreArena::claimForClone()) ViewModelPropertyEnumSystem();
     cloned->copy(*this);
     return cloned;
 }
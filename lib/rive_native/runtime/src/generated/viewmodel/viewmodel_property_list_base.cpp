@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_list_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_list.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyListBase::clone() const
 {
-    auto cloned = new ViewModelPropertyList();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyList();
     cloned->copy(*this);
     return cloned;
 }
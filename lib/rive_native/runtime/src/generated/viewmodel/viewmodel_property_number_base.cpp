@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_number_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_number.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyNumberBase::clone() const
 {
-    auto cloned = new ViewModelPropertyNumber();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyNumber();
     cloned->copy(*this);
     return cloned;
 }
@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_string_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_string.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyStringBase::clone() const
 {
-    auto cloned = new ViewModelPropertyString();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyString();
     cloned->copy(*this);
     return cloned;
 }
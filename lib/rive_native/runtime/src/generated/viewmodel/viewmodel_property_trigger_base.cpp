@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_trigger_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_trigger.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyTriggerBase::clone() const
 {
-    auto cloned = new ViewModelPropertyTrigger();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyTrigger();
     cloned->copy(*this);
     return cloned;
 }
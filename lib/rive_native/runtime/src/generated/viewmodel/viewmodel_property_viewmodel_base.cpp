@@ -1,11 +1,12 @@
 #include "rive/generated/viewmodel/viewmodel_property_viewmodel_base.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/viewmodel/viewmodel_property_viewmodel.hpp"
 
 using namespace rive;
 
 Core* ViewModelPropertyViewModelBase::clone() const
 {
-    auto cloned = new ViewModelPropertyViewModel();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelPropertyViewModel();
     cloned->copy(*this);
     return cloned;
 }
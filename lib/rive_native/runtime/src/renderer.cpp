@@ -139,6 +139,19 @@ RenderPath::~RenderPath() {}
 
 bool rive::isWhiteSpace(Unichar c) { return c <= ' ' || c == 0x2028; }
 
+size_t Font::gGlyphPathCacheByteBudget = 2 * 1024 * 1024;
+
+rcp<GlyphPath> Font::glyphPath(GlyphID glyphId) const
+{
+    rcp<GlyphPath> glyphPath = m_glyphPathCache->find(m_variationKey, glyphId);
+    if (glyphPath == nullptr)
+    {
+        glyphPath =
+            m_glyphPathCache->insert(m_variationKey, glyphId, getPath(glyphId));
+    }
+    return glyphPath;
+}
+
 SimpleArray<Paragraph> Font::shapeText(Span<const Unichar> text,
                                        Span<const TextRun> runs,
                                        int textDirectionFlag) const
@@ -8,10 +8,12 @@
 #include "rive/text/font_hb.hpp"
 
 #include "rive/factory.hpp"
+#include "rive/math/math_types.hpp"
 #include "rive/renderer_utils.hpp"
 
 #include "hb.h"
 #include "hb-ot.h"
+#include <algorithm>
 #include <unordered_set>
 
 extern "C"
@@ -141,13 +143,22 @@ static rive::Font::LineMetrics make_lmx(hb_font_t* font)
     return {-extents.ascender * gInvScale, -extents.descender * gInvScale};
 }
 
-HBFont::HBFont(hb_font_t* font) : HBFont(font, {}, {}, {}) {}
+HBFont::HBFont(hb_font_t* font) :
+    HBFont(font,
+           {},
+           {},
+           {},
+           rive::make_rcp<rive::GlyphPathCache>(gGlyphPathCacheByteBudget),
+           0)
+{}
 
 HBFont::HBFont(hb_font_t* font,
                std::unordered_map<hb_tag_t, float> axisValues,
                std::unordered_map<hb_tag_t, uint32_t> featureValues,
-               std::vector<hb_feature_t> features) :
-    Font(make_lmx(font)),
+               std::vector<hb_feature_t> features,
+               rive::rcp<rive::GlyphPathCache> glyphPathCache,
+               uint64_t variationKey) :
+    Font(make_lmx(font), std::move(glyphPathCache), variationKey),
     m_font(font),
     m_features(features),
     m_featureValues(featureValues),
@@ -339,6 +350,28 @@ bool HBFont::isItalic() const
     return res != 0.0;
 }
 
+// Identifies the outlines of a variation for the glyph path cache it shares
+// with its base font (which uses key 0).
+static uint64_t variation_key(
+    const std::unordered_map<hb_tag_t, float>& axisValues)
+{
+    std::vector<std::pair<hb_tag_t, float>> sortedValues(axisValues.begin(),
+                                                         axisValues.end());
+    std::sort(sortedValues.begin(), sortedValues.end());
+    // FNV-1a over the tags and exact values.
+    uint64_t key = 0xcbf29ce484222325ull;
+    auto mix = [&key](uint32_t bits) {
+        key ^= bits;
+        key *= 0x100000001b3ull;
+    };
+    for (const auto& value : sortedValues)
+    {
+        mix(value.first);
+        mix(rive::math::bit_cast<uint32_t>(value.second));
+    }
+    return key == 0 ? 1 : key;
+}
+
 rive::rcp<rive::Font> HBFont::withOptions(
     rive::Span<const Coord> coords,
     rive::Span<const Feature> features) const
@@ -373,8 +406,14 @@ rive::rcp<rive::Font> HBFont::withOptions(
                               HB_FEATURE_GLOBAL_END});
     }
 
-    return rive::rcp<rive::Font>(
-        new HBFont(font, axisValues, featureValues, hbFeatures));
+    // Features don't change outlines, so they aren't part of the key.
+    uint64_t variationKey = variation_key(axisValues);
+    return rive::rcp<rive::Font>(new HBFont(font,
+                                            axisValues,
+                                            featureValues,
+                                            hbFeatures,
+                                            glyphPathCache(),
+                                            variationKey));
 }
 
 rive::RawPath HBFont::getPath(rive::GlyphID glyph) const
@@ -386,11 +425,25 @@ rive::RawPath HBFont::getPath(rive::GlyphID glyph) const
 
 ///////////////////////////////////////////////////////////
 
-static rive::GlyphRun shape_run(const rive::Unichar text[],
-                                const rive::TextRun& tr,
-                                unsigned textOffset)
+// Returns this thread's shaping buffer, reset and ready for a new run. Reusing
+// it avoids creating and destroying an hb_buffer_t for every run.
+static hb_buffer_t* thread_shaping_buffer()
+{
+    struct ShapingBuffer
+    {
+        hb_buffer_t* buffer = hb_buffer_create();
+        ~ShapingBuffer() { hb_buffer_destroy(buffer); }
+    };
+    static thread_local ShapingBuffer shapingBuffer;
+    hb_buffer_reset(shapingBuffer.buffer);
+    return shapingBuffer.buffer;
+}
+
+static rive::GlyphRun shape_run_uncached(const rive::Unichar text[],
+                                         const rive::TextRun& tr,
+                                         unsigned textOffset)
 {
-    hb_buffer_t* buf = hb_buffer_create();
+    hb_buffer_t* buf = thread_shaping_buffer();
     hb_buffer_add_utf32(buf, text, tr.unicharCount, 0, tr.unicharCount);
 
     hb_buffer_set_direction(buf,
@@ -431,10 +484,131 @@ static rive::GlyphRun shape_run(const rive::Unichar text[],
                                     -glyph_pos[index].y_offset * scale);
     }
     gr.xpos[glyph_count] = 0; // so the next run can line up snug
-    hb_buffer_destroy(buf);
     return gr;
 }
 
+size_t HBFont::gShapeCacheGlyphBudget = 16384;
+
+static uint64_t shaped_run_hash(const rive::Unichar text[],
+                                const rive::TextRun& tr)
+{
+    // FNV-1a over the text and everything else that changes the shaped
+    // glyphs. (The font's features are fixed per HBFont.)
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto mix = [&hash](uint32_t bits) {
+        hash ^= bits;
+        hash *= 0x100000001b3ull;
+    };
+    for (uint32_t i = 0; i < tr.unicharCount; ++i)
+    {
+        mix(text[i]);
+    }
+    mix(rive::math::bit_cast<uint32_t>(tr.size));
+    mix(rive::math::bit_cast<uint32_t>(tr.letterSpacing));
+    mix(tr.script);
+    mix(tr.level);
+    return hash;
+}
+
+rive::GlyphRun HBFont::shapeRun(const rive::Unichar text[],
+                                const rive::TextRun& tr,
+                                unsigned textOffset) const
+{
+    assert(tr.font.get() == this);
+    uint64_t hash = shaped_run_hash(text, tr);
+    {
+        std::lock_guard<std::mutex> lock(m_shapeCacheMutex);
+        auto itr = m_shapedRunLookup.find(hash);
+        if (itr != m_shapedRunLookup.end())
+        {
+            const ShapedRun& entry = *itr->second;
+            if (entry.size == tr.size &&
+                entry.letterSpacing == tr.letterSpacing &&
+                entry.script == tr.script && entry.level == tr.level &&
+                entry.text.size() == tr.unicharCount &&
+                std::equal(entry.text.begin(), entry.text.end(), text))
+            {
+                ++m_shapeCacheHitCount;
+                m_shapedRuns.splice(m_shapedRuns.begin(),
+                                    m_shapedRuns,
+                                    itr->second);
+                rive::GlyphRun gr(entry.glyphRun);
+                gr.font = tr.font;
+                gr.lineHeight = tr.lineHeight;
+                gr.styleId = tr.styleId;
+                for (uint32_t& textIndex : gr.textIndices)
+                {
+                    textIndex += textOffset;
+                }
+                return gr;
+            }
+        }
+        ++m_shapeCacheMissCount;
+    }
+
+    rive::GlyphRun gr = shape_run_uncached(text, tr, textOffset);
+    if (gShapeCacheGlyphBudget == 0 ||
+        gr.glyphs.size() > gShapeCacheGlyphBudget)
+    {
+        return gr;
+    }
+
+    ShapedRun entry = {
+        hash,
+        std::vector<rive::Unichar>(text, text + tr.unicharCount),
+        tr.size,
+        tr.letterSpacing,
+        tr.script,
+        tr.level,
+        rive::GlyphRun(gr),
+    };
+    entry.glyphRun.font = nullptr;
+    for (uint32_t& textIndex : entry.glyphRun.textIndices)
+    {
+        textIndex -= textOffset;
+    }
+
+    std::lock_guard<std::mutex> lock(m_shapeCacheMutex);
+    auto itr = m_shapedRunLookup.find(hash);
+    if (itr != m_shapedRunLookup.end())
+    {
+        // Replace the entry whose hash collided (or that another thread
+        // shaped first).
+        m_shapedGlyphCount -= itr->second->glyphRun.glyphs.size();
+        m_shapedRuns.erase(itr->second);
+        m_shapedRunLookup.erase(itr);
+    }
+    m_shapedGlyphCount += entry.glyphRun.glyphs.size();
+    m_shapedRuns.push_front(std::move(entry));
+    m_shapedRunLookup[hash] = m_shapedRuns.begin();
+    while (m_shapedGlyphCount > gShapeCacheGlyphBudget)
+    {
+        const ShapedRun& lru = m_shapedRuns.back();
+        m_shapedGlyphCount -= lru.glyphRun.glyphs.size();
+        m_shapedRunLookup.erase(lru.hash);
+        m_shapedRuns.pop_back();
+    }
+    return gr;
+}
+
+HBFont::ShapeCacheStats HBFont::shapeCacheStats() const
+{
+    std::lock_guard<std::mutex> lock(m_shapeCacheMutex);
+    ShapeCacheStats stats;
+    stats.hitCount = m_shapeCacheHitCount;
+    stats.missCount = m_shapeCacheMissCount;
+    stats.entryCount = m_shapedRuns.size();
+    return stats;
+}
+
+static rive::GlyphRun shape_run(const rive::Unichar text[],
+                                const rive::TextRun& tr,
+                                unsigned textOffset)
+{
+    auto hbfont = static_cast<const HBFont*>(tr.font.get());
+    return hbfont->shapeRun(text, tr, textOffset);
+}
+
 static rive::GlyphRun extract_subset(const rive::GlyphRun& orig,
                                      size_t start,
                                      size_t end)
@@ -0,0 +1,375 @@
+#include "rive/text/glyph_atlas.hpp"
+#include "rive/factory.hpp"
+#include "rive/math/wangs_formula.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace rive;
+
+float GlyphAtlas::gMaxPixelSize = 48.0f;
+float GlyphAtlas::gPixelScale = 1.0f;
+
+// Flattening tolerance in pixels.
+constexpr static float kInvTolerance = 4.0f;
+constexpr static uint32_t kMaxSegments = 32;
+
+// Adds the signed area a line covers in each pixel it crosses to an
+// accumulation buffer, whose running sum along each row is the coverage of
+// the glyph. (The "font-rs" approach to rasterizing glyphs.) The caller keeps
+// every point at least a pixel inside the buffer.
+static void accumulate_line(float* acc, uint32_t width, Vec2D p0, Vec2D p1)
+{
+    if (std::abs(p0.y - p1.y) <= 1e-6f)
+    {
+        return;
+    }
+    float dir = 1.0f;
+    if (p0.y > p1.y)
+    {
+        std::swap(p0, p1);
+        dir = -1.0f;
+    }
+    float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    float x = p0.x;
+    auto yEnd = static_cast<uint32_t>(std::ceil(p1.y));
+    for (auto y = static_cast<uint32_t>(p0.y); y < yEnd; ++y)
+    {
+        float* row = acc + y * width;
+        float dy = std::min(y + 1.0f, p1.y) - std::max<float>(y, p0.y);
+        float xnext = x + dxdy * dy;
+        float d = dy * dir;
+        float x0 = std::min(x, xnext);
+        float x1 = std::max(x, xnext);
+        float x0floor = std::floor(x0);
+        auto x0i = static_cast<int32_t>(x0floor);
+        float x1ceil = std::ceil(x1);
+        auto x1i = static_cast<int32_t>(x1ceil);
+        if (x1i <= x0i + 1)
+        {
+            // The line stays within one pixel on this row.
+            float xmf = .5f * (x + xnext) - x0floor;
+            row[x0i] += d - d * xmf;
+            row[x0i + 1] += d * xmf;
+        }
+        else
+        {
+            float s = 1.0f / (x1 - x0);
+            float x0f = x0 - x0floor;
+            float a0 = .5f * s * (1.0f - x0f) * (1.0f - x0f);
+            float x1f = x1 - x1ceil + 1.0f;
+            float am = .5f * s * x1f * x1f;
+            row[x0i] += d * a0;
+            if (x1i == x0i + 2)
+            {
+                row[x0i + 1] += d * (1.0f - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - x0f);
+                row[x0i + 1] += d * (a1 - a0);
+                for (int32_t xi = x0i + 2; xi < x1i - 1; ++xi)
+                {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + (x1i - x0i - 3) * s;
+                row[x1i - 1] += d * (1.0f - a2 - am);
+            }
+            row[x1i] += d * am;
+        }
+        x = xnext;
+    }
+}
+
+static Vec2D eval_quad(const Vec2D p[3], float t)
+{
+    float mt = 1.0f - t;
+    return p[0] * (mt * mt) + p[1] * (2.0f * mt * t) + p[2] * (t * t);
+}
+
+static Vec2D eval_cubic(const Vec2D p[4], float t)
+{
+    float mt = 1.0f - t;
+    return p[0] * (mt * mt * mt) + p[1] * (3.0f * mt * mt * t) +
+           p[2] * (3.0f * mt * t * t) + p[3] * (t * t * t);
+}
+
+// Accumulates the outline of rawPath, mapped to pixels by matrix.
+static void accumulate_path(float* acc,
+                            uint32_t width,
+                            const RawPath& rawPath,
+                            const Mat2D& matrix)
+{
+    Vec2D contourStart = {0, 0};
+    Vec2D last = {0, 0};
+    for (auto iter : rawPath)
+    {
+        PathVerb verb = std::get<0>(iter);
+        const Vec2D* pts = std::get<1>(iter);
+        switch (verb)
+        {
+            case PathVerb::move:
+                accumulate_line(acc, width, last, contourStart);
+                contourStart = last = matrix * pts[0];
+                break;
+            case PathVerb::line:
+            {
+                Vec2D p1 = matrix * pts[1];
+                accumulate_line(acc, width, last, p1);
+                last = p1;
+                break;
+            }
+            case PathVerb::quad:
+            {
+                Vec2D p[3] = {last, matrix * pts[1], matrix * pts[2]};
+                auto n = std::min(
+                    std::max(static_cast<uint32_t>(std::ceil(
+                                 wangs_formula::quadratic(p, kInvTolerance))),
+                             1u),
+                    kMaxSegments);
+                for (uint32_t i = 1; i <= n; ++i)
+                {
+                    Vec2D next =
+                        i == n ? p[2] : eval_quad(p, static_cast<float>(i) / n);
+                    accumulate_line(acc, width, last, next);
+                    last = next;
+                }
+                break;
+            }
+            case PathVerb::cubic:
+            {
+                Vec2D p[4] = {last,
+                              matrix * pts[1],
+                              matrix * pts[2],
+                              matrix * pts[3]};
+                auto n = std::min(
+                    std::max(static_cast<uint32_t>(std::ceil(
+                                 wangs_formula::cubic(p, kInvTolerance))),
+                             1u),
+                    kMaxSegments);
+                for (uint32_t i = 1; i <= n; ++i)
+                {
+                    Vec2D next = i == n
+                                     ? p[3]
+                                     : eval_cubic(p, static_cast<float>(i) / n);
+                    accumulate_line(acc, width, last, next);
+                    last = next;
+                }
+                break;
+            }
+            case PathVerb::close:
+                accumulate_line(acc, width, last, contourStart);
+                last = contourStart;
+                break;
+        }
+    }
+    accumulate_line(acc, width, last, contourStart);
+}
+
+bool GlyphAtlas::find(const rcp<GlyphPath>& glyphPath,
+                      float emPixelSize,
+                      Glyph* out)
+{
+    auto pixelSize =
+        static_cast<uint32_t>(std::max(std::round(emPixelSize), 1.0f));
+    Key key = {glyphPath.get(), pixelSize};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_entries.find(key);
+    if (itr != m_entries.end())
+    {
+        *out = itr->second.glyph;
+        return !itr->second.empty;
+    }
+
+    const RawPath& rawPath = glyphPath->rawPath();
+    AABB bounds = rawPath.bounds();
+    if (rawPath.empty() || bounds.isEmptyOrNaN())
+    {
+        m_entries[key] = {glyphPath, true, {}};
+        return false;
+    }
+
+    // Pad by a pixel on every side so lines never touch the buffer's edges,
+    // and so bilinear filtering reads transparent texels past the glyph.
+    float scale = static_cast<float>(pixelSize);
+    float left = std::floor(bounds.minX * scale) - 1.0f;
+    float top = std::floor(bounds.minY * scale) - 1.0f;
+    float right = std::ceil(bounds.maxX * scale) + 1.0f;
+    float bottom = std::ceil(bounds.maxY * scale) + 1.0f;
+    auto width = static_cast<uint32_t>(right - left);
+    auto height = static_cast<uint32_t>(bottom - top);
+    uint32_t x, y;
+    if (!allocate(width, height, &x, &y))
+    {
+        return false;
+    }
+
+    m_accumulation.assign(width * height + 4, 0.0f);
+    accumulate_path(m_accumulation.data(),
+                    width,
+                    rawPath,
+                    Mat2D(scale, 0.0f, 0.0f, scale, -left, -top));
+    if (m_coverage.empty())
+    {
+        m_coverage.resize(kPageSize * kPageSize);
+        m_rowVersions.resize(kPageSize);
+    }
+    ++m_version;
+    float sum = 0.0f;
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        uint8_t* dst = &m_coverage[(y + row) * kPageSize + x];
+        const float* src = &m_accumulation[row * width];
+        for (uint32_t col = 0; col < width; ++col)
+        {
+            sum += src[col];
+            dst[col] = static_cast<uint8_t>(
+                std::min(std::abs(sum), 1.0f) * 255.0f + .5f);
+        }
+        m_rowVersions[y + row] = m_version;
+    }
+
+    Glyph glyph;
+    glyph.bounds =
+        AABB(left / scale, top / scale, right / scale, bottom / scale);
+    constexpr static float kInvPageSize = 1.0f / kPageSize;
+    glyph.uvs = AABB(x * kInvPageSize,
+                     y * kInvPageSize,
+                     (x + width) * kInvPageSize,
+                     (y + height) * kInvPageSize);
+    m_entries[key] = {glyphPath, false, glyph};
+    *out = glyph;
+    return true;
+}
+
+bool GlyphAtlas::allocate(uint32_t width,
+                          uint32_t height,
+                          uint32_t* x,
+                          uint32_t* y)
+{
+    // Leave a texel of gutter between glyphs.
+    uint32_t paddedWidth = width + 1;
+    uint32_t paddedHeight = height + 1;
+    if (paddedWidth > kPageSize || paddedHeight > kPageSize)
+    {
+        return false;
+    }
+    if (m_shelfX + paddedWidth > kPageSize)
+    {
+        // Start a new shelf.
+        m_shelfY += m_shelfHeight;
+        m_shelfX = 0;
+        m_shelfHeight = 0;
+    }
+    if (m_shelfY + paddedHeight > kPageSize)
+    {
+        // Out of room. Start over, anyone holding on to glyphs will see the
+        // new generation and look them up again.
+        clear();
+    }
+    *x = m_shelfX;
+    *y = m_shelfY;
+    m_shelfX += paddedWidth;
+    m_shelfHeight = std::max(m_shelfHeight, paddedHeight);
+    return true;
+}
+
+void GlyphAtlas::clear()
+{
+    ++m_generation;
+    ++m_version;
+    uint32_t usedRows = std::min(m_shelfY + m_shelfHeight, kPageSize);
+    std::fill(m_coverage.begin(), m_coverage.begin() + usedRows * kPageSize, 0);
+    std::fill(m_rowVersions.begin(),
+              m_rowVersions.begin() + usedRows,
+              m_version);
+    m_entries.clear();
+    m_shelfX = 0;
+    m_shelfY = 0;
+    m_shelfHeight = 0;
+}
+
+uint32_t GlyphAtlas::generation() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_generation;
+}
+
+rcp<RenderImage> GlyphAtlas::image(ColorInt color)
+{
+    color |= 0xff000000;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_imageUseCount;
+    auto itr = m_images.find(color);
+    if (itr == m_images.end())
+    {
+        if (m_images.size() >= kMaxColoredImages)
+        {
+            m_images.erase(std::min_element(
+                m_images.begin(),
+                m_images.end(),
+                [](const auto& a, const auto& b) {
+                    return a.second.lastUse < b.second.lastUse;
+                }));
+        }
+        itr = m_images.insert({color, {nullptr, 0, 0}}).first;
+    }
+    ColoredImage& coloredImage = itr->second;
+    coloredImage.lastUse = m_imageUseCount;
+    if (coloredImage.image != nullptr && coloredImage.version == m_version)
+    {
+        return coloredImage.image;
+    }
+    tintPixels(color);
+    coloredImage.image =
+        m_factory->makeImage(kPageSize, kPageSize, m_pixels.data());
+    coloredImage.version = m_version;
+    return coloredImage.image;
+}
+
+void GlyphAtlas::tintPixels(ColorInt color)
+{
+    if (m_coverage.empty())
+    {
+        m_coverage.resize(kPageSize * kPageSize);
+        m_rowVersions.resize(kPageSize);
+    }
+    if (m_pixels.empty())
+    {
+        m_pixels.resize(kPageSize * kPageSize * 4);
+    }
+    // Rows past the shelves have no coverage. Rows the pixels were last
+    // tinted up to may still need clearing.
+    uint32_t rowCount =
+        std::max(std::min(m_shelfY + m_shelfHeight, kPageSize),
+                 m_pixelsRowCount);
+    bool sameColor = color == m_pixelsColor;
+    uint8_t rgba[4];
+    UnpackColorToRGBA8(color, rgba);
+    for (uint32_t row = 0; row < rowCount; ++row)
+    {
+        if (sameColor && m_rowVersions[row] <= m_pixelsVersion)
+        {
+            continue;
+        }
+        const uint8_t* coverage = &m_coverage[row * kPageSize];
+        uint8_t* pixel = &m_pixels[row * kPageSize * 4];
+        for (uint32_t col = 0; col < kPageSize; ++col, pixel += 4)
+        {
+            uint32_t c = coverage[col];
+            pixel[0] = static_cast<uint8_t>((rgba[0] * c + 127) / 255);
+            pixel[1] = static_cast<uint8_t>((rgba[1] * c + 127) / 255);
+            pixel[2] = static_cast<uint8_t>((rgba[2] * c + 127) / 255);
+            pixel[3] = static_cast<uint8_t>(c);
+        }
+    }
+    m_pixelsColor = color;
+    m_pixelsVersion = m_version;
+    m_pixelsRowCount = std::min(m_shelfY + m_shelfHeight, kPageSize);
+}
+
+void GlyphAtlas::releaseImages()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_images.clear();
+}
@@ -0,0 +1,89 @@
+#include "rive/text/glyph_path_cache.hpp"
+
+using namespace rive;
+
+size_t GlyphPath::byteSize() const
+{
+    return sizeof(GlyphPath) + m_rawPath.points().size() * sizeof(Vec2D) +
+           m_rawPath.verbs().size() * sizeof(PathVerb);
+}
+
+rcp<GlyphPath> GlyphPathCache::find(uint64_t variationKey, GlyphID glyphId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_lookup.find({variationKey, glyphId});
+    if (itr == m_lookup.end())
+    {
+        ++m_missCount;
+        return nullptr;
+    }
+    ++m_hitCount;
+    m_entries.splice(m_entries.begin(), m_entries, itr->second);
+    return m_entries.front().glyphPath;
+}
+
+rcp<GlyphPath> GlyphPathCache::insert(uint64_t variationKey,
+                                      GlyphID glyphId,
+                                      const RawPath& rawPath)
+{
+    auto glyphPath = make_rcp<GlyphPath>(rawPath);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_byteBudget == 0)
+    {
+        return glyphPath;
+    }
+    Key key = {variationKey, glyphId};
+    auto itr = m_lookup.find(key);
+    if (itr != m_lookup.end())
+    {
+        // Another thread extracted the same outline first.
+        m_entries.splice(m_entries.begin(), m_entries, itr->second);
+        return m_entries.front().glyphPath;
+    }
+    m_entries.push_front({key, glyphPath});
+    m_lookup[key] = m_entries.begin();
+    m_byteCount += glyphPath->byteSize();
+    evictToBudget();
+    return glyphPath;
+}
+
+void GlyphPathCache::setByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_byteBudget = byteBudget;
+    evictToBudget();
+}
+
+void GlyphPathCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lookup.clear();
+    m_entries.clear();
+    m_byteCount = 0;
+}
+
+GlyphPathCache::Stats GlyphPathCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats;
+    stats.hitCount = m_hitCount;
+    stats.missCount = m_missCount;
+    stats.evictionCount = m_evictionCount;
+    stats.entryCount = m_entries.size();
+    stats.byteCount = m_byteCount;
+    return stats;
+}
+
+void GlyphPathCache::evictToBudget()
+{
+    // Outlines that are still referenced stay alive through their rcp, so
+    // they can be evicted at any time.
+    while (m_byteCount > m_byteBudget && !m_entries.empty())
+    {
+        const Entry& entry = m_entries.back();
+        m_byteCount -= entry.glyphPath->byteSize();
+        m_lookup.erase(entry.key);
+        m_entries.pop_back();
+        ++m_evictionCount;
+    }
+}
@@ -0,0 +1,155 @@
+#include "rive/text/glyph_transform_batch.hpp"
+#include "rive/text/text_modifier_group.hpp"
+#include "rive/math/simd.hpp"
+#include <cmath>
+
+using namespace rive;
+
+void GlyphTransformBatch::add(const Mat2D& glyphTransform,
+                              Vec2D translation,
+                              float opacity,
+                              uint32_t textIndex,
+                              uint32_t codePointCount)
+{
+    size_t index = m_size++;
+    if (m_opacity.size() < m_size)
+    {
+        // Grow by a full group of four.
+        size_t paddedSize = index + 4;
+        for (std::vector<float>& values : m_matrix)
+        {
+            values.resize(paddedSize);
+        }
+        m_translateX.resize(paddedSize);
+        m_translateY.resize(paddedSize);
+        m_opacity.resize(paddedSize);
+        m_coverage.resize(paddedSize);
+        m_textIndex.resize(paddedSize);
+        m_codePointCount.resize(paddedSize);
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        m_matrix[i][index] = glyphTransform[i];
+    }
+    m_translateX[index] = translation.x;
+    m_translateY[index] = translation.y;
+    m_opacity[index] = opacity;
+    m_textIndex[index] = textIndex;
+    m_codePointCount[index] = codePointCount;
+}
+
+static void storeMasked(float* dst, int4 mask, float4 value)
+{
+    simd::store(dst, simd::if_then_else(mask, value, simd::load4f(dst)));
+}
+
+void GlyphTransformBatch::applyModifierGroup(const TextModifierGroup& group)
+{
+    assert(!group.followsPath());
+    for (size_t i = 0; i < m_size; i++)
+    {
+        m_coverage[i] = group.glyphCoverage(m_textIndex[i], m_codePointCount[i]);
+    }
+    // Padding lanes still hold glyphs from before the last clear(). Give them
+    // no coverage so the masked stores below leave them alone.
+    for (size_t i = m_size; i < m_coverage.size() && (i & 3) != 0; i++)
+    {
+        m_coverage[i] = 0.0f;
+    }
+
+    if (group.modifiesTransform())
+    {
+        // Same math as TextModifierGroup::transform: compose the modifier's
+        // parts scaled by the coverage, then pre-multiply it onto the glyph's
+        // transform (around the modifier's origin when it has one).
+        bool modifiesTranslation = group.modifiesTranslation();
+        bool modifiesScale = group.modifiesScale();
+        bool modifiesRotation = group.modifiesRotation();
+        float originX = group.modifiesOrigin() ? group.originX() : 0.0f;
+        float originY = group.modifiesOrigin() ? group.originY() : 0.0f;
+        for (size_t i = 0; i < m_size; i += 4)
+        {
+            float4 amount = simd::load4f(&m_coverage[i]);
+            // Glyphs without coverage are left untouched.
+            int4 mask = amount != 0.0f;
+            if (!simd::any(mask))
+            {
+                continue;
+            }
+
+            float4 t4 = 0.0f, t5 = 0.0f;
+            if (modifiesTranslation)
+            {
+                t4 = group.x() * amount;
+                t5 = group.y() * amount;
+            }
+            float4 scaleX = 1.0f, scaleY = 1.0f;
+            if (modifiesScale)
+            {
+                float4 iamount = 1.0f - amount;
+                scaleX = iamount + group.scaleX() * amount;
+                scaleY = iamount + group.scaleY() * amount;
+            }
+            float4 s = 0.0f, c = 1.0f;
+            if (modifiesRotation)
+            {
+                float4 rotation = group.rotation() * amount;
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    float rad = rotation[lane];
+                    if (rad != 0)
+                    {
+                        s[lane] = sin(rad);
+                        c[lane] = cos(rad);
+                    }
+                }
+            }
+            float4 t0 = c * scaleX;
+            float4 t1 = s * scaleX;
+            float4 t2 = -s * scaleY;
+            float4 t3 = c * scaleY;
+
+            float4 m0 = simd::load4f(&m_matrix[0][i]);
+            float4 m1 = simd::load4f(&m_matrix[1][i]);
+            float4 m2 = simd::load4f(&m_matrix[2][i]);
+            float4 m3 = simd::load4f(&m_matrix[3][i]);
+            float4 m4 = simd::load4f(&m_matrix[4][i]) + originX;
+            float4 m5 = simd::load4f(&m_matrix[5][i]) + originY;
+            storeMasked(&m_matrix[0][i], mask, t0 * m0 + t2 * m1);
+            storeMasked(&m_matrix[1][i], mask, t1 * m0 + t3 * m1);
+            storeMasked(&m_matrix[2][i], mask, t0 * m2 + t2 * m3);
+            storeMasked(&m_matrix[3][i], mask, t1 * m2 + t3 * m3);
+            storeMasked(&m_matrix[4][i],
+                        mask,
+                        t0 * m4 + t2 * m5 + t4 - originX);
+            storeMasked(&m_matrix[5][i],
+                        mask,
+                        t1 * m4 + t3 * m5 + t5 - originY);
+        }
+    }
+
+    if (group.modifiesOpacity())
+    {
+        float opacity = group.opacity();
+        bool invert = group.invertsOpacity();
+        for (size_t i = 0; i < m_size; i += 4)
+        {
+            float4 amount = simd::load4f(&m_coverage[i]);
+            float4 current = simd::load4f(&m_opacity[i]);
+            simd::store(&m_opacity[i],
+                        invert ? current * (1.0f - amount) + opacity * amount
+                               : current * opacity * amount);
+        }
+    }
+}
+
+Mat2D GlyphTransformBatch::transform(size_t index) const
+{
+    assert(index < m_size);
+    return Mat2D(m_matrix[0][index],
+                 m_matrix[1][index],
+                 m_matrix[2][index],
+                 m_matrix[3][index],
+                 m_matrix[4][index] + m_translateX[index],
+                 m_matrix[5][index] + m_translateY[index]);
+}
@@ -289,14 +289,14 @@ void RawText::update()
                 GlyphID glyphId = run->glyphs[glyphIndex];
                 float advance = run->advances[glyphIndex];
 
-                RawPath path = font->getPath(glyphId);
-
-                path.transformInPlace(Mat2D(run->size,
-                                            0.0f,
-                                            0.0f,
-                                            run->size,
-                                            x + offset.x,
-                                            renderY + offset.y));
+                rcp<GlyphPath> glyphPath = font->glyphPath(glyphId);
+                RawPath path =
+                    glyphPath->rawPath().transform(Mat2D(run->size,
+                                                         0.0f,
+                                                         0.0f,
+                                                         run->size,
+                                                         x + offset.x,
+                                                         renderY + offset.y));
 
                 x += advance;
 
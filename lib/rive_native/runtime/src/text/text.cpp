@@ -7,12 +7,14 @@ using namespace rive;
 #include "rive/math/transform_components.hpp"
 #include "rive/text/utf.hpp"
 #include "rive/text/text_style.hpp"
+#include "rive/text/glyph_atlas.hpp"
 #include "rive/text/text_value_run.hpp"
 #include "rive/text/text_modifier_group.hpp"
 #include "rive/shapes/paint/shape_paint.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
 #include "rive/clip_result.hpp"
+#include <cstring>
 #include <limits>
 
 void GlyphItr::tryAdvanceRun()
@@ -485,6 +487,10 @@ void Text::buildRenderStyles()
 
     // Step 3: update modifiers
     bool hasModifiers = haveModifiers();
+    // Follow path modifiers need each glyph's line, so those are applied one
+    // glyph at a time. Otherwise every group is applied to all the glyphs in
+    // one batch once they've been laid out.
+    bool batchModifiers = hasModifiers;
     if (hasModifiers)
     {
         uint32_t textSize = (uint32_t)m_styledText.unichars().size();
@@ -492,8 +498,15 @@ void Text::buildRenderStyles()
         {
             modifierGroup->computeCoverage(textSize);
             modifierGroup->resetTextFollowPath();
+            if (modifierGroup->followsPath())
+            {
+                batchModifiers = false;
+            }
         }
     }
+    m_glyphTransforms.clear();
+    m_glyphPaths.clear();
+    m_glyphStyles.clear();
 
     // Step 4: update bounds
     const float paragraphSpace = paragraphSpacing();
@@ -589,24 +602,30 @@ void Text::buildRenderStyles()
                 GlyphID glyphId = run->glyphs[glyphIndex];
                 float advance = run->advances[glyphIndex];
 
-                RawPath path = font->getPath(glyphId);
+                rcp<GlyphPath> glyphPath = font->glyphPath(glyphId);
 
                 // Step 6.1: translate to the glyph's origin and scale.
                 Vec2D curPos(curX, curY + line.baseline);
                 float centerX = advance / 2.0f;
-                TransformComponents tc;
-                tc.scaleX(run->size);
-                tc.scaleY(run->size);
-                tc.x(-centerX);
-                Mat2D pathTransform = Mat2D::compose(tc);
-
-                // Step 6.2: apply modifiers on a font-sized glyph
+                Mat2D pathTransform(run->size,
+                                    0.0f,
+                                    0.0f,
+                                    run->size,
+                                    -centerX,
+                                    0.0f);
+
+                // Step 6.2: apply modifiers on a font-sized glyph (unless
+                // they get batched in step 6.4).
                 float opacity = 1.0f;
+                uint32_t textIndex = 0;
+                uint32_t glyphCount = 1;
                 if (hasModifiers)
                 {
-                    uint32_t textIndex = run->textIndices[glyphIndex];
-                    uint32_t glyphCount = m_glyphLookup.count(textIndex);
-
+                    textIndex = run->textIndices[glyphIndex];
+                    glyphCount = m_glyphLookup.count(textIndex);
+                }
+                if (hasModifiers && !batchModifiers)
+                {
                     for (TextModifierGroup* modifierGroup : m_modifierGroups)
                     {
                         float coverage =
@@ -626,13 +645,14 @@ void Text::buildRenderStyles()
                     }
                 }
 
-                // Step 6.3: translate back to center with offset
-                pathTransform =
-                    Mat2D::fromTranslate(curPos.x + centerX + offset.x,
-                                         curPos.y + offset.y) *
-                    pathTransform;
-
-                path.transformInPlace(pathTransform);
+                // Step 6.3: queue the glyph, translated back to center with
+                // offset.
+                m_glyphTransforms.add(pathTransform,
+                                      Vec2D(curPos.x + centerX + offset.x,
+                                            curPos.y + offset.y),
+                                      opacity,
+                                      textIndex,
+                                      glyphCount);
 
                 assert(run->styleId < m_runs.size());
                 TextValueRun* textValueRun = m_runs[run->styleId];
@@ -640,14 +660,8 @@ void Text::buildRenderStyles()
                 // TextValueRun::onAddedDirty botches loading if it cannot
                 // resolve a style, so we're confident we have a style here.
                 assert(style != nullptr);
-
-                if (style->addPath(path, opacity))
-                {
-                    // This was the first path added to the style, so let's
-                    // mark it in our draw list.
-                    m_renderStyles.push_back(style);
-                    style->propagateOpacity(renderOpacity());
-                }
+                m_glyphPaths.push_back(std::move(glyphPath));
+                m_glyphStyles.push_back(style);
 
                 // Bounds of the glyph
                 if (textValueRun->isHitTarget())
@@ -676,6 +690,15 @@ void Text::buildRenderStyles()
         curY += paragraphSpacing();
     }
 skipLines:
+    // Step 6.4: apply the modifiers to every glyph at once.
+    if (batchModifiers)
+    {
+        for (TextModifierGroup* modifierGroup : m_modifierGroups)
+        {
+            m_glyphTransforms.applyModifierGroup(*modifierGroup);
+        }
+    }
+
     // Step 7: consider fit mode, and update local transform
     auto scale = 1.0f;
     auto xOffset = -m_bounds.width() * originX();
@@ -732,7 +755,61 @@ skipLines:
     markLayoutNodeDirty();
 #endif
 
-    // Step 8: cleanup
+    // Step 8: add the glyphs to their styles, as atlas quads when they're
+    // small enough and every style can draw them that way.
+    Factory* factory = artboard()->factory();
+    bool useAtlas = (!hasModifiers || batchModifiers) &&
+                    artboard()->effectiveTextRenderMode() ==
+                        TextRenderMode::glyphAtlas &&
+                    factory != nullptr && factory->glyphAtlas() != nullptr;
+    float pixelScale = glyphAtlasPixelScale();
+    float maxGlyphScale = 0.0f;
+    if (useAtlas)
+    {
+        for (size_t i = 0; i < m_glyphTransforms.size(); i++)
+        {
+            Mat2D pathTransform = m_glyphTransforms.transform(i);
+            if (pathTransform[1] != 0.0f || pathTransform[2] != 0.0f ||
+                pathTransform[0] != pathTransform[3] ||
+                pathTransform[0] <= 0.0f ||
+                !m_glyphStyles[i]->canDrawFromAtlas())
+            {
+                useAtlas = false;
+                break;
+            }
+            maxGlyphScale = std::max(maxGlyphScale, pathTransform[0]);
+        }
+    }
+    bool tooLarge =
+        useAtlas && maxGlyphScale * pixelScale > GlyphAtlas::gMaxPixelSize;
+    useAtlas = useAtlas && !tooLarge;
+    m_glyphAtlasPixelScale = useAtlas ? pixelScale : 0.0f;
+    m_glyphAtlasMaxGlyphScale = tooLarge ? maxGlyphScale : 0.0f;
+    for (size_t i = 0; i < m_glyphTransforms.size(); i++)
+    {
+        TextStyle* style = m_glyphStyles[i];
+        Mat2D pathTransform = m_glyphTransforms.transform(i);
+        bool added =
+            useAtlas
+                ? style->addAtlasGlyph(m_glyphPaths[i],
+                                       pathTransform[0] * pixelScale,
+                                       pathTransform,
+                                       m_glyphTransforms.opacity(i))
+                : style->addPath(m_glyphPaths[i]->rawPath(),
+                                 m_glyphTransforms.opacity(i),
+                                 &pathTransform);
+        if (added)
+        {
+            // This was the first path added to the style, so let's mark it
+            // in our draw list.
+            m_renderStyles.push_back(style);
+            style->propagateOpacity(renderOpacity());
+        }
+    }
+    // Don't hold on to outlines the font's cache may want to evict.
+    m_glyphPaths.clear();
+
+    // Step 9: cleanup
     for (TextValueRun* textValueRun : m_runs)
     {
         if (textValueRun->isHitTarget())
@@ -902,11 +979,77 @@ bool Text::makeStyled(StyledText& styledText, bool withModifiers) const
     return !styledText.empty();
 }
 
+static bool same_styled_text(const StyledText& a, const StyledText& b)
+{
+    if (a.unichars() != b.unichars() || a.runs().size() != b.runs().size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.runs().size(); i++)
+    {
+        const TextRun& runA = a.runs()[i];
+        const TextRun& runB = b.runs()[i];
+        if (runA.font != runB.font || runA.size != runB.size ||
+            runA.lineHeight != runB.lineHeight ||
+            runA.letterSpacing != runB.letterSpacing ||
+            runA.unicharCount != runB.unicharCount ||
+            runA.script != runB.script || runA.styleId != runB.styleId ||
+            runA.level != runB.level)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Text::prepareShape()
+{
+    m_hasPreparedShape = false;
+    if (haveModifiers() || !makeStyled(m_preparedStyledText))
+    {
+        return;
+    }
+    auto runs = m_preparedStyledText.runs();
+    m_preparedShape =
+        runs[0].font->shapeText(m_preparedStyledText.unichars(), runs);
+    m_hasPreparedShape = true;
+}
+
+// Line breaking only looks at the glyph positions and word breaks, so if those
+// didn't change, neither did the lines.
+static bool same_line_breaks(const Paragraph& a, const Paragraph& b)
+{
+    if (a.runs.size() != b.runs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.runs.size(); i++)
+    {
+        const GlyphRun& runA = a.runs[i];
+        const GlyphRun& runB = b.runs[i];
+        if (runA.glyphs.size() != runB.glyphs.size() ||
+            runA.xpos.size() != runB.xpos.size() ||
+            runA.breaks.size() != runB.breaks.size() ||
+            memcmp(runA.xpos.data(),
+                   runB.xpos.data(),
+                   runA.xpos.size_bytes()) != 0 ||
+            memcmp(runA.breaks.data(),
+                   runB.breaks.data(),
+                   runA.breaks.size_bytes()) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 SimpleArray<SimpleArray<GlyphLine>> Text::BreakLines(
     const SimpleArray<Paragraph>& paragraphs,
     float width,
     TextAlign align,
-    TextWrap wrap)
+    TextWrap wrap,
+    const SimpleArray<Paragraph>* previousParagraphs,
+    SimpleArray<SimpleArray<GlyphLine>>* previousLines)
 {
     bool autoWidth = width == -1.0f;
     float paragraphWidth = width;
@@ -916,9 +1059,22 @@ SimpleArray<SimpleArray<GlyphLine>> Text::BreakLines(
     size_t paragraphIndex = 0;
     for (auto& para : paragraphs)
     {
-        lines[paragraphIndex] = GlyphLine::BreakLines(
-            para.runs,
-            (autoWidth || wrap == TextWrap::noWrap) ? -1.0f : width);
+        if (previousParagraphs != nullptr && previousLines != nullptr &&
+            paragraphIndex < previousParagraphs->size() &&
+            paragraphIndex < previousLines->size() &&
+            same_line_breaks(para, (*previousParagraphs)[paragraphIndex]))
+        {
+            // Only the spacing gets recomputed below, which overwrites
+            // everything but the glyph ranges.
+            lines[paragraphIndex] =
+                std::move((*previousLines)[paragraphIndex]);
+        }
+        else
+        {
+            lines[paragraphIndex] = GlyphLine::BreakLines(
+                para.runs,
+                (autoWidth || wrap == TextWrap::noWrap) ? -1.0f : width);
+        }
         if (autoWidth)
         {
             paragraphWidth = std::max(
@@ -971,6 +1127,37 @@ void Text::onDirty(ComponentDirt value)
     }
 }
 
+float Text::glyphAtlasPixelScale() const
+{
+    return std::sqrt(std::abs(m_WorldTransform.determinant())) *
+           m_transform[0] * GlyphAtlas::gPixelScale;
+}
+
+// Atlas glyphs are rasterized at whole pixel sizes and drawn with bilinear
+// filtering, so small changes in scale can keep using them.
+bool Text::glyphAtlasScaleChanged() const
+{
+    float pixelScale = glyphAtlasPixelScale();
+    if (m_glyphAtlasPixelScale != 0.0f)
+    {
+        float ratio = pixelScale / m_glyphAtlasPixelScale;
+        return !(ratio > 0.8f && ratio < 1.25f);
+    }
+    // Glyphs that were too large for the atlas may fit now.
+    return m_glyphAtlasMaxGlyphScale != 0.0f &&
+           m_glyphAtlasMaxGlyphScale * pixelScale <=
+               GlyphAtlas::gMaxPixelSize;
+}
+
+void Text::addAtlasGlyphsAsPaths()
+{
+    for (TextStyle* style : m_renderStyles)
+    {
+        style->addAtlasGlyphsAsPaths();
+    }
+    m_glyphAtlasPixelScale = 0.0f;
+}
+
 void Text::update(ComponentDirt value)
 {
     Super::update(value);
@@ -1012,15 +1199,34 @@ void Text::update(ComponentDirt value)
         if (makeStyled(m_styledText))
         {
             auto runs = m_styledText.runs();
-            m_shape = runs[0].font->shapeText(m_styledText.unichars(), runs);
-
-            m_lines = BreakLines(m_shape,
-                                 (effectiveSizing() == TextSizing::autoWidth &&
-                                  !parentIsLayoutNotArtboard)
-                                     ? -1.0f
-                                     : effectiveWidth(),
+            SimpleArray<Paragraph> shape;
+            if (m_hasPreparedShape &&
+                same_styled_text(m_preparedStyledText, m_styledText))
+            {
+                shape = std::move(m_preparedShape);
+            }
+            else
+            {
+                shape = runs[0].font->shapeText(m_styledText.unichars(), runs);
+            }
+            float lineBreakWidth = (effectiveSizing() == TextSizing::autoWidth &&
+                                    !parentIsLayoutNotArtboard)
+                                       ? -1.0f
+                                       : effectiveWidth();
+            // Paragraphs whose runs shaped the same as last time keep their
+            // lines, as long as the constraints they were broken to didn't
+            // change.
+            bool reuseLines = lineBreakWidth == m_lineBreakWidth &&
+                              wrap() == m_lineBreakWrap;
+            m_lines = BreakLines(shape,
+                                 lineBreakWidth,
                                  align(),
-                                 wrap());
+                                 wrap(),
+                                 reuseLines ? &m_shape : nullptr,
+                                 reuseLines ? &m_lines : nullptr);
+            m_shape = std::move(shape);
+            m_lineBreakWidth = lineBreakWidth;
+            m_lineBreakWrap = wrap();
             if (!precomputeModifierCoverage && haveModifiers())
             {
                 m_glyphLookup.compute(m_styledText.unichars(), m_shape);
@@ -1039,8 +1245,14 @@ void Text::update(ComponentDirt value)
         {
             m_shape = SimpleArray<Paragraph>();
             m_lines = SimpleArray<SimpleArray<GlyphLine>>();
+            m_lineBreakWidth = NAN;
             m_glyphLookup.clear();
         }
+        if (m_hasPreparedShape)
+        {
+            m_hasPreparedShape = false;
+            m_preparedShape = SimpleArray<Paragraph>();
+        }
         m_orderedLines.clear();
         m_ellipsisRun = {};
 
@@ -1051,6 +1263,13 @@ void Text::update(ComponentDirt value)
     {
         buildRenderStyles();
     }
+    else if (hasDirt(value, ComponentDirt::WorldTransform) &&
+             glyphAtlasScaleChanged())
+    {
+        // Atlas glyphs were rasterized for the old scale, pick new sizes (or
+        // switch between paths and the atlas as they cross its size limit).
+        buildRenderStyles();
+    }
     else if (hasDirt(value, ComponentDirt::RenderOpacity))
     {
         // Note that buildRenderStyles does this too, which is why we can get
@@ -1220,6 +1439,8 @@ void Text::heightChanged() {}
 void Text::markPaintDirty() {}
 void Text::modifierShapeDirty() {}
 bool Text::modifierRangesNeedShape() const { return false; }
+void Text::prepareShape() {}
+void Text::addAtlasGlyphsAsPaths() {}
 const TextStyle* Text::styleFromShaperId(uint16_t id) const { return nullptr; }
 void Text::paragraphSpacingChanged() {}
 AABB Text::localBounds() const { return AABB(); }
@@ -125,7 +125,7 @@ void TextModifierGroup::computeCoverage(uint32_t textSize)
 }
 
 float TextModifierGroup::glyphCoverage(uint32_t textIndex,
-                                       uint32_t codePointCount)
+                                       uint32_t codePointCount) const
 {
     assert(codePointCount >= 1);
     float c = coverage(textIndex);
@@ -229,7 +229,7 @@ void TextModifierGroup::transform(float amount,
 
 float TextModifierGroup::computeOpacity(float current, float t) const
 {
-    if ((modifierFlags() & (uint32_t)TextModifierFlags::invertOpacity) != 0)
+    if (invertsOpacity())
     {
         return current * (1.0f - t) + opacity() * t;
     }
@@ -9,6 +9,10 @@
 #include "rive/text/text.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
+#include "rive/shapes/paint/fill.hpp"
+#include "rive/shapes/paint/solid_color.hpp"
+#include "rive/text/glyph_atlas.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -143,9 +147,238 @@ void TextStyle::rewindPath()
     m_path.rewind();
     m_hasContents = false;
     m_opacityPaths.clear();
+    m_atlasGlyphs.clear();
+    m_atlasMeshesDirty = true;
 }
 
-bool TextStyle::addPath(const RawPath& rawPath, float opacity)
+bool TextStyle::canDrawFromAtlas() const
+{
+    if (m_ShapePaints.size() != 1)
+    {
+        return false;
+    }
+    ShapePaint* shapePaint = m_ShapePaints.front();
+    return shapePaint->is<Fill>() && shapePaint->paint()->is<SolidColor>() &&
+           shapePaint->feather() == nullptr;
+}
+
+bool TextStyle::addAtlasGlyph(const rcp<GlyphPath>& glyphPath,
+                              float emPixelSize,
+                              const Mat2D& transform,
+                              float opacity)
+{
+    bool hadContents = m_hasContents;
+    m_hasContents = true;
+    if (opacity > 0.0f)
+    {
+        m_atlasGlyphs.push_back({glyphPath, emPixelSize, transform, opacity});
+        m_atlasMeshesDirty = true;
+    }
+    return !hadContents;
+}
+
+// Mesh indices are 16 bit, 4 vertices per quad.
+constexpr static uint32_t kMaxAtlasMeshQuads = 65536 / 4;
+
+bool TextStyle::buildAtlasMeshes(Factory* factory, GlyphAtlas* atlas)
+{
+    // Opaque glyphs first, the same order the paths draw in.
+    std::vector<const AtlasGlyph*> glyphs;
+    glyphs.reserve(m_atlasGlyphs.size());
+    for (const AtlasGlyph& glyph : m_atlasGlyphs)
+    {
+        glyphs.push_back(&glyph);
+    }
+    std::stable_sort(glyphs.begin(),
+                     glyphs.end(),
+                     [](const AtlasGlyph* a, const AtlasGlyph* b) {
+                         if ((a->opacity == 1.0f) != (b->opacity == 1.0f))
+                         {
+                             return a->opacity == 1.0f;
+                         }
+                         return a->opacity < b->opacity;
+                     });
+
+    // Rasterize everything before reading the generation, so the quads
+    // match the page even if it had to be cleared along the way. If it is
+    // cleared again on the second pass, the glyphs don't fit in one page
+    // together and the quads would point into two different generations.
+    std::vector<GlyphAtlas::Glyph> atlasGlyphs(glyphs.size());
+    std::vector<bool> found(glyphs.size());
+    bool sameGeneration = false;
+    for (int attempt = 0; attempt < 2 && !sameGeneration; ++attempt)
+    {
+        uint32_t generation = atlas->generation();
+        for (size_t i = 0; i < glyphs.size(); ++i)
+        {
+            found[i] = atlas->find(glyphs[i]->glyphPath,
+                                   glyphs[i]->emPixelSize,
+                                   &atlasGlyphs[i]);
+        }
+        m_atlasGeneration = generation;
+        sameGeneration = atlas->generation() == generation;
+    }
+    if (!sameGeneration)
+    {
+        m_atlasMeshCount = 0;
+        return false;
+    }
+
+    m_atlasMeshCount = 0;
+    size_t i = 0;
+    while (i < glyphs.size())
+    {
+        // Glyphs with the same opacity, up to the mesh size limit.
+        float opacity = glyphs[i]->opacity;
+        size_t end = i;
+        uint32_t quadCount = 0;
+        while (end < glyphs.size() && glyphs[end]->opacity == opacity &&
+               quadCount < kMaxAtlasMeshQuads)
+        {
+            quadCount += found[end] ? 1 : 0;
+            ++end;
+        }
+
+        if (m_atlasMeshCount == m_atlasMeshes.size())
+        {
+            m_atlasMeshes.push_back({});
+        }
+        AtlasMesh& mesh = m_atlasMeshes[m_atlasMeshCount++];
+        mesh.opacity = opacity;
+        mesh.quadCount = quadCount;
+        if (mesh.quadCapacity < quadCount || mesh.vertices == nullptr)
+        {
+            mesh.quadCapacity =
+                std::min(std::max(quadCount * 2, 64u), kMaxAtlasMeshQuads);
+            size_t vertexBytes = mesh.quadCapacity * 4 * sizeof(Vec2D);
+            mesh.vertices = factory->makeRenderBuffer(RenderBufferType::vertex,
+                                                      RenderBufferFlags::none,
+                                                      vertexBytes);
+            mesh.uvs = factory->makeRenderBuffer(RenderBufferType::vertex,
+                                                 RenderBufferFlags::none,
+                                                 vertexBytes);
+            mesh.indices = factory->makeRenderBuffer(
+                RenderBufferType::index,
+                RenderBufferFlags::mappedOnceAtInitialization,
+                mesh.quadCapacity * 6 * sizeof(uint16_t));
+            if (mesh.indices != nullptr)
+            {
+                auto indices = static_cast<uint16_t*>(mesh.indices->map());
+                for (uint32_t quad = 0; quad < mesh.quadCapacity; ++quad)
+                {
+                    auto base = static_cast<uint16_t>(quad * 4);
+                    *indices++ = base;
+                    *indices++ = base + 1;
+                    *indices++ = base + 2;
+                    *indices++ = base;
+                    *indices++ = base + 2;
+                    *indices++ = base + 3;
+                }
+                mesh.indices->unmap();
+            }
+        }
+        if (mesh.vertices == nullptr || mesh.uvs == nullptr ||
+            mesh.indices == nullptr)
+        {
+            mesh.quadCount = 0;
+            i = end;
+            continue;
+        }
+
+        auto vertices = static_cast<Vec2D*>(mesh.vertices->map());
+        auto uvs = static_cast<Vec2D*>(mesh.uvs->map());
+        for (; i < end; ++i)
+        {
+            if (!found[i])
+            {
+                continue;
+            }
+            const AABB& bounds = atlasGlyphs[i].bounds;
+            const AABB& uv = atlasGlyphs[i].uvs;
+            const Mat2D& transform = glyphs[i]->transform;
+            *vertices++ = transform * Vec2D(bounds.minX, bounds.minY);
+            *vertices++ = transform * Vec2D(bounds.maxX, bounds.minY);
+            *vertices++ = transform * Vec2D(bounds.maxX, bounds.maxY);
+            *vertices++ = transform * Vec2D(bounds.minX, bounds.maxY);
+            *uvs++ = Vec2D(uv.minX, uv.minY);
+            *uvs++ = Vec2D(uv.maxX, uv.minY);
+            *uvs++ = Vec2D(uv.maxX, uv.maxY);
+            *uvs++ = Vec2D(uv.minX, uv.maxY);
+        }
+        mesh.vertices->unmap();
+        mesh.uvs->unmap();
+    }
+    m_atlasMeshesDirty = false;
+    return true;
+}
+
+void TextStyle::addAtlasGlyphsAsPaths()
+{
+    std::vector<AtlasGlyph> atlasGlyphs = std::move(m_atlasGlyphs);
+    m_atlasGlyphs.clear();
+    m_atlasMeshCount = 0;
+    for (const AtlasGlyph& glyph : atlasGlyphs)
+    {
+        addPath(glyph.glyphPath->rawPath(), glyph.opacity, &glyph.transform);
+    }
+}
+
+void TextStyle::drawFromAtlas(Renderer* renderer, const Mat2D& worldTransform)
+{
+    assert(canDrawFromAtlas());
+    ShapePaint* shapePaint = m_ShapePaints.front();
+    Factory* factory = artboard()->factory();
+    GlyphAtlas* atlas = factory != nullptr ? factory->glyphAtlas() : nullptr;
+    if (!shapePaint->isVisible() || atlas == nullptr)
+    {
+        return;
+    }
+    if ((m_atlasMeshesDirty || m_atlasGeneration != atlas->generation()) &&
+        !buildAtlasMeshes(factory, atlas))
+    {
+        // The glyphs didn't fit in the page together. Draw the whole Text as
+        // paths until it is built again.
+        parent()->as<Text>()->addAtlasGlyphsAsPaths();
+        draw(renderer, worldTransform);
+        return;
+    }
+
+    // The page is colored with the fill's RGB, its alpha goes into the
+    // opacity along with the fill's render opacity, like
+    // SolidColor::applyTo.
+    ColorInt color = shapePaint->paint()->as<SolidColor>()->colorValue();
+    rcp<RenderImage> image = atlas->image(color);
+    if (image == nullptr)
+    {
+        return;
+    }
+    float paintOpacity = colorOpacity(color) * shapePaint->renderOpacity();
+    BlendMode blendMode = parent()->as<Text>()->blendMode();
+
+    renderer->save();
+    renderer->transform(worldTransform);
+    for (size_t i = 0; i < m_atlasMeshCount; ++i)
+    {
+        const AtlasMesh& mesh = m_atlasMeshes[i];
+        if (mesh.quadCount == 0)
+        {
+            continue;
+        }
+        renderer->drawImageMesh(image.get(),
+                                mesh.vertices,
+                                mesh.uvs,
+                                mesh.indices,
+                                mesh.quadCount * 4,
+                                mesh.quadCount * 6,
+                                blendMode,
+                                paintOpacity * mesh.opacity);
+    }
+    renderer->restore();
+}
+
+bool TextStyle::addPath(const RawPath& rawPath,
+                        float opacity,
+                        const Mat2D* transform)
 {
     bool hadContents = m_hasContents;
     m_hasContents = true;
@@ -153,7 +386,7 @@ bool TextStyle::addPath(const RawPath& rawPath, float opacity)
     {
 
         // m_path contains everything, so inner feather bounds can work.
-        m_path.addPathClockwise(rawPath);
+        m_path.addPathClockwise(rawPath, transform);
 
         // Bucket by opacity
         auto itr = m_opacityPaths.find(opacity);
@@ -168,7 +401,7 @@ bool TextStyle::addPath(const RawPath& rawPath, float opacity)
             m_opacityPaths[opacity] = ShapePaintPath(true, FillRule::clockwise);
             shapePaintPath = &m_opacityPaths.at(opacity);
         }
-        shapePaintPath->addPathClockwise(rawPath);
+        shapePaintPath->addPathClockwise(rawPath, transform);
     }
 
     return !hadContents;
@@ -176,6 +409,11 @@ bool TextStyle::addPath(const RawPath& rawPath, float opacity)
 
 void TextStyle::draw(Renderer* renderer, const Mat2D& worldTransform)
 {
+    if (!m_atlasGlyphs.empty())
+    {
+        drawFromAtlas(renderer, worldTransform);
+        return;
+    }
     for (auto shapePaint : m_ShapePaints)
     {
         if (!shapePaint->isVisible())
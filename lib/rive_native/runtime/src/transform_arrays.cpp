@@ -0,0 +1,296 @@
+#include "rive/transform_arrays.hpp"
+#include "rive/artboard.hpp"
+#include "rive/math/simd.hpp"
+#include "rive/node.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace rive;
+
+static constexpr uint8_t kLocalDirt = 1 << 0;
+static constexpr uint8_t kWorldDirt = 1 << 1;
+
+void TransformArrays::clear()
+{
+    for (size_t i = 1; i < m_nodes.size(); i++)
+    {
+        m_nodes[i]->m_FlatTransformIndex = 0;
+    }
+    m_nodes.clear();
+    m_parents.clear();
+    m_levelEnds.clear();
+    resize(0);
+}
+
+void TransformArrays::resize(size_t count)
+{
+    // Pad so that a group of four starting at the last node stays in bounds.
+    size_t padded = count == 0 ? 0 : count + 3;
+    m_parents.resize(padded, 0);
+    m_dirt.assign(padded, 0);
+    m_x.resize(padded);
+    m_y.resize(padded);
+    m_rotation.resize(padded);
+    m_scaleX.resize(padded);
+    m_scaleY.resize(padded);
+    for (int i = 0; i < 6; i++)
+    {
+        m_local[i].resize(padded);
+        m_world[i].resize(padded);
+    }
+}
+
+void TransformArrays::build(const std::vector<Component*>& dependencyOrder)
+{
+    clear();
+
+    // Dependency order visits parents before their children, so a node can
+    // only be flattened once its parent was. The flat index is used as a
+    // temporary 1 based index into nodes/depths while collecting.
+    std::vector<Node*> nodes;
+    std::vector<uint32_t> depths;
+    uint32_t levelCount = 0;
+    for (auto component : dependencyOrder)
+    {
+        if (component->coreType() != NodeBase::typeKey)
+        {
+            continue;
+        }
+        auto node = component->as<Node>();
+        if (!node->constraints().empty())
+        {
+            continue;
+        }
+        auto parent = node->parent();
+        uint32_t depth;
+        if (parent != nullptr && parent == node->artboard())
+        {
+            depth = 0;
+        }
+        else if (parent != nullptr &&
+                 parent->coreType() == NodeBase::typeKey &&
+                 parent->as<Node>()->m_FlatTransformIndex != 0)
+        {
+            depth = depths[parent->as<Node>()->m_FlatTransformIndex - 1] + 1;
+        }
+        else
+        {
+            continue;
+        }
+        nodes.push_back(node);
+        depths.push_back(depth);
+        node->m_FlatTransformIndex = (uint32_t)nodes.size();
+        levelCount = std::max(levelCount, depth + 1);
+    }
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    // Bucket by depth, keeping dependency order within a level.
+    m_levelEnds.assign(levelCount, 0);
+    for (auto depth : depths)
+    {
+        m_levelEnds[depth]++;
+    }
+    std::vector<uint32_t> levelCursors(levelCount);
+    uint32_t end = 1;
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        levelCursors[level] = end;
+        end += m_levelEnds[level];
+        m_levelEnds[level] = end;
+    }
+    m_nodes.resize(nodes.size() + 1, nullptr);
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        auto index = levelCursors[depths[i]]++;
+        m_nodes[index] = nodes[i];
+        nodes[i]->m_FlatTransformIndex = index;
+    }
+
+    resize(m_nodes.size());
+    for (uint32_t i = 1; i < m_nodes.size(); i++)
+    {
+        auto node = m_nodes[i];
+        auto parent = node->parent();
+        m_parents[i] = parent == node->artboard()
+                           ? 0
+                           : parent->as<Node>()->m_FlatTransformIndex;
+        store(i, node->transform(), node->worldTransform());
+    }
+}
+
+void TransformArrays::store(uint32_t index,
+                            const Mat2D& transform,
+                            const Mat2D& world)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        m_local[i][index] = transform[i];
+        m_world[i][index] = world[i];
+    }
+}
+
+void TransformArrays::update(const Mat2D& rootWorld)
+{
+    if (empty())
+    {
+        return;
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        m_world[i][0] = rootWorld[i];
+    }
+
+    // Gather the dirt (and the local values of anything with Transform dirt)
+    // so the sweeps below only touch the arrays.
+    uint8_t allDirt = 0;
+    auto count = (uint32_t)m_nodes.size();
+    for (uint32_t i = 1; i < count; i++)
+    {
+        auto node = m_nodes[i];
+        auto d = node->m_Dirt;
+        uint8_t dirt = 0;
+        if ((d & ComponentDirt::Collapsed) != ComponentDirt::Collapsed)
+        {
+            if (Component::hasDirt(d, ComponentDirt::Transform))
+            {
+                dirt = kLocalDirt | kWorldDirt;
+                m_x[i] = node->x();
+                m_y[i] = node->y();
+                m_rotation[i] = node->rotation();
+                m_scaleX[i] = node->scaleX();
+                m_scaleY[i] = node->scaleY();
+            }
+            else if (Component::hasDirt(d, ComponentDirt::WorldTransform))
+            {
+                dirt = kWorldDirt;
+            }
+            node->m_Dirt =
+                d & ~(ComponentDirt::Transform | ComponentDirt::WorldTransform);
+        }
+        m_dirt[i] = dirt;
+        allDirt |= dirt;
+    }
+    if (allDirt == 0)
+    {
+        return;
+    }
+
+    if ((allDirt & kLocalDirt) != 0)
+    {
+        updateLocal();
+    }
+    uint32_t begin = 1;
+    for (auto end : m_levelEnds)
+    {
+        updateWorld(begin, end);
+        begin = end;
+    }
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        auto dirt = m_dirt[i];
+        if ((dirt & kLocalDirt) != 0)
+        {
+            m_nodes[i]->mutableTransform() = Mat2D(m_local[0][i],
+                                                   m_local[1][i],
+                                                   m_local[2][i],
+                                                   m_local[3][i],
+                                                   m_local[4][i],
+                                                   m_local[5][i]);
+        }
+        if ((dirt & kWorldDirt) != 0)
+        {
+            m_nodes[i]->mutableWorldTransform() = Mat2D(m_world[0][i],
+                                                        m_world[1][i],
+                                                        m_world[2][i],
+                                                        m_world[3][i],
+                                                        m_world[4][i],
+                                                        m_world[5][i]);
+        }
+    }
+}
+
+static int4 loadDirtMask(const uint8_t* dirt, uint8_t flag)
+{
+    int4 values = simd::cast<int32_t>(simd::load<uint8_t, 4>(dirt));
+    return (values & (int)flag) != 0;
+}
+
+static void storeMasked(float* dst, int4 mask, float4 value)
+{
+    simd::store(dst, simd::if_then_else(mask, value, simd::load4f(dst)));
+}
+
+void TransformArrays::updateLocal()
+{
+    // Same math as TransformComponent::updateTransform (rotation matrix scaled
+    // by x/y scale) so results are identical to the per node update.
+    auto count = (uint32_t)m_nodes.size();
+    for (uint32_t i = 1; i < count; i += 4)
+    {
+        int4 mask = loadDirtMask(&m_dirt[i], kLocalDirt);
+        if (!simd::any(mask))
+        {
+            continue;
+        }
+        float4 s = 0.0f, c = 1.0f;
+        for (int lane = 0; lane < 4; lane++)
+        {
+            float rad = m_rotation[i + lane];
+            if (rad != 0)
+            {
+                s[lane] = sin(rad);
+                c[lane] = cos(rad);
+            }
+        }
+        float4 scaleX = simd::load4f(&m_scaleX[i]);
+        float4 scaleY = simd::load4f(&m_scaleY[i]);
+        storeMasked(&m_local[0][i], mask, c * scaleX);
+        storeMasked(&m_local[1][i], mask, s * scaleX);
+        storeMasked(&m_local[2][i], mask, -s * scaleY);
+        storeMasked(&m_local[3][i], mask, c * scaleY);
+        storeMasked(&m_local[4][i], mask, simd::load4f(&m_x[i]));
+        storeMasked(&m_local[5][i], mask, simd::load4f(&m_y[i]));
+    }
+}
+
+void TransformArrays::updateWorld(uint32_t begin, uint32_t end)
+{
+    // Every parent lives in a previous level (or is the artboard in slot 0),
+    // so the nodes of a level only read world transforms that are final.
+    for (uint32_t i = begin; i < end; i += 4)
+    {
+        int4 lanes = int4{0, 1, 2, 3} + (int32_t)i;
+        int4 mask = loadDirtMask(&m_dirt[i], kWorldDirt) & (lanes < (int)end);
+        if (!simd::any(mask))
+        {
+            continue;
+        }
+        const uint32_t* parents = &m_parents[i];
+        float4 a[6];
+        for (int k = 0; k < 6; k++)
+        {
+            const float* world = m_world[k].data();
+            a[k] = float4{world[parents[0]],
+                          world[parents[1]],
+                          world[parents[2]],
+                          world[parents[3]]};
+        }
+        float4 b0 = simd::load4f(&m_local[0][i]);
+        float4 b1 = simd::load4f(&m_local[1][i]);
+        float4 b2 = simd::load4f(&m_local[2][i]);
+        float4 b3 = simd::load4f(&m_local[3][i]);
+        float4 b4 = simd::load4f(&m_local[4][i]);
+        float4 b5 = simd::load4f(&m_local[5][i]);
+        // Mat2D::multiply(parentWorld, local).
+        storeMasked(&m_world[0][i], mask, a[0] * b0 + a[2] * b1);
+        storeMasked(&m_world[1][i], mask, a[1] * b0 + a[3] * b1);
+        storeMasked(&m_world[2][i], mask, a[0] * b2 + a[2] * b3);
+        storeMasked(&m_world[3][i], mask, a[1] * b2 + a[3] * b3);
+        storeMasked(&m_world[4][i], mask, a[0] * b4 + a[2] * b5 + a[4]);
+        storeMasked(&m_world[5][i], mask, a[1] * b4 + a[3] * b5 + a[5]);
+    }
+}
@@ -1,4 +1,5 @@
 #include "rive/transform_component.hpp"
+#include "rive/artboard.hpp"
 #include "rive/world_transform_component.hpp"
 #include "rive/shapes/clipping_shape.hpp"
 #include "rive/math/vec2d.hpp"
@@ -102,6 +103,16 @@ void TransformComponent::update(ComponentDirt value)
     {
         updateWorldTransform();
     }
+    if (m_FlatTransformIndex != 0 &&
+        hasDirt(value,
+                ComponentDirt::Transform | ComponentDirt::WorldTransform))
+    {
+        // Dirtied after the artboard's transform sweep ran, keep the
+        // flattened copy current for the children that read it.
+        artboard()->transformArrays().store(m_FlatTransformIndex,
+                                            m_Transform,
+                                            m_WorldTransform);
+    }
     if (hasDirt(value, ComponentDirt::RenderOpacity))
     {
         m_RenderOpacity = opacity();
@@ -9,6 +9,7 @@
 #include "rive/importers/viewmodel_importer.hpp"
 #include "rive/viewmodel/viewmodel_property_viewmodel.hpp"
 #include "rive/core_context.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/refcnt.hpp"
 
 using namespace rive;
@@ -119,7 +120,7 @@ std::vector<ViewModelInstanceValue*> ViewModelInstance::propertyValues()
 
 Core* ViewModelInstance::clone() const
 {
-    auto cloned = new ViewModelInstance();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstance();
     cloned->copy(*this);
     for (auto propertyValue : m_PropertyValues)
     {
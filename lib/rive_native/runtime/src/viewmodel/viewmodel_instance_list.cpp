@@ -5,6 +5,7 @@
 #include "rive/viewmodel/viewmodel_instance_list.hpp"
 #include "rive/viewmodel/viewmodel_instance_list_item.hpp"
 #include "rive/component_dirt.hpp"
+#include "rive/core/core_arena.hpp"
 
 using namespace rive;
 
@@ -69,7 +70,7 @@ void ViewModelInstanceList::swap(uint32_t index1, uint32_t index2)
 
 Core* ViewModelInstanceList::clone() const
 {
-    auto cloned = new ViewModelInstanceList();
+    auto cloned = new (CoreArena::claimForClone()) ViewModelInstanceList();
     cloned->copy(*this);
     for (auto property : m_ListItems)
     {
@@ -0,0 +1,61 @@
+import 'package:flutter_test/flutter_test.dart';
+import 'package:rive_native/rive_native.dart' as rive;
+import 'package:rive_native/src/rive.dart';
+
+import 'src/utils.dart';
+
+void main() {
+  late rive.File riveFile;
+
+  setUp(() async {
+    TestWidgetsFlutterBinding.ensureInitialized();
+    final riveBytes = loadFile('assets/events_test.riv');
+    riveFile =
+        await rive.File.decode(riveBytes, riveFactory: rive.Factory.flutter)
+            as rive.File;
+  });
+
+  List<rive.StateMachine> makeStateMachines(int count) {
+    final stateMachines = <rive.StateMachine>[];
+    for (var i = 0; i < count; i++) {
+      final artboard = riveFile.defaultArtboard();
+      expect(artboard, isNotNull);
+      final stateMachine = artboard!.defaultStateMachine();
+      expect(stateMachine, isNotNull);
+      stateMachines.add(stateMachine!);
+    }
+    return stateMachines;
+  }
+
+  test('Back to back batches of varying sizes all complete', () async {
+    final stateMachines = makeStateMachines(200);
+    // Sizes cycle through single items, sizes smaller than the worker count
+    // and sizes that get split into many chunks, so that ranges get stolen
+    // while the next batch is being published.
+    for (var batch = 0; batch < 5000; batch++) {
+      final count = (batch * 7919) % stateMachines.length + 1;
+      Rive.batchAdvance(stateMachines.take(count), 0.016);
+    }
+    for (final stateMachine in stateMachines) {
+      expect(stateMachine.advanceAndApply(0.016), isA<bool>());
+    }
+  }, timeout: const Timeout(Duration(minutes: 2)));
+
+  test('Every state machine in a batch is advanced', () async {
+    for (var round = 0; round < 100; round++) {
+      final stateMachines = makeStateMachines(round % 40 + 1);
+      for (final stateMachine in stateMachines) {
+        stateMachine.trigger('FireGeneralEvent')!.fire();
+      }
+      Rive.batchAdvance(stateMachines, 0.016);
+      for (final stateMachine in stateMachines) {
+        final events = stateMachine.reportedEvents();
+        expect(events.length, 1);
+        expect(events[0].name, 'SomeGeneralEvent');
+      }
+      for (final stateMachine in stateMachines) {
+        stateMachine.dispose();
+      }
+    }
+  }, timeout: const Timeout(Duration(minutes: 2)));
+}
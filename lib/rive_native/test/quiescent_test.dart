@@ -0,0 +1,53 @@
+import 'package:flutter_test/flutter_test.dart';
+import 'package:rive_native/rive_native.dart' as rive;
+
+import 'src/utils.dart';
+
+void main() {
+  setUp(() {
+    TestWidgetsFlutterBinding.ensureInitialized();
+  });
+
+  Future<rive.StateMachine> loadStateMachine(String path) async {
+    final riveBytes = loadFile(path);
+    final riveFile =
+        await rive.File.decode(riveBytes, riveFactory: rive.Factory.flutter)
+            as rive.File;
+    final artboard = riveFile.defaultArtboard();
+    expect(artboard, isNotNull);
+    final stateMachine = artboard!.defaultStateMachine();
+    expect(stateMachine, isNotNull);
+    return stateMachine!;
+  }
+
+  test('A settled state machine is quiescent until an input changes',
+      () async {
+    final stateMachine = await loadStateMachine('assets/events_test.riv');
+    expect(stateMachine.isQuiescent, false);
+    for (var i = 0; i < 3; i++) {
+      stateMachine.advanceAndApply(0.016);
+    }
+    expect(stateMachine.isQuiescent, true);
+
+    // Firing a trigger needs an advance, which reports the event.
+    stateMachine.trigger('FireGeneralEvent')!.fire();
+    expect(stateMachine.isQuiescent, false);
+    stateMachine.advanceAndApply(0.016);
+    expect(stateMachine.reportedEvents().length, 1);
+    expect(stateMachine.isQuiescent, false);
+
+    // Once the event is consumed it settles again.
+    stateMachine.advanceAndApply(0.016);
+    expect(stateMachine.isQuiescent, true);
+    stateMachine.dispose();
+  });
+
+  test('An animating state machine is never quiescent', () async {
+    final stateMachine = await loadStateMachine('assets/off_road_car.riv');
+    for (var i = 0; i < 300; i++) {
+      expect(stateMachine.advanceAndApply(0.016), true);
+      expect(stateMachine.isQuiescent, false);
+    }
+    stateMachine.dispose();
+  });
+}